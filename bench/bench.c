@@ -0,0 +1,163 @@
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <inttypes.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "bench.h"
+
+typedef enum
+{
+	BENCH_FORMAT_TEXT,
+	BENCH_FORMAT_CSV,
+	BENCH_FORMAT_JSON,
+}BENCH_Format;
+
+static BENCH_Format format = BENCH_FORMAT_TEXT;
+static FILE* output;
+static uint32_t reports;
+
+static uint64_t readNs(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+static uint64_t readCycles(void)
+{
+#if defined(__x86_64__) || defined(__i386__)
+	return __rdtsc();
+#else
+	return 0;
+#endif
+}
+
+void BENCH_Start(BENCH_Sample* sample)
+{
+	sample->ns = readNs();
+	sample->cycles = readCycles();
+}
+
+void BENCH_Stop(BENCH_Sample* sample)
+{
+	sample->cycles = readCycles() - sample->cycles;
+	sample->ns = readNs() - sample->ns;
+}
+
+/* Name is quoted in CSV and JSON, none of the names has control characters */
+static void printName(const char* name, char quote, char escape)
+{
+	fputc(quote, output);
+	for(; *name != 0x00; name++)
+	{
+		if(*name == quote || *name == escape)
+		{
+			fputc(escape, output);
+		}
+		fputc(*name, output);
+	}
+	fputc(quote, output);
+}
+
+void BENCH_Report(const char* name, const BENCH_Sample* sample,
+                  uint64_t ops, uint64_t bytes)
+{
+	double ns = (double)sample->ns;
+	double nsPerOp = ns / (double)ops;
+	double cyclesPerOp = (double)sample->cycles / (double)ops;
+	double bytesPerSecond = ns > 0 ? (double)bytes * 1e9 / ns : 0.0;
+	switch(format)
+	{
+	case BENCH_FORMAT_CSV:
+		printName(name, '"', '"');
+		fprintf(output, ",%.3f,%.3f,%.0f\n", nsPerOp, cyclesPerOp,
+		        bytesPerSecond);
+		break;
+	case BENCH_FORMAT_JSON:
+		fprintf(output, "%s\n  {\"name\": ", reports ? "," : "");
+		printName(name, '"', '\\');
+		fprintf(output, ", \"ns_per_op\": %.3f, \"cycles_per_op\": %.3f, "
+		        "\"bytes_per_s\": %.0f}", nsPerOp, cyclesPerOp,
+		        bytesPerSecond);
+		break;
+	default:
+		fprintf(output, "%-44s %10.2f ns/op %10.2f cycles/op %10.2f MB/s\n",
+		        name, nsPerOp, cyclesPerOp, bytesPerSecond / 1e6);
+		break;
+	}
+	reports++;
+}
+
+/* xorshift32, deterministic between runs */
+uint32_t BENCH_Random(void)
+{
+	static uint32_t state = 2463534242u;
+	state ^= state << 13;
+	state ^= state >> 17;
+	state ^= state << 5;
+	return state;
+}
+
+#define BENCH_USAGE     "Usage: %s [--text | --csv | --json] [file]\n"
+
+/* Utils_Bench [--text | --csv | --json] [file] */
+int main(int argc, char* argv[])
+{
+	output = stdout;
+	if(argc > 1)
+	{
+		if(strcmp(argv[1], "--csv") == 0)       format = BENCH_FORMAT_CSV;
+		else if(strcmp(argv[1], "--json") == 0) format = BENCH_FORMAT_JSON;
+		else if(strcmp(argv[1], "--help") == 0 || strcmp(argv[1], "-h") == 0)
+		{
+			printf(BENCH_USAGE, argv[0]);
+			return 0;
+		}
+		else if(strcmp(argv[1], "--text") != 0)
+		{
+			fprintf(stderr, BENCH_USAGE, argv[0]);
+			return 1;
+		}
+	}
+	if(argc > 2 && (output = fopen(argv[2], "w")) == NULL)
+	{
+		perror(argv[2]);
+		return 1;
+	}
+
+	if(format == BENCH_FORMAT_CSV)
+		fprintf(output, "name,ns_per_op,cycles_per_op,bytes_per_s\n");
+	else if(format == BENCH_FORMAT_JSON)
+		fprintf(output, "[");
+	else
+		fprintf(output, "Benchmark application has started!\n");
+
+	BENCH_Int();
+	BENCH_Hex();
+	BENCH_Bin();
+	BENCH_Base64();
+	BENCH_String();
+	BENCH_Writer();
+	BENCH_Printf();
+	BENCH_Scanner();
+	BENCH_Crc();
+	BENCH_Varint();
+	BENCH_Float();
+	BENCH_Half();
+	BENCH_Fixed();
+	BENCH_List();
+	BENCH_Endian();
+	BENCH_Api();
+	BENCH_Inline();
+	BENCH_Hpp();
+	BENCH_Threads();
+
+	if(format == BENCH_FORMAT_JSON)
+		fprintf(output, "\n]\n");
+	if(output != stdout)
+		fclose(output);
+	return 0;
+}
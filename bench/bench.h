@@ -0,0 +1,68 @@
+/**
+ * @file bench.h
+ * @brief Common helpers of the benchmark application
+ *
+ * Every benchmark measures a loop of 'ops' operations with BENCH_Start()
+ * and BENCH_Stop() and prints the result with BENCH_Report(): ns/op,
+ * cycles/op (TSC) and throughput, as a text table, CSV or JSON array
+ * selected on the command line.
+ */
+#ifndef BENCH_BENCH_H_
+#define BENCH_BENCH_H_
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct
+{
+	uint64_t ns;
+	uint64_t cycles;
+}BENCH_Sample;
+
+/* Keep the compiler from removing a computation whose result is unused */
+#define BENCH_KEEP(value)    __asm__ volatile("" : : "g"(value) : "memory")
+
+void BENCH_Start(BENCH_Sample* sample);
+void BENCH_Stop(BENCH_Sample* sample);
+void BENCH_Report(const char* name, const BENCH_Sample* sample,
+                  uint64_t ops, uint64_t bytes);
+uint32_t BENCH_Random(void);
+
+void BENCH_Int(void);
+void BENCH_Hex(void);
+void BENCH_Bin(void);
+void BENCH_Base64(void);
+void BENCH_String(void);
+void BENCH_Writer(void);
+void BENCH_Printf(void);
+void BENCH_Scanner(void);
+void BENCH_Crc(void);
+void BENCH_Varint(void);
+void BENCH_Float(void);
+void BENCH_Half(void);
+void BENCH_Fixed(void);
+void BENCH_List(void);
+void BENCH_Endian(void);
+void BENCH_Api(void);
+void BENCH_Threads(void);
+void BENCH_Inline(void);
+void BENCH_Hpp(void);
+
+/* Loops of bench_inline_loops.h built with and without UTILS_HEADER_ONLY */
+void BENCH_LibraryFloatBits(const float* floats, uint32_t* bits, uint32_t count);
+void BENCH_InlineFloatBits(const float* floats, uint32_t* bits, uint32_t count);
+void BENCH_LibraryDigits(const char* ascii, uint8_t* bytes, uint32_t count);
+void BENCH_InlineDigits(const char* ascii, uint8_t* bytes, uint32_t count);
+void BENCH_LibraryAscii(const uint8_t* bytes, char* ascii, uint32_t count);
+void BENCH_InlineAscii(const uint8_t* bytes, char* ascii, uint32_t count);
+void BENCH_LibraryPack(const uint32_t* integers, uint8_t* bytes, uint32_t count);
+void BENCH_InlinePack(const uint32_t* integers, uint8_t* bytes, uint32_t count);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BENCH_BENCH_H_ */
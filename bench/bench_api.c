@@ -0,0 +1,169 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "bench.h"
+#include "utils.h"
+
+#define BENCH_API_VALUES    4096
+#define BENCH_API_ROUNDS    100
+
+/* Every scalar function runs on two sets of inputs: one value repeated
+ * (predictable branches, warm tables) and uniformly random values */
+typedef struct
+{
+	const char* name;
+	uint32_t integers[BENCH_API_VALUES];
+	uint64_t integers64[BENCH_API_VALUES];
+	float floats[BENCH_API_VALUES];
+	char digits[BENCH_API_VALUES];
+	char hex[BENCH_API_VALUES][11];
+	char hex64[BENCH_API_VALUES][19];
+}BENCH_Inputs;
+
+static BENCH_Inputs fixedInputs = {.name = "fixed"};
+static BENCH_Inputs randomInputs = {.name = "random"};
+
+#define BENCH_API_LOOP(label, inputs, statement)                              \
+	do                                                                        \
+	{                                                                         \
+		BENCH_Sample sample;                                                  \
+		char name[64];                                                        \
+		BENCH_Start(&sample);                                                 \
+		for(int round = 0; round < BENCH_API_ROUNDS; round++)                 \
+		{                                                                     \
+			for(int i = 0; i < BENCH_API_VALUES; i++)                         \
+			{                                                                 \
+				statement;                                                    \
+			}                                                                 \
+		}                                                                     \
+		BENCH_Stop(&sample);                                                  \
+		snprintf(name, sizeof(name), "%s %s", label, (inputs)->name);         \
+		BENCH_Report(name, &sample,                                           \
+		             (uint64_t)BENCH_API_VALUES * BENCH_API_ROUNDS, 0);       \
+	}while(0)
+
+static void fillInputs(BENCH_Inputs* inputs, int isRandom)
+{
+	for(int i = 0; i < BENCH_API_VALUES; i++)
+	{
+		uint32_t integer = isRandom ? BENCH_Random() : 0x12345678u;
+		uint64_t integer64 = isRandom ?
+		                     ((uint64_t)BENCH_Random() << 32) | BENCH_Random() :
+		                     0x0123456789ABCDEFull;
+		inputs->integers[i] = integer;
+		inputs->integers64[i] = integer64;
+		inputs->floats[i] = isRandom ? (float)integer / (float)BENCH_Random() :
+		                               3.14159f;
+		inputs->digits[i] = (char)('0' + integer % 10);
+		snprintf(inputs->hex[i], sizeof(inputs->hex[i]), "0x%" PRIX32, integer);
+		snprintf(inputs->hex64[i], sizeof(inputs->hex64[i]), "0x%" PRIX64,
+		         integer64);
+	}
+}
+
+static void benchBytes(BENCH_Inputs* in)
+{
+	uint8_t bytes[4];
+	BENCH_API_LOOP("UTILS_Uint2ByteArray", in,
+	               UTILS_Uint2ByteArray(in->integers[i], bytes);
+	               BENCH_KEEP(bytes));
+	BENCH_API_LOOP("UTILS_ByteArray2Uint", in,
+	               uint32_t integer;
+	               UTILS_ByteArray2Uint((uint8_t*)&in->integers[i], &integer);
+	               BENCH_KEEP(integer));
+	BENCH_API_LOOP("UTILS_AsciiDigit2Byte", in,
+	               uint8_t byte;
+	               UTILS_AsciiDigit2Byte(in->digits[i], &byte);
+	               BENCH_KEEP(byte));
+	BENCH_API_LOOP("UTILS_Byte2AsciiDigit", in,
+	               char ascii;
+	               UTILS_Byte2AsciiDigit(in->integers[i] % 10, &ascii);
+	               BENCH_KEEP(ascii));
+}
+
+static void benchHex(BENCH_Inputs* in)
+{
+	char hex[19];
+	BENCH_API_LOOP("UTILS_Hex2Uint", in,
+	               uint32_t integer;
+	               UTILS_Hex2Uint(in->hex[i], &integer);
+	               BENCH_KEEP(integer));
+	BENCH_API_LOOP("strtoul", in,
+	               uint32_t integer = strtoul(in->hex[i], NULL, 16);
+	               BENCH_KEEP(integer));
+	BENCH_API_LOOP("UTILS_Hex2Uint64", in,
+	               uint64_t integer;
+	               UTILS_Hex2Uint64(in->hex64[i], &integer);
+	               BENCH_KEEP(integer));
+	BENCH_API_LOOP("strtoull", in,
+	               uint64_t integer = strtoull(in->hex64[i], NULL, 16);
+	               BENCH_KEEP(integer));
+	BENCH_API_LOOP("UTILS_Uint2Hex", in,
+	               UTILS_Uint2Hex(in->integers[i], hex, sizeof(hex));
+	               BENCH_KEEP(hex[0]));
+	BENCH_API_LOOP("snprintf 0x%X", in,
+	               snprintf(hex, sizeof(hex), "0x%" PRIX32, in->integers[i]);
+	               BENCH_KEEP(hex[0]));
+}
+
+static void benchFloat(BENCH_Inputs* in)
+{
+	char hex[11];
+	BENCH_API_LOOP("UTILS_Float2Uint", in,
+	               uint32_t integer;
+	               UTILS_Float2Uint(in->floats[i], &integer);
+	               BENCH_KEEP(integer));
+	BENCH_API_LOOP("memcpy float to uint32_t", in,
+	               uint32_t integer;
+	               memcpy(&integer, &in->floats[i], sizeof(integer));
+	               BENCH_KEEP(integer));
+	BENCH_API_LOOP("UTILS_Uint2Float", in,
+	               float fp;
+	               UTILS_Uint2Float(in->integers[i], &fp);
+	               BENCH_KEEP(fp));
+	BENCH_API_LOOP("memcpy uint32_t to float", in,
+	               float fp;
+	               memcpy(&fp, &in->integers[i], sizeof(fp));
+	               BENCH_KEEP(fp));
+	BENCH_API_LOOP("UTILS_Float2Hex", in,
+	               UTILS_Float2Hex(in->floats[i], hex, sizeof(hex));
+	               BENCH_KEEP(hex[0]));
+	BENCH_API_LOOP("snprintf float 0x%08X", in,
+	               uint32_t integer;
+	               memcpy(&integer, &in->floats[i], sizeof(integer));
+	               snprintf(hex, sizeof(hex), "0x%08" PRIX32, integer);
+	               BENCH_KEEP(hex[0]));
+}
+
+static void benchInteger(BENCH_Inputs* in)
+{
+	char string[24];
+	BENCH_API_LOOP("UTILS_Int2AsciiString", in,
+	               UTILS_Int2AsciiString((int32_t)in->integers[i], string,
+	                                     sizeof(string));
+	               BENCH_KEEP(string[0]));
+	BENCH_API_LOOP("snprintf %d", in,
+	               snprintf(string, sizeof(string), "%" PRId32,
+	                        (int32_t)in->integers[i]);
+	               BENCH_KEEP(string[0]));
+	BENCH_API_LOOP("UTILS_GetNumberOfDigit64", in,
+	               uint8_t digits;
+	               UTILS_GetNumberOfDigit64((int64_t)in->integers64[i], &digits);
+	               BENCH_KEEP(digits));
+}
+
+void BENCH_Api(void)
+{
+	fillInputs(&fixedInputs, 0);
+	fillInputs(&randomInputs, 1);
+	BENCH_Inputs* sets[] = {&fixedInputs, &randomInputs};
+	for(uint32_t set = 0; set < sizeof(sets) / sizeof(sets[0]); set++)
+	{
+		benchBytes(sets[set]);
+		benchHex(sets[set]);
+		benchFloat(sets[set]);
+		benchInteger(sets[set]);
+	}
+}
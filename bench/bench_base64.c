@@ -0,0 +1,142 @@
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "bench.h"
+#include "utils.h"
+
+#define BENCH_BASE64_MAX_SIZE    (16 * 1024 * 1024)
+/* Bytes converted per size, rounds = total / size */
+#define BENCH_BASE64_TOTAL       (64 * 1024 * 1024)
+#define BENCH_BASE64_CHUNK       4096
+
+static uint8_t bytes[BENCH_BASE64_MAX_SIZE];
+static uint8_t decoded[BENCH_BASE64_MAX_SIZE];
+static char base64[UTILS_BASE64_ENCODED_SIZE(BENCH_BASE64_MAX_SIZE) + 1];
+static char hex[2 * BENCH_BASE64_MAX_SIZE + 1];
+
+/* Encoding of MQTT payload which comes in parts of BENCH_BASE64_CHUNK */
+static uint32_t streamEncode(uint32_t size)
+{
+	UTILS_BASE64_STREAM stream;
+	uint32_t length = 0;
+	uint32_t written;
+	UTILS_Base64Init(&stream, UTILS_BASE64_STANDARD);
+	for(uint32_t byte = 0; byte < size; byte += BENCH_BASE64_CHUNK)
+	{
+		uint32_t part = (size - byte < BENCH_BASE64_CHUNK) ?
+		                size - byte : BENCH_BASE64_CHUNK;
+		UTILS_Base64EncodeUpdate(&stream, &bytes[byte], part, &base64[length],
+		                         sizeof(base64) - length, &written);
+		length += written;
+	}
+	UTILS_Base64EncodeFinal(&stream, &base64[length], sizeof(base64) - length,
+	                        &written);
+	return length + written;
+}
+
+static uint32_t streamDecode(uint32_t length)
+{
+	UTILS_BASE64_STREAM stream;
+	uint32_t size = 0;
+	uint32_t written;
+	UTILS_Base64Init(&stream, UTILS_BASE64_STANDARD);
+	for(uint32_t chr = 0; chr < length; chr += BENCH_BASE64_CHUNK)
+	{
+		uint32_t part = (length - chr < BENCH_BASE64_CHUNK) ?
+		                length - chr : BENCH_BASE64_CHUNK;
+		UTILS_Base64DecodeUpdate(&stream, &base64[chr], part, &decoded[size],
+		                         sizeof(decoded) - size, &written);
+		size += written;
+	}
+	UTILS_Base64DecodeFinal(&stream, &decoded[size], sizeof(decoded) - size,
+	                        &written);
+	return size + written;
+}
+
+static void benchSize(uint32_t size)
+{
+	BENCH_Sample sample;
+	char name[64];
+	uint32_t rounds = BENCH_BASE64_TOTAL / size;
+	uint32_t length = UTILS_BASE64_ENCODED_SIZE(size);
+	uint32_t written;
+
+	BENCH_Start(&sample);
+	for(uint32_t round = 0; round < rounds; round++)
+	{
+		UTILS_BytesToHex(bytes, size, hex, sizeof(hex));
+		BENCH_KEEP(hex[0]);
+	}
+	BENCH_Stop(&sample);
+	snprintf(name, sizeof(name), "UTILS_BytesToHex %" PRIu32 " B", size);
+	BENCH_Report(name, &sample, rounds, (uint64_t)rounds * size);
+
+	BENCH_Start(&sample);
+	for(uint32_t round = 0; round < rounds; round++)
+	{
+		UTILS_BytesToBase64(bytes, size, UTILS_BASE64_STANDARD,
+		                    base64, sizeof(base64));
+		BENCH_KEEP(base64[0]);
+	}
+	BENCH_Stop(&sample);
+	snprintf(name, sizeof(name), "UTILS_BytesToBase64 %" PRIu32 " B", size);
+	BENCH_Report(name, &sample, rounds, (uint64_t)rounds * size);
+
+	BENCH_Start(&sample);
+	for(uint32_t round = 0; round < rounds; round++)
+	{
+		BENCH_KEEP(streamEncode(size));
+	}
+	BENCH_Stop(&sample);
+	snprintf(name, sizeof(name), "UTILS_Base64EncodeUpdate %" PRIu32 " B", size);
+	BENCH_Report(name, &sample, rounds, (uint64_t)rounds * size);
+
+	BENCH_Start(&sample);
+	for(uint32_t round = 0; round < rounds; round++)
+	{
+		UTILS_HexToBytes(hex, 2 * size, decoded, sizeof(decoded));
+		BENCH_KEEP(decoded[0]);
+	}
+	BENCH_Stop(&sample);
+	snprintf(name, sizeof(name), "UTILS_HexToBytes %" PRIu32 " B", size);
+	BENCH_Report(name, &sample, rounds, (uint64_t)rounds * size);
+
+	BENCH_Start(&sample);
+	for(uint32_t round = 0; round < rounds; round++)
+	{
+		UTILS_Base64ToBytes(base64, length, UTILS_BASE64_STANDARD,
+		                    decoded, sizeof(decoded), &written);
+		BENCH_KEEP(decoded[0]);
+	}
+	BENCH_Stop(&sample);
+	snprintf(name, sizeof(name), "UTILS_Base64ToBytes %" PRIu32 " B", size);
+	BENCH_Report(name, &sample, rounds, (uint64_t)rounds * size);
+
+	BENCH_Start(&sample);
+	for(uint32_t round = 0; round < rounds; round++)
+	{
+		BENCH_KEEP(streamDecode(length));
+	}
+	BENCH_Stop(&sample);
+	snprintf(name, sizeof(name), "UTILS_Base64DecodeUpdate %" PRIu32 " B", size);
+	BENCH_Report(name, &sample, rounds, (uint64_t)rounds * size);
+
+	if(memcmp(bytes, decoded, size) != 0)
+	{
+		printf("Base64 round trip of %" PRIu32 " B failed\n", size);
+	}
+}
+
+void BENCH_Base64(void)
+{
+	for(uint32_t byte = 0; byte < BENCH_BASE64_MAX_SIZE; byte++)
+	{
+		bytes[byte] = (uint8_t)BENCH_Random();
+	}
+	for(uint32_t size = 64; size <= BENCH_BASE64_MAX_SIZE; size *= 16)
+	{
+		benchSize(size);
+	}
+	benchSize(BENCH_BASE64_MAX_SIZE);
+}
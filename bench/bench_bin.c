@@ -0,0 +1,191 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "bench.h"
+#include "utils.h"
+
+#define BENCH_BIN_VALUES    4096
+#define BENCH_BIN_ROUNDS    100
+#define BENCH_BIN_CHARS     36
+/* "0b" + 32 digits + separator of every value of the array */
+#define BENCH_BIN_WIDTH     35
+
+static uint32_t values[BENCH_BIN_VALUES];
+static char bins[BENCH_BIN_VALUES][BENCH_BIN_CHARS];
+static char octs[BENCH_BIN_VALUES][BENCH_BIN_CHARS];
+static char dump[BENCH_BIN_VALUES * BENCH_BIN_WIDTH];
+
+/* One digit per step, the way without bit expansion */
+static void naiveUint2Bin(uint32_t integer, char* bin)
+{
+	bin[0] = '0';
+	bin[1] = 'b';
+	for(int bit = 0; bit < 32; bit++)
+	{
+		bin[2 + bit] = (char)('0' + ((integer >> (31 - bit)) & 1));
+	}
+	bin[34] = 0x00;
+}
+
+static void benchSingle(void)
+{
+	BENCH_Sample sample;
+	char string[BENCH_BIN_CHARS];
+	const uint64_t ops = (uint64_t)BENCH_BIN_VALUES * BENCH_BIN_ROUNDS;
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_BIN_ROUNDS; round++)
+	{
+		for(int i = 0; i < BENCH_BIN_VALUES; i++)
+		{
+			UTILS_Uint2Bin(values[i], string, sizeof(string));
+			BENCH_KEEP(string[0]);
+		}
+	}
+	BENCH_Stop(&sample);
+	BENCH_Report("UTILS_Uint2Bin", &sample, ops, 0);
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_BIN_ROUNDS; round++)
+	{
+		for(int i = 0; i < BENCH_BIN_VALUES; i++)
+		{
+			naiveUint2Bin(values[i], string);
+			BENCH_KEEP(string[0]);
+		}
+	}
+	BENCH_Stop(&sample);
+	BENCH_Report("bit by bit Uint2Bin (32 digits)", &sample, ops, 0);
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_BIN_ROUNDS; round++)
+	{
+		for(int i = 0; i < BENCH_BIN_VALUES; i++)
+		{
+			uint32_t integer;
+			UTILS_Bin2Uint(bins[i], &integer);
+			BENCH_KEEP(integer);
+		}
+	}
+	BENCH_Stop(&sample);
+	BENCH_Report("UTILS_Bin2Uint", &sample, ops, 0);
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_BIN_ROUNDS; round++)
+	{
+		for(int i = 0; i < BENCH_BIN_VALUES; i++)
+		{
+			uint32_t integer = (uint32_t)strtoul(&bins[i][2], NULL, 2);
+			BENCH_KEEP(integer);
+		}
+	}
+	BENCH_Stop(&sample);
+	BENCH_Report("strtoul base 2", &sample, ops, 0);
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_BIN_ROUNDS; round++)
+	{
+		for(int i = 0; i < BENCH_BIN_VALUES; i++)
+		{
+			UTILS_Uint2Oct(values[i], string, sizeof(string));
+			BENCH_KEEP(string[0]);
+		}
+	}
+	BENCH_Stop(&sample);
+	BENCH_Report("UTILS_Uint2Oct", &sample, ops, 0);
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_BIN_ROUNDS; round++)
+	{
+		for(int i = 0; i < BENCH_BIN_VALUES; i++)
+		{
+			snprintf(string, sizeof(string), "0o%" PRIo32, values[i]);
+			BENCH_KEEP(string[0]);
+		}
+	}
+	BENCH_Stop(&sample);
+	BENCH_Report("snprintf %o", &sample, ops, 0);
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_BIN_ROUNDS; round++)
+	{
+		for(int i = 0; i < BENCH_BIN_VALUES; i++)
+		{
+			uint32_t integer;
+			UTILS_Oct2Uint(octs[i], &integer);
+			BENCH_KEEP(integer);
+		}
+	}
+	BENCH_Stop(&sample);
+	BENCH_Report("UTILS_Oct2Uint", &sample, ops, 0);
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_BIN_ROUNDS; round++)
+	{
+		for(int i = 0; i < BENCH_BIN_VALUES; i++)
+		{
+			uint32_t integer = (uint32_t)strtoul(&octs[i][2], NULL, 8);
+			BENCH_KEEP(integer);
+		}
+	}
+	BENCH_Stop(&sample);
+	BENCH_Report("strtoul base 8", &sample, ops, 0);
+}
+
+/* Dump of the whole register file at once */
+static void benchArray(void)
+{
+	BENCH_Sample sample;
+	uint32_t written = 0;
+	const uint64_t ops = (uint64_t)BENCH_BIN_VALUES * BENCH_BIN_ROUNDS;
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_BIN_ROUNDS; round++)
+	{
+		UTILS_Uint32ArrayToBin(values, BENCH_BIN_VALUES, ' ', dump,
+		                       sizeof(dump), &written);
+		BENCH_KEEP(dump[0]);
+	}
+	BENCH_Stop(&sample);
+	BENCH_Report("UTILS_Uint32ArrayToBin", &sample, ops,
+	             (uint64_t)written * BENCH_BIN_ROUNDS);
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_BIN_ROUNDS; round++)
+	{
+		for(int i = 0; i < BENCH_BIN_VALUES; i++)
+		{
+			naiveUint2Bin(values[i], &dump[i * BENCH_BIN_WIDTH]);
+			dump[i * BENCH_BIN_WIDTH + BENCH_BIN_WIDTH - 1] = ' ';
+		}
+		BENCH_KEEP(dump[0]);
+	}
+	BENCH_Stop(&sample);
+	BENCH_Report("bit by bit array to bin", &sample, ops,
+	             (uint64_t)written * BENCH_BIN_ROUNDS);
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_BIN_ROUNDS; round++)
+	{
+		UTILS_Uint32ArrayToOct(values, BENCH_BIN_VALUES, ' ', dump,
+		                       sizeof(dump), &written);
+		BENCH_KEEP(dump[0]);
+	}
+	BENCH_Stop(&sample);
+	BENCH_Report("UTILS_Uint32ArrayToOct", &sample, ops,
+	             (uint64_t)written * BENCH_BIN_ROUNDS);
+}
+
+void BENCH_Bin(void)
+{
+	for(int i = 0; i < BENCH_BIN_VALUES; i++)
+	{
+		values[i] = BENCH_Random();
+		UTILS_Uint2Bin(values[i], bins[i], BENCH_BIN_CHARS);
+		UTILS_Uint2Oct(values[i], octs[i], BENCH_BIN_CHARS);
+	}
+	benchSingle();
+	benchArray();
+}
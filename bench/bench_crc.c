@@ -0,0 +1,78 @@
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "bench.h"
+#include "utils.h"
+
+#define BENCH_CRC_MAX_SIZE    (64 * 1024)
+#define BENCH_CRC_BYTES       (64 * 1024 * 1024)
+
+static uint8_t bytes[BENCH_CRC_MAX_SIZE];
+static uint32_t table[UTILS_CRC_SLICING8_TABLE_SIZE];
+
+typedef struct
+{
+	const char* name;
+	UTILS_CRC_MODEL model;
+}BENCH_CrcModel;
+
+static const BENCH_CrcModel models[] =
+{
+	{"CRC-8", UTILS_CRC8_MODEL},
+	{"CRC-16/CCITT", UTILS_CRC16_CCITT_MODEL},
+	{"CRC-32", UTILS_CRC32_MODEL},
+};
+
+static const char* engines[] = {"bitwise", "nibble", "slicing-by-8", "clmul"};
+
+/* Frame of 'size' bytes as it streams in, in parts of 'part' bytes */
+static void benchEngine(const BENCH_CrcModel* model, UTILS_CRC_ENGINE engine,
+                        uint32_t size, uint32_t part)
+{
+	BENCH_Sample sample;
+	UTILS_CRC crc;
+	char name[64];
+	uint32_t value;
+	/* The bitwise engine is an order of magnitude slower */
+	uint32_t rounds = (engine == UTILS_CRC_BITWISE ? BENCH_CRC_BYTES / 16 :
+	                   BENCH_CRC_BYTES) / size;
+	UTILS_CrcInit(&crc, &model->model, engine, table,
+	              UTILS_CRC_SLICING8_TABLE_SIZE);
+
+	BENCH_Start(&sample);
+	for(uint32_t round = 0; round < rounds; round++)
+	{
+		UTILS_CrcReset(&crc);
+		for(uint32_t pos = 0; pos < size; pos += part)
+		{
+			UTILS_CrcUpdate(&crc, &bytes[pos], size - pos < part ? size - pos : part);
+		}
+		UTILS_CrcFinal(&crc, &value);
+		BENCH_KEEP(value);
+	}
+	BENCH_Stop(&sample);
+	snprintf(name, sizeof(name), "UTILS_Crc %s %s %" PRIu32 "/%" PRIu32 " B",
+	         model->name, engines[engine], size, part);
+	BENCH_Report(name, &sample, rounds, (uint64_t)rounds * size);
+}
+
+void BENCH_Crc(void)
+{
+	for(uint32_t byte = 0; byte < BENCH_CRC_MAX_SIZE; byte++)
+	{
+		bytes[byte] = (uint8_t)BENCH_Random();
+	}
+	for(uint32_t model = 0; model < sizeof(models) / sizeof(models[0]); model++)
+	{
+		for(uint32_t engine = UTILS_CRC_BITWISE; engine <= UTILS_CRC_CLMUL; engine++)
+		{
+			benchEngine(&models[model], engine, 64, 64);
+			benchEngine(&models[model], engine, 1500, 1500);
+			benchEngine(&models[model], engine, BENCH_CRC_MAX_SIZE,
+			            BENCH_CRC_MAX_SIZE);
+		}
+		/* Frame received in small parts */
+		benchEngine(&models[model], UTILS_CRC_CLMUL, 1500, 100);
+	}
+}
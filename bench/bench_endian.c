@@ -0,0 +1,133 @@
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "bench.h"
+#include "utils.h"
+
+#define BENCH_ENDIAN_MAX_SIZE    (1024 * 1024)
+
+static uint32_t values[BENCH_ENDIAN_MAX_SIZE / sizeof(uint32_t)];
+static uint8_t bytes[BENCH_ENDIAN_MAX_SIZE];
+
+/* Serialization built so far: one UTILS_Uint2ByteArray call per value */
+static void perElementLoop(uint32_t size)
+{
+	for(uint32_t byte = 0; byte + 4 <= size; byte += 4)
+	{
+		UTILS_Uint2ByteArray(values[byte / 4], &bytes[byte]);
+	}
+}
+
+static void benchSize(uint32_t size)
+{
+	BENCH_Sample sample;
+	char name[64];
+	uint32_t rounds = BENCH_ENDIAN_MAX_SIZE * 16 / size;
+	uint64_t total = (uint64_t)rounds * size;
+
+	BENCH_Start(&sample);
+	for(uint32_t round = 0; round < rounds; round++)
+	{
+		perElementLoop(size);
+		BENCH_KEEP(bytes[0]);
+	}
+	BENCH_Stop(&sample);
+	snprintf(name, sizeof(name), "UTILS_Uint2ByteArray loop %" PRIu32 " B",
+	         size);
+	BENCH_Report(name, &sample, rounds, total);
+
+	BENCH_Start(&sample);
+	for(uint32_t round = 0; round < rounds; round++)
+	{
+		UTILS_Uint32ArrayToBytes(values, size / 4, UTILS_LITTLE_ENDIAN,
+		                         bytes, sizeof(bytes));
+		BENCH_KEEP(bytes[0]);
+	}
+	BENCH_Stop(&sample);
+	snprintf(name, sizeof(name), "UTILS_Uint32ArrayToBytes LE %" PRIu32 " B",
+	         size);
+	BENCH_Report(name, &sample, rounds, total);
+}
+
+/* Every width to big endian, back and swapped in place */
+static void benchWidths(uint32_t size)
+{
+	static const uint8_t widths[] = {2, 4, 8};
+	BENCH_Sample sample;
+	char name[64];
+	uint32_t rounds = BENCH_ENDIAN_MAX_SIZE * 16 / size;
+	uint64_t total = (uint64_t)rounds * size;
+
+	for(uint32_t width = 0; width < sizeof(widths); width++)
+	{
+		uint32_t bits = widths[width] * 8;
+		uint32_t count = size / widths[width];
+
+		BENCH_Start(&sample);
+		for(uint32_t round = 0; round < rounds; round++)
+		{
+			if(bits == 16)
+				UTILS_Uint16ArrayToBytes((uint16_t*)values, count,
+				                         UTILS_BIG_ENDIAN, bytes, size);
+			else if(bits == 32)
+				UTILS_Uint32ArrayToBytes(values, count,
+				                         UTILS_BIG_ENDIAN, bytes, size);
+			else
+				UTILS_Uint64ArrayToBytes((uint64_t*)values, count,
+				                         UTILS_BIG_ENDIAN, bytes, size);
+			BENCH_KEEP(bytes[0]);
+		}
+		BENCH_Stop(&sample);
+		snprintf(name, sizeof(name), "UTILS_Uint%" PRIu32 "ArrayToBytes BE "
+		         "%" PRIu32 " B", bits, size);
+		BENCH_Report(name, &sample, rounds, total);
+
+		BENCH_Start(&sample);
+		for(uint32_t round = 0; round < rounds; round++)
+		{
+			if(bits == 16)
+				UTILS_BytesToUint16Array(bytes, size, UTILS_BIG_ENDIAN,
+				                         (uint16_t*)values, count);
+			else if(bits == 32)
+				UTILS_BytesToUint32Array(bytes, size, UTILS_BIG_ENDIAN,
+				                         values, count);
+			else
+				UTILS_BytesToUint64Array(bytes, size, UTILS_BIG_ENDIAN,
+				                         (uint64_t*)values, count);
+			BENCH_KEEP(values[0]);
+		}
+		BENCH_Stop(&sample);
+		snprintf(name, sizeof(name), "UTILS_BytesToUint%" PRIu32 "Array BE "
+		         "%" PRIu32 " B", bits, size);
+		BENCH_Report(name, &sample, rounds, total);
+
+		BENCH_Start(&sample);
+		for(uint32_t round = 0; round < rounds; round++)
+		{
+			if(bits == 16)
+				UTILS_SwapBytes16((uint16_t*)values, count);
+			else if(bits == 32)
+				UTILS_SwapBytes32(values, count);
+			else
+				UTILS_SwapBytes64((uint64_t*)values, count);
+			BENCH_KEEP(values[0]);
+		}
+		BENCH_Stop(&sample);
+		snprintf(name, sizeof(name), "UTILS_SwapBytes%" PRIu32 " %" PRIu32 " B",
+		         bits, size);
+		BENCH_Report(name, &sample, rounds, total);
+	}
+}
+
+void BENCH_Endian(void)
+{
+	for(uint32_t value = 0; value < sizeof(values) / sizeof(values[0]); value++)
+	{
+		values[value] = BENCH_Random();
+	}
+	benchSize(4096);
+	benchWidths(4096);
+	benchSize(BENCH_ENDIAN_MAX_SIZE);
+	benchWidths(BENCH_ENDIAN_MAX_SIZE);
+}
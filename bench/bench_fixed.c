@@ -0,0 +1,117 @@
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <inttypes.h>
+
+#include "bench.h"
+#include "utils.h"
+
+#define BENCH_FIXED_VALUES    4096
+#define BENCH_FIXED_ROUNDS    100
+#define BENCH_FIXED_CHARS     24
+
+static int32_t values[BENCH_FIXED_VALUES];
+static char strings[BENCH_FIXED_VALUES][BENCH_FIXED_CHARS];
+
+/* Random values of the whole range of the format with its strings */
+static void fillValues(uint16_t format, uint8_t decimals)
+{
+	uint32_t width = format >> 8;
+	for(int i = 0; i < BENCH_FIXED_VALUES; i++)
+	{
+		uint32_t random = BENCH_Random();
+		values[i] = (int32_t)(random << (32 - width)) >> (32 - width);
+		UTILS_Fixed2AsciiString(values[i], format, decimals, strings[i],
+		                        BENCH_FIXED_CHARS);
+	}
+}
+
+static void benchFormat(const char* name, uint16_t format, uint8_t decimals)
+{
+	BENCH_Sample sample;
+	char report[64];
+	char string[UTILS_FLOAT_STRING_MAX_SIZE];
+	const uint64_t ops = (uint64_t)BENCH_FIXED_VALUES * BENCH_FIXED_ROUNDS;
+	const float scale = 1.0f / (float)((uint64_t)1 << (format & 0xFF));
+	fillValues(format, decimals);
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_FIXED_ROUNDS; round++)
+	{
+		for(int i = 0; i < BENCH_FIXED_VALUES; i++)
+		{
+			UTILS_Fixed2AsciiString(values[i], format, decimals, string,
+			                        sizeof(string));
+			BENCH_KEEP(string[0]);
+		}
+	}
+	BENCH_Stop(&sample);
+	snprintf(report, sizeof(report), "UTILS_Fixed2AsciiString %s", name);
+	BENCH_Report(report, &sample, ops, 0);
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_FIXED_ROUNDS; round++)
+	{
+		for(int i = 0; i < BENCH_FIXED_VALUES; i++)
+		{
+			UTILS_Float2AsciiShortest((float)values[i] * scale, UTILS_FLOAT_FIXED,
+			                          string, sizeof(string));
+			BENCH_KEEP(string[0]);
+		}
+	}
+	BENCH_Stop(&sample);
+	snprintf(report, sizeof(report), "float + UTILS_Float2AsciiShortest %s", name);
+	BENCH_Report(report, &sample, ops, 0);
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_FIXED_ROUNDS; round++)
+	{
+		for(int i = 0; i < BENCH_FIXED_VALUES; i++)
+		{
+			snprintf(string, sizeof(string), "%.*f", decimals,
+			         (double)values[i] * scale);
+			BENCH_KEEP(string[0]);
+		}
+	}
+	BENCH_Stop(&sample);
+	snprintf(report, sizeof(report), "float + snprintf %s", name);
+	BENCH_Report(report, &sample, ops, 0);
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_FIXED_ROUNDS; round++)
+	{
+		for(int i = 0; i < BENCH_FIXED_VALUES; i++)
+		{
+			int32_t value;
+			uint32_t consumed;
+			UTILS_AsciiString2Fixed(strings[i], BENCH_FIXED_CHARS, format,
+			                        &value, &consumed);
+			BENCH_KEEP(value);
+		}
+	}
+	BENCH_Stop(&sample);
+	snprintf(report, sizeof(report), "UTILS_AsciiString2Fixed %s", name);
+	BENCH_Report(report, &sample, ops, 0);
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_FIXED_ROUNDS; round++)
+	{
+		for(int i = 0; i < BENCH_FIXED_VALUES; i++)
+		{
+			float fp;
+			uint32_t consumed;
+			UTILS_AsciiString2Float(strings[i], BENCH_FIXED_CHARS, &fp, &consumed);
+			BENCH_KEEP((int32_t)lrintf(fp / scale));
+		}
+	}
+	BENCH_Stop(&sample);
+	snprintf(report, sizeof(report), "UTILS_AsciiString2Float + lrintf %s", name);
+	BENCH_Report(report, &sample, ops, 0);
+}
+
+void BENCH_Fixed(void)
+{
+	benchFormat("Q15", UTILS_Q15, 5);
+	benchFormat("Q31", UTILS_Q31, 9);
+	benchFormat("Q16.16", UTILS_Q16_16, 4);
+}
@@ -0,0 +1,112 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "bench.h"
+#include "utils.h"
+
+#define BENCH_FLOAT_VALUES    4096
+#define BENCH_FLOAT_ROUNDS    100
+
+#define BENCH_FLOAT_CHARS     16
+
+static float values[BENCH_FLOAT_VALUES];
+static char strings[BENCH_FLOAT_VALUES][BENCH_FLOAT_CHARS];
+
+/* Telemetry-like values: a few integer digits and a random fraction */
+static void fillValues(void)
+{
+	for(int i = 0; i < BENCH_FLOAT_VALUES; i++)
+	{
+		float value = (float)(BENCH_Random() % 100000) / 100.0f;
+		values[i] = (BENCH_Random() & 1) ? -value : value;
+		snprintf(strings[i], BENCH_FLOAT_CHARS, "%.*f",
+		         (int)(BENCH_Random() % 4), values[i]);
+	}
+}
+
+void BENCH_Float(void)
+{
+	BENCH_Sample sample;
+	char string[UTILS_FLOAT_STRING_MAX_SIZE];
+	const uint64_t ops = (uint64_t)BENCH_FLOAT_VALUES * BENCH_FLOAT_ROUNDS;
+
+	fillValues();
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_FLOAT_ROUNDS; round++)
+	{
+		for(int i = 0; i < BENCH_FLOAT_VALUES; i++)
+		{
+			UTILS_Float2AsciiString(values[i], string, sizeof(string));
+			BENCH_KEEP(string[0]);
+		}
+	}
+	BENCH_Stop(&sample);
+	BENCH_Report("UTILS_Float2AsciiString", &sample, ops, 0);
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_FLOAT_ROUNDS; round++)
+	{
+		for(int i = 0; i < BENCH_FLOAT_VALUES; i++)
+		{
+			UTILS_Float2AsciiShortest(values[i], UTILS_FLOAT_FIXED, string,
+			                          sizeof(string));
+			BENCH_KEEP(string[0]);
+		}
+	}
+	BENCH_Stop(&sample);
+	BENCH_Report("UTILS_Float2AsciiShortest fixed", &sample, ops, 0);
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_FLOAT_ROUNDS; round++)
+	{
+		for(int i = 0; i < BENCH_FLOAT_VALUES; i++)
+		{
+			UTILS_Float2AsciiShortest(values[i], UTILS_FLOAT_SCIENTIFIC, string,
+			                          sizeof(string));
+			BENCH_KEEP(string[0]);
+		}
+	}
+	BENCH_Stop(&sample);
+	BENCH_Report("UTILS_Float2AsciiShortest scientific", &sample, ops, 0);
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_FLOAT_ROUNDS; round++)
+	{
+		for(int i = 0; i < BENCH_FLOAT_VALUES; i++)
+		{
+			snprintf(string, sizeof(string), "%.9g", values[i]);
+			BENCH_KEEP(string[0]);
+		}
+	}
+	BENCH_Stop(&sample);
+	BENCH_Report("snprintf %.9g", &sample, ops, 0);
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_FLOAT_ROUNDS; round++)
+	{
+		for(int i = 0; i < BENCH_FLOAT_VALUES; i++)
+		{
+			float fp;
+			uint32_t consumed;
+			UTILS_AsciiString2Float(strings[i], BENCH_FLOAT_CHARS, &fp, &consumed);
+			BENCH_KEEP(fp);
+		}
+	}
+	BENCH_Stop(&sample);
+	BENCH_Report("UTILS_AsciiString2Float", &sample, ops, 0);
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_FLOAT_ROUNDS; round++)
+	{
+		for(int i = 0; i < BENCH_FLOAT_VALUES; i++)
+		{
+			float fp = strtof(strings[i], NULL);
+			BENCH_KEEP(fp);
+		}
+	}
+	BENCH_Stop(&sample);
+	BENCH_Report("strtof", &sample, ops, 0);
+}
@@ -0,0 +1,122 @@
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "bench.h"
+#include "utils.h"
+
+#define BENCH_HALF_VALUES     4096
+#define BENCH_HALF_ROUNDS     2000
+
+static float values[BENCH_HALF_VALUES];
+static float converted[BENCH_HALF_VALUES];
+static uint16_t halves[BENCH_HALF_VALUES];
+
+/* Sensor-like values: a few integer digits and a random fraction */
+static void fillValues(void)
+{
+	for(int i = 0; i < BENCH_HALF_VALUES; i++)
+	{
+		float value = (float)(BENCH_Random() % 100000) / 100.0f;
+		values[i] = (BENCH_Random() & 1) ? -value : value;
+	}
+}
+
+static void report(const char* name, const BENCH_Sample* sample)
+{
+	const uint64_t ops = (uint64_t)BENCH_HALF_VALUES * BENCH_HALF_ROUNDS;
+	/* Throughput of the float side */
+	BENCH_Report(name, sample, ops, ops * sizeof(float));
+}
+
+static void benchNarrow(const char* name,
+                        UTILS_ERROR (*convert)(const float*, uint32_t, uint16_t*))
+{
+	BENCH_Sample sample;
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_HALF_ROUNDS; round++)
+	{
+		convert(values, BENCH_HALF_VALUES, halves);
+		BENCH_KEEP(halves[round % BENCH_HALF_VALUES]);
+	}
+	BENCH_Stop(&sample);
+	report(name, &sample);
+}
+
+static void benchWiden(const char* name,
+                       UTILS_ERROR (*convert)(const uint16_t*, uint32_t, float*))
+{
+	BENCH_Sample sample;
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_HALF_ROUNDS; round++)
+	{
+		convert(halves, BENCH_HALF_VALUES, converted);
+		BENCH_KEEP(converted[round % BENCH_HALF_VALUES]);
+	}
+	BENCH_Stop(&sample);
+	report(name, &sample);
+}
+
+/* The usual bfloat16 conversion which drops the low half without rounding */
+static void benchTruncate(void)
+{
+	BENCH_Sample sample;
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_HALF_ROUNDS; round++)
+	{
+		for(int i = 0; i < BENCH_HALF_VALUES; i++)
+		{
+			uint32_t bits;
+			memcpy(&bits, &values[i], sizeof(bits));
+			halves[i] = (uint16_t)(bits >> 16);
+		}
+		BENCH_KEEP(halves[round % BENCH_HALF_VALUES]);
+	}
+	BENCH_Stop(&sample);
+	report("truncating float to bfloat16 loop", &sample);
+}
+
+#ifdef __FLT16_MAX__
+/* Conversions of the compiler, a library call per value without F16C */
+static void benchFloat16(void)
+{
+	static _Float16 float16s[BENCH_HALF_VALUES];
+	BENCH_Sample sample;
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_HALF_ROUNDS; round++)
+	{
+		for(int i = 0; i < BENCH_HALF_VALUES; i++)
+		{
+			float16s[i] = (_Float16)values[i];
+		}
+		BENCH_KEEP(float16s[round % BENCH_HALF_VALUES]);
+	}
+	BENCH_Stop(&sample);
+	report("_Float16 cast float to half", &sample);
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_HALF_ROUNDS; round++)
+	{
+		for(int i = 0; i < BENCH_HALF_VALUES; i++)
+		{
+			converted[i] = (float)float16s[i];
+		}
+		BENCH_KEEP(converted[round % BENCH_HALF_VALUES]);
+	}
+	BENCH_Stop(&sample);
+	report("_Float16 cast half to float", &sample);
+}
+#endif
+
+void BENCH_Half(void)
+{
+	fillValues();
+	benchNarrow("UTILS_FloatArrayToHalf", UTILS_FloatArrayToHalf);
+	benchWiden("UTILS_HalfToFloatArray", UTILS_HalfToFloatArray);
+#ifdef __FLT16_MAX__
+	benchFloat16();
+#endif
+	benchNarrow("UTILS_FloatArrayToBfloat16", UTILS_FloatArrayToBfloat16);
+	benchWiden("UTILS_Bfloat16ToFloatArray", UTILS_Bfloat16ToFloatArray);
+	benchTruncate();
+}
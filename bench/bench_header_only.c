@@ -0,0 +1,8 @@
+#define UTILS_HEADER_ONLY
+
+#include "bench.h"
+#include "utils.h"
+
+#define BENCH_LOOP(name)    BENCH_Inline##name
+
+#include "bench_inline_loops.h"
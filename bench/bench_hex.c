@@ -0,0 +1,189 @@
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "bench.h"
+#include "utils.h"
+
+#define BENCH_HEX_MAX_SIZE    (1024 * 1024)
+
+static uint8_t bytes[BENCH_HEX_MAX_SIZE];
+static char hex[2 * BENCH_HEX_MAX_SIZE + 1];
+#define BENCH_HEX_DUMP_ROUNDS (1024 * 1024)
+
+/* 81 characters per line of 16 bytes in groups of 4, the longest of the
+ * layouts below (79 in the default one) */
+static char dump[BENCH_HEX_MAX_SIZE / 16 * 81 + 1];
+
+/* Groups of 4 bytes are formatted by the scalar code only, lines of 20
+ * bytes without groups take the SSSE3 kernel for 16 bytes and the scalar
+ * tail for 4 */
+static const UTILS_HEXDUMP_OPTIONS groupsOf4 = {16, 4, 8, 1};
+static const UTILS_HEXDUMP_OPTIONS linesOf20 = {20, 0, 8, 1};
+
+/* Hex dump built so far: one UTILS_Uint2Hex call per 32-bit word */
+static void perWordEncode(uint32_t size)
+{
+	char word[11];
+	for(uint32_t byte = 0; byte + 4 <= size; byte += 4)
+	{
+		uint32_t integer;
+		UTILS_ByteArray2Uint(&bytes[byte], &integer);
+		UTILS_Uint2Hex(integer, word, sizeof(word));
+		memcpy(&hex[2 * byte], &word[2], 8);
+	}
+}
+
+/* Hex parsing built so far: one UTILS_Hex2Uint call per 8 characters */
+static void perWordDecode(uint32_t size)
+{
+	char word[9] = {0};
+	for(uint32_t byte = 0; byte + 4 <= size; byte += 4)
+	{
+		uint32_t integer;
+		memcpy(word, &hex[2 * byte], 8);
+		UTILS_Hex2Uint(word, &integer);
+		UTILS_Uint2ByteArray(integer, &bytes[byte]);
+	}
+}
+
+static void benchSize(uint32_t size)
+{
+	BENCH_Sample sample;
+	char name[64];
+	uint32_t rounds = BENCH_HEX_MAX_SIZE * 16 / size;
+
+	BENCH_Start(&sample);
+	for(uint32_t round = 0; round < rounds; round++)
+	{
+		perWordEncode(size);
+		BENCH_KEEP(hex[0]);
+	}
+	BENCH_Stop(&sample);
+	snprintf(name, sizeof(name), "UTILS_Uint2Hex per-word %" PRIu32 " B", size);
+	BENCH_Report(name, &sample, rounds, (uint64_t)rounds * size);
+
+	BENCH_Start(&sample);
+	for(uint32_t round = 0; round < rounds; round++)
+	{
+		UTILS_BytesToHex(bytes, size, hex, sizeof(hex));
+		BENCH_KEEP(hex[0]);
+	}
+	BENCH_Stop(&sample);
+	snprintf(name, sizeof(name), "UTILS_BytesToHex %" PRIu32 " B", size);
+	BENCH_Report(name, &sample, rounds, (uint64_t)rounds * size);
+
+	BENCH_Start(&sample);
+	for(uint32_t round = 0; round < rounds; round++)
+	{
+		perWordDecode(size);
+		BENCH_KEEP(bytes[0]);
+	}
+	BENCH_Stop(&sample);
+	snprintf(name, sizeof(name), "UTILS_Hex2Uint per-word %" PRIu32 " B", size);
+	BENCH_Report(name, &sample, rounds, (uint64_t)rounds * size);
+
+	BENCH_Start(&sample);
+	for(uint32_t round = 0; round < rounds; round++)
+	{
+		UTILS_HexToBytes(hex, 2 * size, bytes, sizeof(bytes));
+		BENCH_KEEP(bytes[0]);
+	}
+	BENCH_Stop(&sample);
+	snprintf(name, sizeof(name), "UTILS_HexToBytes %" PRIu32 " B", size);
+	BENCH_Report(name, &sample, rounds, (uint64_t)rounds * size);
+}
+
+/* Hex dump built so far: one UTILS_Uint2Hex call per byte and snprintf */
+static uint32_t perByteDump(uint32_t size)
+{
+	char word[5];
+	uint32_t length = 0;
+	for(uint32_t line = 0; line < size; line += 16)
+	{
+		length += snprintf(&dump[length], sizeof(dump) - length, "%08" PRIX32 " ", line);
+		for(uint32_t byte = line; byte < line + 16 && byte < size; byte++)
+		{
+			UTILS_Uint2Hex(bytes[byte], word, sizeof(word));
+			dump[length++] = ' ';
+			dump[length++] = (word[3] == 0x00) ? '0' : word[2];
+			dump[length++] = (word[3] == 0x00) ? word[2] : word[3];
+		}
+		dump[length++] = '\n';
+	}
+	return length;
+}
+
+static void benchDump(uint32_t size)
+{
+	BENCH_Sample sample;
+	char name[64];
+	uint32_t rounds = BENCH_HEX_MAX_SIZE * 4 / size;
+
+	BENCH_Start(&sample);
+	for(uint32_t round = 0; round < rounds; round++)
+	{
+		BENCH_KEEP(perByteDump(size));
+	}
+	BENCH_Stop(&sample);
+	snprintf(name, sizeof(name), "UTILS_Uint2Hex per-byte dump %" PRIu32 " B", size);
+	BENCH_Report(name, &sample, rounds, (uint64_t)rounds * size);
+
+	BENCH_Start(&sample);
+	for(uint32_t round = 0; round < rounds; round++)
+	{
+		UTILS_HexDump(bytes, size, dump, sizeof(dump), NULL);
+		BENCH_KEEP(dump[0]);
+	}
+	BENCH_Stop(&sample);
+	snprintf(name, sizeof(name), "UTILS_HexDump %" PRIu32 " B", size);
+	BENCH_Report(name, &sample, rounds, (uint64_t)rounds * size);
+
+	BENCH_Start(&sample);
+	for(uint32_t round = 0; round < rounds; round++)
+	{
+		UTILS_HexDump(bytes, size, dump, sizeof(dump), &groupsOf4);
+		BENCH_KEEP(dump[0]);
+	}
+	BENCH_Stop(&sample);
+	snprintf(name, sizeof(name), "UTILS_HexDump groups of 4 %" PRIu32 " B", size);
+	BENCH_Report(name, &sample, rounds, (uint64_t)rounds * size);
+
+	BENCH_Start(&sample);
+	for(uint32_t round = 0; round < rounds; round++)
+	{
+		UTILS_HexDump(bytes, size, dump, sizeof(dump), &linesOf20);
+		BENCH_KEEP(dump[0]);
+	}
+	BENCH_Stop(&sample);
+	snprintf(name, sizeof(name), "UTILS_HexDump lines of 20 %" PRIu32 " B", size);
+	BENCH_Report(name, &sample, rounds, (uint64_t)rounds * size);
+}
+
+static void benchDumpSize(void)
+{
+	BENCH_Sample sample;
+	uint32_t length = 0;
+
+	BENCH_Start(&sample);
+	for(uint32_t round = 0; round < BENCH_HEX_DUMP_ROUNDS; round++)
+	{
+		UTILS_HexDumpSize(round, &linesOf20, &length);
+		BENCH_KEEP(length);
+	}
+	BENCH_Stop(&sample);
+	BENCH_Report("UTILS_HexDumpSize", &sample, BENCH_HEX_DUMP_ROUNDS, 0);
+}
+
+void BENCH_Hex(void)
+{
+	for(uint32_t byte = 0; byte < BENCH_HEX_MAX_SIZE; byte++)
+	{
+		bytes[byte] = (uint8_t)BENCH_Random();
+	}
+	benchSize(4096);
+	benchSize(BENCH_HEX_MAX_SIZE);
+	benchDump(1500);
+	benchDump(BENCH_HEX_MAX_SIZE);
+	benchDumpSize();
+}
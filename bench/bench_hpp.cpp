@@ -0,0 +1,136 @@
+#include <cstdio>
+#include <cstring>
+#include <charconv>
+
+#include "bench.h"
+#include "utils.hpp"
+
+#define BENCH_HPP_VALUES    4096
+#define BENCH_HPP_ROUNDS    200
+#define BENCH_HPP_CHARS     24
+
+/* Every assertion below is evaluated by the compiler, so the templates
+ * really run at compile time */
+static constexpr bool sameString(const char* first, const char* second)
+{
+	for(; *first != '\0' && *first == *second; first++, second++);
+	return *first == *second;
+}
+
+static_assert(sameString(utils::to_string<0>().c_str(), "0"));
+static_assert(sameString(utils::to_string<1234567890>().c_str(), "1234567890"));
+static_assert(sameString(utils::to_string<INT32_MIN>().c_str(), "-2147483648"));
+static_assert(sameString(utils::to_string<INT64_MIN>().c_str(),
+                         "-9223372036854775808"));
+static_assert(sameString(utils::to_string<UINT64_MAX>().c_str(),
+                         "18446744073709551615"));
+static_assert(sameString(utils::to_string<0xBEEFu, 16>().c_str(), "BEEF"));
+static_assert(sameString(utils::to_string<0x5Au, 2>().c_str(), "1011010"));
+static_assert(sameString(utils::to_string<-0777, 8>().c_str(), "-777"));
+static_assert(utils::to_string<99999u>().size() == 5);
+static_assert(utils::to_string<-100>().size() == 4);
+
+static constexpr char decimal[] = "-2147483648,";
+static_assert(utils::from_chars<int32_t>(decimal, decimal + 11).ok);
+static_assert(utils::from_chars<int32_t>(decimal, decimal + 11).value == INT32_MIN);
+static_assert(utils::from_chars<int32_t>(decimal, decimal + 12).ptr == decimal + 11);
+static_assert(!utils::from_chars<int16_t>(decimal, decimal + 11).ok);
+static_assert(!utils::from_chars<uint32_t>(decimal, decimal + 11).ok);
+
+static constexpr char hex[] = "0xAbC10Fd";
+static_assert(utils::from_chars<uint32_t, 16>(hex, hex + 9).value == 0xABC10FDu);
+static_assert(utils::from_chars<uint64_t, 16>(hex + 1, hex + 9).value == 0xABC10FDu);
+static_assert(!utils::from_chars<uint16_t, 16>(hex, hex + 9).ok);
+static_assert(!utils::from_chars<uint8_t>(hex + 9, hex + 9).ok);
+
+static uint32_t values32[BENCH_HPP_VALUES];
+static int64_t values64[BENCH_HPP_VALUES];
+static char strings[BENCH_HPP_VALUES][BENCH_HPP_CHARS];
+
+/* Uniformly distributed number of digits */
+static void fillValues()
+{
+	for(int i = 0; i < BENCH_HPP_VALUES; i++)
+	{
+		uint64_t value = (static_cast<uint64_t>(BENCH_Random()) << 32) |
+		                 BENCH_Random();
+		values32[i] = static_cast<uint32_t>(value >> (32 + BENCH_Random() % 32));
+		value >>= BENCH_Random() % 64;
+		values64[i] = (BENCH_Random() & 1) ? -static_cast<int64_t>(value >> 1) :
+		                                     static_cast<int64_t>(value >> 1);
+	}
+}
+
+template <typename Loop>
+static void benchLoop(const char* name, Loop loop)
+{
+	BENCH_Sample sample;
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_HPP_ROUNDS; round++)
+	{
+		for(int i = 0; i < BENCH_HPP_VALUES; i++)
+		{
+			loop(i);
+		}
+	}
+	BENCH_Stop(&sample);
+	BENCH_Report(name, &sample,
+	             static_cast<uint64_t>(BENCH_HPP_VALUES) * BENCH_HPP_ROUNDS, 0);
+}
+
+extern "C" void BENCH_Hpp(void)
+{
+	char string[BENCH_HPP_CHARS];
+	fillValues();
+
+	benchLoop("utils::to_chars<uint32_t>", [&](int i)
+	{
+		char* end = utils::to_chars(string, string + sizeof(string), values32[i]);
+		BENCH_KEEP(end);
+	});
+	benchLoop("std::to_chars uint32_t", [&](int i)
+	{
+		auto result = std::to_chars(string, string + sizeof(string), values32[i]);
+		BENCH_KEEP(result.ptr);
+	});
+	benchLoop("utils::to_chars<int64_t>", [&](int i)
+	{
+		char* end = utils::to_chars(string, string + sizeof(string), values64[i]);
+		BENCH_KEEP(end);
+	});
+	benchLoop("std::to_chars int64_t", [&](int i)
+	{
+		auto result = std::to_chars(string, string + sizeof(string), values64[i]);
+		BENCH_KEEP(result.ptr);
+	});
+	benchLoop("utils::to_chars<uint32_t, 16>", [&](int i)
+	{
+		char* end = utils::to_chars<uint32_t, 16>(string, string + sizeof(string),
+		                                          values32[i]);
+		BENCH_KEEP(end);
+	});
+	benchLoop("std::to_chars uint32_t base 16", [&](int i)
+	{
+		auto result = std::to_chars(string, string + sizeof(string), values32[i],
+		                            16);
+		BENCH_KEEP(result.ptr);
+	});
+
+	for(int i = 0; i < BENCH_HPP_VALUES; i++)
+	{
+		*std::to_chars(strings[i], strings[i] + BENCH_HPP_CHARS - 1,
+		               values64[i]).ptr = '\0';
+	}
+	benchLoop("utils::from_chars<int64_t>", [&](int i)
+	{
+		auto result = utils::from_chars<int64_t>(strings[i],
+		                                         strings[i] + BENCH_HPP_CHARS);
+		BENCH_KEEP(result.value);
+	});
+	benchLoop("std::from_chars int64_t", [&](int i)
+	{
+		int64_t value = 0;
+		std::from_chars(strings[i], strings[i] + BENCH_HPP_CHARS, value);
+		BENCH_KEEP(value);
+	});
+}
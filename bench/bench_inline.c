@@ -0,0 +1,91 @@
+#include <stdio.h>
+#include <inttypes.h>
+
+#include "bench.h"
+#include "utils.h"
+
+#define BENCH_LOOP(name)    BENCH_Library##name
+
+#include "bench_inline_loops.h"
+
+#define BENCH_INLINE_VALUES    4096
+#define BENCH_INLINE_ROUNDS    2000
+
+static float floats[BENCH_INLINE_VALUES];
+static uint32_t integers[BENCH_INLINE_VALUES];
+static uint8_t bytes[4 * BENCH_INLINE_VALUES];
+static char ascii[BENCH_INLINE_VALUES];
+
+typedef void (*BENCH_Loop)(void);
+
+static void floatBitsLibrary(void)
+{
+	BENCH_LibraryFloatBits(floats, integers, BENCH_INLINE_VALUES);
+}
+
+static void floatBitsInline(void)
+{
+	BENCH_InlineFloatBits(floats, integers, BENCH_INLINE_VALUES);
+}
+
+static void digitsLibrary(void)
+{
+	BENCH_LibraryDigits(ascii, bytes, BENCH_INLINE_VALUES);
+}
+
+static void digitsInline(void)
+{
+	BENCH_InlineDigits(ascii, bytes, BENCH_INLINE_VALUES);
+}
+
+static void asciiLibrary(void)
+{
+	BENCH_LibraryAscii(bytes, ascii, BENCH_INLINE_VALUES);
+}
+
+static void asciiInline(void)
+{
+	BENCH_InlineAscii(bytes, ascii, BENCH_INLINE_VALUES);
+}
+
+static void packLibrary(void)
+{
+	BENCH_LibraryPack(integers, bytes, BENCH_INLINE_VALUES);
+}
+
+static void packInline(void)
+{
+	BENCH_InlinePack(integers, bytes, BENCH_INLINE_VALUES);
+}
+
+static void benchLoop(const char* name, BENCH_Loop loop)
+{
+	BENCH_Sample sample;
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_INLINE_ROUNDS; round++)
+	{
+		loop();
+		BENCH_KEEP(bytes[0]);
+	}
+	BENCH_Stop(&sample);
+	BENCH_Report(name, &sample,
+	             (uint64_t)BENCH_INLINE_VALUES * BENCH_INLINE_ROUNDS, 0);
+}
+
+void BENCH_Inline(void)
+{
+	for(int i = 0; i < BENCH_INLINE_VALUES; i++)
+	{
+		integers[i] = BENCH_Random();
+		floats[i] = (float)integers[i];
+		ascii[i] = (char)('0' + integers[i] % 10);
+	}
+	benchLoop("UTILS_Float2Uint loop library", floatBitsLibrary);
+	benchLoop("UTILS_Float2Uint loop header-only", floatBitsInline);
+	benchLoop("UTILS_AsciiDigit2Byte loop library", digitsLibrary);
+	benchLoop("UTILS_AsciiDigit2Byte loop header-only", digitsInline);
+	benchLoop("UTILS_Byte2AsciiDigit loop library", asciiLibrary);
+	benchLoop("UTILS_Byte2AsciiDigit loop header-only", asciiInline);
+	benchLoop("UTILS_Uint2ByteArray loop library", packLibrary);
+	benchLoop("UTILS_Uint2ByteArray loop header-only", packInline);
+}
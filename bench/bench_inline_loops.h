@@ -0,0 +1,40 @@
+/**
+ * @file bench_inline_loops.h
+ * @brief Loops of trivial conversions, built twice by the benchmark
+ *
+ * bench_inline.c includes the file with calls to the library and
+ * bench_header_only.c with UTILS_HEADER_ONLY. BENCH_LOOP() gives the
+ * functions a different name in every build.
+ */
+
+void BENCH_LOOP(FloatBits)(const float* floats, uint32_t* bits, uint32_t count)
+{
+	for(uint32_t i = 0; i < count; i++)
+	{
+		UTILS_Float2Uint(floats[i], &bits[i]);
+	}
+}
+
+void BENCH_LOOP(Digits)(const char* ascii, uint8_t* bytes, uint32_t count)
+{
+	for(uint32_t i = 0; i < count; i++)
+	{
+		UTILS_AsciiDigit2Byte(ascii[i], &bytes[i]);
+	}
+}
+
+void BENCH_LOOP(Ascii)(const uint8_t* bytes, char* ascii, uint32_t count)
+{
+	for(uint32_t i = 0; i < count; i++)
+	{
+		UTILS_Byte2AsciiDigit(bytes[i], &ascii[i]);
+	}
+}
+
+void BENCH_LOOP(Pack)(const uint32_t* integers, uint8_t* bytes, uint32_t count)
+{
+	for(uint32_t i = 0; i < count; i++)
+	{
+		UTILS_Uint2ByteArray(integers[i], &bytes[4 * i]);
+	}
+}
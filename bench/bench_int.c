@@ -0,0 +1,240 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "bench.h"
+#include "utils.h"
+
+#define BENCH_INT_VALUES    4096
+#define BENCH_INT_ROUNDS    200
+#define BENCH_INT_MAX_CHARS 12
+#define BENCH_INT64_CHARS   24
+
+static int32_t values[BENCH_INT_VALUES];
+static char output[BENCH_INT_VALUES * BENCH_INT_MAX_CHARS];
+static char strings[BENCH_INT_VALUES][BENCH_INT_MAX_CHARS];
+static int64_t values64[BENCH_INT_VALUES];
+
+/* Values with uniformly distributed number of digits and random sign */
+static void fillValues(void)
+{
+	static const int32_t ranges[] = {10, 100, 1000, 10000, 100000, 1000000,
+	                                 10000000, 100000000, 1000000000,
+	                                 INT32_MAX};
+	for(int i = 0; i < BENCH_INT_VALUES; i++)
+	{
+		int32_t value = BENCH_Random() % ranges[BENCH_Random() % 10];
+		values[i] = (BENCH_Random() & 1) ? -value : value;
+	}
+}
+
+/* 64-bit values with uniformly distributed bit length and random sign */
+static void fillValues64(void)
+{
+	for(int i = 0; i < BENCH_INT_VALUES; i++)
+	{
+		uint64_t value = ((uint64_t)BENCH_Random() << 32) | BENCH_Random();
+		value >>= BENCH_Random() % 64;
+		values64[i] = (BENCH_Random() & 1) ? -(int64_t)(value >> 1) :
+		                                     (int64_t)value;
+	}
+}
+
+/* Uniformly distributed values, so almost all of them have 9-10 digits */
+static void fillUniformStrings(void)
+{
+	for(int i = 0; i < BENCH_INT_VALUES; i++)
+	{
+		snprintf(strings[i], BENCH_INT_MAX_CHARS, "%" PRId32,
+		         (int32_t)BENCH_Random());
+	}
+}
+
+/* Log-uniformly distributed values, every number of digits is as likely */
+static void fillLogUniformStrings(void)
+{
+	for(int i = 0; i < BENCH_INT_VALUES; i++)
+	{
+		snprintf(strings[i], BENCH_INT_MAX_CHARS, "%" PRId32, values[i]);
+	}
+}
+
+static void benchStrings(const char* distribution)
+{
+	BENCH_Sample sample;
+	char name[64];
+	const uint64_t ops = (uint64_t)BENCH_INT_VALUES * BENCH_INT_ROUNDS;
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_INT_ROUNDS; round++)
+	{
+		for(int i = 0; i < BENCH_INT_VALUES; i++)
+		{
+			int32_t integer;
+			UTILS_AsciiString2Int(strings[i], &integer);
+			BENCH_KEEP(integer);
+		}
+	}
+	BENCH_Stop(&sample);
+	snprintf(name, sizeof(name), "UTILS_AsciiString2Int %s", distribution);
+	BENCH_Report(name, &sample, ops, 0);
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_INT_ROUNDS; round++)
+	{
+		for(int i = 0; i < BENCH_INT_VALUES; i++)
+		{
+			int32_t integer = (int32_t)strtol(strings[i], NULL, 10);
+			BENCH_KEEP(integer);
+		}
+	}
+	BENCH_Stop(&sample);
+	snprintf(name, sizeof(name), "strtol %s", distribution);
+	BENCH_Report(name, &sample, ops, 0);
+}
+
+static void benchWide(void)
+{
+	BENCH_Sample sample;
+	char string[BENCH_INT64_CHARS];
+	const uint64_t ops = (uint64_t)BENCH_INT_VALUES * BENCH_INT_ROUNDS;
+
+	fillValues64();
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_INT_ROUNDS; round++)
+	{
+		for(int i = 0; i < BENCH_INT_VALUES; i++)
+		{
+			uint8_t digits;
+			UTILS_GetNumberOfDigit(values[i], &digits);
+			BENCH_KEEP(digits);
+		}
+	}
+	BENCH_Stop(&sample);
+	BENCH_Report("UTILS_GetNumberOfDigit", &sample, ops, 0);
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_INT_ROUNDS; round++)
+	{
+		for(int i = 0; i < BENCH_INT_VALUES; i++)
+		{
+			uint8_t digits;
+			UTILS_GetNumberOfDigit64(values64[i], &digits);
+			BENCH_KEEP(digits);
+		}
+	}
+	BENCH_Stop(&sample);
+	BENCH_Report("UTILS_GetNumberOfDigit64", &sample, ops, 0);
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_INT_ROUNDS; round++)
+	{
+		for(int i = 0; i < BENCH_INT_VALUES; i++)
+		{
+			UTILS_Int2AsciiString64(values64[i], string, sizeof(string));
+			BENCH_KEEP(string[0]);
+		}
+	}
+	BENCH_Stop(&sample);
+	BENCH_Report("UTILS_Int2AsciiString64", &sample, ops, 0);
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_INT_ROUNDS; round++)
+	{
+		for(int i = 0; i < BENCH_INT_VALUES; i++)
+		{
+			snprintf(string, sizeof(string), "%" PRId64, values64[i]);
+			BENCH_KEEP(string[0]);
+		}
+	}
+	BENCH_Stop(&sample);
+	BENCH_Report("snprintf int64_t", &sample, ops, 0);
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_INT_ROUNDS; round++)
+	{
+		for(int i = 0; i < BENCH_INT_VALUES; i++)
+		{
+			UTILS_Uint2Hex64((uint64_t)values64[i], string, sizeof(string));
+			BENCH_KEEP(string[0]);
+		}
+	}
+	BENCH_Stop(&sample);
+	BENCH_Report("UTILS_Uint2Hex64", &sample, ops, 0);
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_INT_ROUNDS; round++)
+	{
+		for(int i = 0; i < BENCH_INT_VALUES; i++)
+		{
+			snprintf(string, sizeof(string), "0x%" PRIX64,
+			         (uint64_t)values64[i]);
+			BENCH_KEEP(string[0]);
+		}
+	}
+	BENCH_Stop(&sample);
+	BENCH_Report("snprintf 0x uint64_t", &sample, ops, 0);
+}
+
+/* The per-call loop used so far: convert, measure and copy every value */
+static uint32_t perCallLoop(void)
+{
+	char tmp[BENCH_INT_MAX_CHARS] = {0};
+	uint32_t position = 0;
+	for(int i = 0; i < BENCH_INT_VALUES; i++)
+	{
+		uint32_t size;
+		UTILS_Int2AsciiString(values[i], tmp, BENCH_INT_MAX_CHARS - 1);
+		UTILS_GetSizeOfAsciiString(tmp, &size);
+		memcpy(&output[position], tmp, size);
+		position += size;
+		output[position++] = ',';
+	}
+	return position;
+}
+
+static uint32_t bulkLoop(void)
+{
+	uint32_t written;
+	UTILS_Int32ArrayToAscii(values, BENCH_INT_VALUES, ',', output,
+	                        sizeof(output), &written);
+	return written;
+}
+
+void BENCH_Int(void)
+{
+	BENCH_Sample sample;
+	uint32_t bytes = 0;
+
+	fillValues();
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_INT_ROUNDS; round++)
+	{
+		bytes += perCallLoop();
+		BENCH_KEEP(output[0]);
+	}
+	BENCH_Stop(&sample);
+	BENCH_Report("UTILS_Int2AsciiString per-call loop", &sample,
+	             (uint64_t)BENCH_INT_VALUES * BENCH_INT_ROUNDS, bytes);
+
+	bytes = 0;
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_INT_ROUNDS; round++)
+	{
+		bytes += bulkLoop();
+		BENCH_KEEP(output[0]);
+	}
+	BENCH_Stop(&sample);
+	BENCH_Report("UTILS_Int32ArrayToAscii", &sample,
+	             (uint64_t)BENCH_INT_VALUES * BENCH_INT_ROUNDS, bytes);
+
+	benchWide();
+
+	fillUniformStrings();
+	benchStrings("uniform");
+	fillLogUniformStrings();
+	benchStrings("log-uniform");
+}
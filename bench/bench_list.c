@@ -0,0 +1,89 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "bench.h"
+#include "utils.h"
+
+#define BENCH_LIST_VALUES    100000
+#define BENCH_LIST_ROUNDS    20
+
+static char text[BENCH_LIST_VALUES * 12];
+static int32_t integers[BENCH_LIST_VALUES];
+
+/* Splitting the text and calling UTILS_AsciiString2Int per token */
+static uint32_t perTokenLoop(uint32_t length)
+{
+	char token[16];
+	uint32_t values = 0;
+	uint32_t start = 0;
+	for(uint32_t pos = 0; pos <= length; pos++)
+	{
+		if(pos == length || text[pos] == ',')
+		{
+			memcpy(token, &text[start], pos - start);
+			token[pos - start] = 0x00;
+			UTILS_AsciiString2Int(token, &integers[values++]);
+			start = pos + 1;
+		}
+	}
+	return values;
+}
+
+static uint32_t strtolLoop(uint32_t length)
+{
+	char* end = text;
+	uint32_t values = 0;
+	while(end < &text[length])
+	{
+		integers[values++] = (int32_t)strtol(end, &end, 10);
+		end++;
+	}
+	return values;
+}
+
+void BENCH_List(void)
+{
+	BENCH_Sample sample;
+	uint32_t length = 0;
+	uint32_t count, position;
+
+	for(int i = 0; i < BENCH_LIST_VALUES; i++)
+	{
+		int32_t value = (int32_t)(BENCH_Random() % 200000) - 100000;
+		length += sprintf(&text[length], i ? ",%" PRId32 : "%" PRId32, value);
+	}
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_LIST_ROUNDS; round++)
+	{
+		BENCH_KEEP(perTokenLoop(length));
+	}
+	BENCH_Stop(&sample);
+	BENCH_Report("UTILS_AsciiString2Int per-token loop", &sample,
+	             (uint64_t)BENCH_LIST_VALUES * BENCH_LIST_ROUNDS,
+	             (uint64_t)length * BENCH_LIST_ROUNDS);
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_LIST_ROUNDS; round++)
+	{
+		BENCH_KEEP(strtolLoop(length));
+	}
+	BENCH_Stop(&sample);
+	BENCH_Report("strtol loop", &sample,
+	             (uint64_t)BENCH_LIST_VALUES * BENCH_LIST_ROUNDS,
+	             (uint64_t)length * BENCH_LIST_ROUNDS);
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_LIST_ROUNDS; round++)
+	{
+		UTILS_ParseInt32List(text, length, ",", integers, BENCH_LIST_VALUES,
+		                     &count, &position);
+		BENCH_KEEP(count);
+	}
+	BENCH_Stop(&sample);
+	BENCH_Report("UTILS_ParseInt32List", &sample,
+	             (uint64_t)BENCH_LIST_VALUES * BENCH_LIST_ROUNDS,
+	             (uint64_t)length * BENCH_LIST_ROUNDS);
+}
@@ -0,0 +1,134 @@
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "bench.h"
+#include "utils.h"
+
+#define BENCH_FORMAT_LINES     4096
+#define BENCH_FORMAT_ROUNDS    50
+#define BENCH_FORMAT_SIZE      128
+
+typedef struct
+{
+	int32_t id;
+	uint32_t address;
+	float temperature;
+	const char* state;
+}BENCH_LogLine;
+
+static BENCH_LogLine lines[BENCH_FORMAT_LINES];
+static char text[BENCH_FORMAT_SIZE];
+static const char* states[] = {"idle", "run", "error", "sleep"};
+
+typedef int (*BENCH_FormatLine)(const BENCH_LogLine* line);
+
+static int utilsLine(const BENCH_LogLine* line)
+{
+	UTILS_Format(text, sizeof(text), "[%6d] addr=0x%08X t=%.2f state=%-5s|",
+	             (int)line->id, (unsigned int)line->address,
+	             line->temperature, line->state);
+	return 0;
+}
+
+static int printfLine(const BENCH_LogLine* line)
+{
+	return snprintf(text, sizeof(text), "[%6d] addr=0x%08X t=%.2f state=%-5s|",
+	                (int)line->id, (unsigned int)line->address,
+	                line->temperature, line->state);
+}
+
+/* Logger of application which takes va_list of its own arguments */
+static int utilsLog(const char* format, ...)
+{
+	va_list args;
+	va_start(args, format);
+	UTILS_FormatV(text, sizeof(text), format, args);
+	va_end(args);
+	return 0;
+}
+
+static int printfLog(const char* format, ...)
+{
+	va_list args;
+	va_start(args, format);
+	int length = vsnprintf(text, sizeof(text), format, args);
+	va_end(args);
+	return length;
+}
+
+static int utilsLogLine(const BENCH_LogLine* line)
+{
+	return utilsLog("[%6d] addr=0x%08X t=%.2f state=%-5s|", (int)line->id,
+	                (unsigned int)line->address, line->temperature,
+	                line->state);
+}
+
+static int printfLogLine(const BENCH_LogLine* line)
+{
+	return printfLog("[%6d] addr=0x%08X t=%.2f state=%-5s|", (int)line->id,
+	                 (unsigned int)line->address, line->temperature,
+	                 line->state);
+}
+
+static int utilsIntegers(const BENCH_LogLine* line)
+{
+	UTILS_Format(text, sizeof(text), "%d,%u,%x", (int)line->id,
+	             (unsigned int)line->address, (unsigned int)line->address);
+	return 0;
+}
+
+static int printfIntegers(const BENCH_LogLine* line)
+{
+	return snprintf(text, sizeof(text), "%d,%u,%x", (int)line->id,
+	                (unsigned int)line->address, (unsigned int)line->address);
+}
+
+static int utilsFloat(const BENCH_LogLine* line)
+{
+	UTILS_Format(text, sizeof(text), "%f", line->temperature);
+	return 0;
+}
+
+static int printfFloat(const BENCH_LogLine* line)
+{
+	return snprintf(text, sizeof(text), "%f", line->temperature);
+}
+
+static void benchLines(const char* name, BENCH_FormatLine format)
+{
+	BENCH_Sample sample;
+	const uint64_t ops = (uint64_t)BENCH_FORMAT_LINES * BENCH_FORMAT_ROUNDS;
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_FORMAT_ROUNDS; round++)
+	{
+		for(int i = 0; i < BENCH_FORMAT_LINES; i++)
+		{
+			BENCH_KEEP(format(&lines[i]));
+			BENCH_KEEP(text[0]);
+		}
+	}
+	BENCH_Stop(&sample);
+	BENCH_Report(name, &sample, ops, 0);
+}
+
+void BENCH_Printf(void)
+{
+	for(int i = 0; i < BENCH_FORMAT_LINES; i++)
+	{
+		lines[i].id = (int32_t)BENCH_Random() >> (BENCH_Random() & 31);
+		lines[i].address = BENCH_Random();
+		lines[i].temperature = (float)(int32_t)BENCH_Random() / 1e7f;
+		lines[i].state = states[BENCH_Random() & 3];
+	}
+	benchLines("UTILS_Format log line", utilsLine);
+	benchLines("snprintf log line", printfLine);
+	benchLines("UTILS_FormatV log line", utilsLogLine);
+	benchLines("vsnprintf log line", printfLogLine);
+	benchLines("UTILS_Format %d,%u,%x", utilsIntegers);
+	benchLines("snprintf %d,%u,%x", printfIntegers);
+	benchLines("UTILS_Format %f", utilsFloat);
+	benchLines("snprintf %f", printfFloat);
+}
@@ -0,0 +1,151 @@
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "bench.h"
+#include "utils.h"
+
+#define BENCH_SCANNER_LINES     1024
+#define BENCH_SCANNER_ROUNDS    100
+#define BENCH_SCANNER_SIZE      96
+/* Decimal fields of a sentence, then float and hexadecimal checksum */
+#define BENCH_SCANNER_INTS      4
+
+static char lines[BENCH_SCANNER_LINES][BENCH_SCANNER_SIZE];
+static uint32_t lengths[BENCH_SCANNER_LINES];
+
+/* "$SENS,<int>,<int>,<int>,<int>,<float>*<hex>" */
+static uint32_t scanLine(const char* line, uint32_t length)
+{
+	UTILS_SCANNER scanner;
+	int32_t integer = 0;
+	uint32_t checksum = 0;
+	uint32_t sum = 0;
+	float fp = 0.0f;
+	UTILS_ScannerInit(&scanner, line, length);
+	UTILS_ScannerExpect(&scanner, "$SENS,");
+	for(int field = 0; field < BENCH_SCANNER_INTS; field++)
+	{
+		UTILS_ScannerNextInt(&scanner, &integer, NULL);
+		UTILS_ScannerExpect(&scanner, ",");
+		sum += (uint32_t)integer;
+	}
+	UTILS_ScannerNextFloat(&scanner, &fp, NULL);
+	UTILS_ScannerExpect(&scanner, "*");
+	UTILS_ScannerNextHex(&scanner, &checksum, NULL);
+	return sum + checksum + (uint32_t)fp;
+}
+
+/* Only the checksum of the sentence, the fields before it are skipped */
+static uint32_t skipLine(const char* line, uint32_t length)
+{
+	UTILS_SCANNER scanner;
+	uint32_t checksum = 0;
+	UTILS_ScannerInit(&scanner, line, length);
+	UTILS_ScannerSkipUntil(&scanner, '*', NULL);
+	UTILS_ScannerExpect(&scanner, "*");
+	UTILS_ScannerNextHex(&scanner, &checksum, NULL);
+	return checksum;
+}
+
+static uint32_t memchrLine(const char* line, uint32_t length)
+{
+	uint32_t checksum = 0;
+	const char* star = memchr(line, '*', length);
+	char field[BENCH_SCANNER_SIZE];
+	uint32_t size = length - (uint32_t)(star + 1 - line);
+	memcpy(field, star + 1, size);
+	field[size] = 0x00;
+	UTILS_Hex2Uint(field, &checksum);
+	return checksum;
+}
+
+/* Next field up to ',' or '*' copied to NULL terminated 'field' */
+static uint32_t copyField(const char* line, uint32_t length, uint32_t pos,
+                          char* field)
+{
+	uint32_t end = pos;
+	while(end < length && line[end] != ',' && line[end] != '*')
+	{
+		end++;
+	}
+	memcpy(field, &line[pos], end - pos);
+	field[end - pos] = 0x00;
+	return end + 1;
+}
+
+/* The same sentence with a copy of every field before conversion */
+static uint32_t copyLine(const char* line, uint32_t length)
+{
+	char field[BENCH_SCANNER_SIZE];
+	int32_t integer = 0;
+	uint32_t checksum = 0;
+	uint32_t sum = 0;
+	uint32_t consumed;
+	float fp = 0.0f;
+	uint32_t pos = sizeof("$SENS,") - 1;
+	for(int ints = 0; ints < BENCH_SCANNER_INTS; ints++)
+	{
+		pos = copyField(line, length, pos, field);
+		UTILS_AsciiString2Int(field, &integer);
+		sum += (uint32_t)integer;
+	}
+	pos = copyField(line, length, pos, field);
+	UTILS_AsciiString2Float(field, sizeof(field), &fp, &consumed);
+	copyField(line, length, pos, field);
+	UTILS_Hex2Uint(field, &checksum);
+	return sum + checksum + (uint32_t)fp;
+}
+
+static uint32_t scanfLine(const char* line, uint32_t length)
+{
+	int32_t integers[BENCH_SCANNER_INTS] = {0};
+	uint32_t checksum = 0;
+	float fp = 0.0f;
+	(void)length;
+	sscanf(line, "$SENS,%" SCNd32 ",%" SCNd32 ",%" SCNd32 ",%" SCNd32 ",%f*%" SCNx32,
+	       &integers[0], &integers[1], &integers[2], &integers[3], &fp,
+	       &checksum);
+	return (uint32_t)(integers[0] + integers[1] + integers[2] + integers[3]) +
+	       checksum + (uint32_t)fp;
+}
+
+static void benchLines(const char* name,
+                       uint32_t (*parse)(const char*, uint32_t))
+{
+	BENCH_Sample sample;
+	uint64_t bytes = 0;
+	const uint64_t ops = (uint64_t)BENCH_SCANNER_LINES * BENCH_SCANNER_ROUNDS;
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_SCANNER_ROUNDS; round++)
+	{
+		for(int i = 0; i < BENCH_SCANNER_LINES; i++)
+		{
+			BENCH_KEEP(parse(lines[i], lengths[i]));
+			bytes += lengths[i];
+		}
+	}
+	BENCH_Stop(&sample);
+	BENCH_Report(name, &sample, ops, bytes);
+}
+
+void BENCH_Scanner(void)
+{
+	for(int i = 0; i < BENCH_SCANNER_LINES; i++)
+	{
+		int32_t value = (int32_t)BENCH_Random() >> (BENCH_Random() & 31);
+		lengths[i] = (uint32_t)snprintf(lines[i], BENCH_SCANNER_SIZE,
+		                                "$SENS,%" PRId32 ",%" PRIu32 ",%" PRId32
+		                                ",%" PRIu32 ",%.3f*%02" PRIX32,
+		                                value, BENCH_Random() % 1000,
+		                                -value / 7, BENCH_Random() & 0xFFFF,
+		                                (double)value / 1000.0,
+		                                BENCH_Random() & 0xFF);
+	}
+	benchLines("UTILS_Scanner sentence", scanLine);
+	benchLines("copy + AsciiString2Int sentence", copyLine);
+	benchLines("sscanf sentence", scanfLine);
+	benchLines("UTILS_ScannerSkipUntil checksum", skipLine);
+	benchLines("memchr + Hex2Uint checksum", memchrLine);
+}
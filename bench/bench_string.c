@@ -0,0 +1,49 @@
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "bench.h"
+#include "utils.h"
+
+#define BENCH_STRING_MAX_SIZE    (1024 * 1024)
+#define BENCH_STRING_TOTAL       (64 * 1024 * 1024)
+
+static char text[BENCH_STRING_MAX_SIZE + 1];
+
+void BENCH_String(void)
+{
+	BENCH_Sample sample;
+	char name[64];
+
+	for(uint32_t size = 1; size <= BENCH_STRING_MAX_SIZE; size *= 4)
+	{
+		uint32_t rounds = BENCH_STRING_TOTAL / size;
+		if(rounds > 4000000) rounds = 4000000;
+		memset(text, 'a', size);
+		text[size] = 0x00;
+
+		BENCH_Start(&sample);
+		for(uint32_t round = 0; round < rounds; round++)
+		{
+			uint32_t length;
+			UTILS_GetSizeOfAsciiString(text, &length);
+			BENCH_KEEP(length);
+		}
+		BENCH_Stop(&sample);
+		snprintf(name, sizeof(name), "UTILS_GetSizeOfAsciiString %" PRIu32 " B",
+		         size);
+		BENCH_Report(name, &sample, rounds, (uint64_t)rounds * size);
+
+		BENCH_Start(&sample);
+		for(uint32_t round = 0; round < rounds; round++)
+		{
+			size_t length;
+			BENCH_KEEP(text);
+			length = strlen(text);
+			BENCH_KEEP(length);
+		}
+		BENCH_Stop(&sample);
+		snprintf(name, sizeof(name), "strlen %" PRIu32 " B", size);
+		BENCH_Report(name, &sample, rounds, (uint64_t)rounds * size);
+	}
+}
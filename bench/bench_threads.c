@@ -0,0 +1,93 @@
+#include <stdio.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <inttypes.h>
+
+#include "bench.h"
+#include "utils.h"
+
+#define BENCH_THREADS_MAX       64
+#define BENCH_THREADS_VALUES    1024
+#define BENCH_THREADS_ROUNDS    200
+
+/* One cache line per thread, so workers do not share anything mutable */
+typedef struct
+{
+	float values[BENCH_THREADS_VALUES];
+	uint32_t checksum;
+}__attribute__((aligned(64))) BENCH_Worker;
+
+static BENCH_Worker workers[BENCH_THREADS_MAX];
+
+static void* convertFloats(void* argument)
+{
+	BENCH_Worker* worker = argument;
+	char string[UTILS_FLOAT_STRING_MAX_SIZE];
+	char hex[11];
+	uint32_t checksum = 0;
+	for(int round = 0; round < BENCH_THREADS_ROUNDS; round++)
+	{
+		for(int i = 0; i < BENCH_THREADS_VALUES; i++)
+		{
+			float fp;
+			uint32_t integer;
+			UTILS_Float2Uint(worker->values[i], &integer);
+			UTILS_Uint2Float(integer, &fp);
+			UTILS_Float2Hex(fp, hex, sizeof(hex));
+			UTILS_Float2AsciiString(fp, string, sizeof(string));
+			checksum += (uint8_t)string[0] + (uint8_t)hex[9];
+		}
+	}
+	worker->checksum = checksum;
+	return NULL;
+}
+
+/* Every thread does the same amount of work, so with linear scaling the
+ * time per conversion of the whole group drops as 1 / threads */
+static void benchThreads(uint32_t threads)
+{
+	pthread_t handles[BENCH_THREADS_MAX];
+	BENCH_Sample sample;
+	char name[64];
+	uint32_t started = 0;
+
+	BENCH_Start(&sample);
+	for(; started < threads; started++)
+	{
+		if(pthread_create(&handles[started], NULL, convertFloats,
+		                  &workers[started]) != 0)
+		{
+			break;
+		}
+	}
+	for(uint32_t thread = 0; thread < started; thread++)
+	{
+		pthread_join(handles[thread], NULL);
+	}
+	BENCH_Stop(&sample);
+	snprintf(name, sizeof(name), "Float conversions %" PRIu32 " threads",
+	         started);
+	BENCH_Report(name, &sample,
+	             (uint64_t)started * BENCH_THREADS_VALUES * BENCH_THREADS_ROUNDS,
+	             0);
+}
+
+void BENCH_Threads(void)
+{
+	long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+	uint32_t maxThreads = (cpus < 1) ? 1 :
+	                      (cpus > BENCH_THREADS_MAX) ? BENCH_THREADS_MAX :
+	                                                   (uint32_t)cpus;
+	for(uint32_t thread = 0; thread < maxThreads; thread++)
+	{
+		for(int i = 0; i < BENCH_THREADS_VALUES; i++)
+		{
+			workers[thread].values[i] = (float)BENCH_Random() /
+			                            (float)(1u << (BENCH_Random() % 32));
+		}
+	}
+	for(uint32_t threads = 1; threads <= maxThreads; threads++)
+	{
+		benchThreads(threads);
+	}
+}
@@ -0,0 +1,393 @@
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "bench.h"
+#include "utils.h"
+
+#define BENCH_VARINT_COUNT      4096
+#define BENCH_VARINT_ROUNDS     1000
+/* Arrays shorter than 16 values are decoded without the SSSE3 kernel */
+#define BENCH_VARINT_SCALAR     15
+
+static uint32_t values[BENCH_VARINT_COUNT];
+static uint32_t decoded[BENCH_VARINT_COUNT];
+static int32_t deltas[BENCH_VARINT_COUNT];
+static int32_t decodedDeltas[BENCH_VARINT_COUNT];
+static uint64_t values64[BENCH_VARINT_COUNT];
+static uint64_t decoded64[BENCH_VARINT_COUNT];
+static int64_t signed64[BENCH_VARINT_COUNT];
+static int64_t decodedSigned64[BENCH_VARINT_COUNT];
+static uint8_t bytes[BENCH_VARINT_COUNT * UTILS_VARINT64_MAX_SIZE];
+
+/* Byte by byte decoder with a branch per byte, the usual implementation */
+static uint32_t decodeBytes(const uint8_t* varints, uint32_t* integers,
+                            uint32_t count)
+{
+	uint32_t pos = 0;
+	for(uint32_t index = 0; index < count; index++)
+	{
+		uint32_t value = 0;
+		uint32_t shift = 0;
+		uint8_t byte;
+		do
+		{
+			byte = varints[pos++];
+			value |= (uint32_t)(byte & 0x7F) << shift;
+			shift += 7;
+		}while(byte & 0x80);
+		integers[index] = value;
+	}
+	return pos;
+}
+
+/* One UTILS_VarintToUint32 call per value */
+static uint32_t perValueDecode(uint32_t size)
+{
+	uint32_t pos = 0;
+	for(uint32_t index = 0; index < BENCH_VARINT_COUNT; index++)
+	{
+		uint32_t consumed = 0;
+		UTILS_VarintToUint32(&bytes[pos], size - pos, &decoded[index], &consumed);
+		pos += consumed;
+	}
+	return pos;
+}
+
+/* Array decode in calls too short for the SSSE3 kernel, the scalar path */
+static uint32_t scalarDecode(uint32_t size)
+{
+	uint32_t pos = 0;
+	for(uint32_t index = 0; index < BENCH_VARINT_COUNT;
+	    index += BENCH_VARINT_SCALAR)
+	{
+		uint32_t count = BENCH_VARINT_COUNT - index;
+		uint32_t consumed = 0;
+		if(count > BENCH_VARINT_SCALAR)
+		{
+			count = BENCH_VARINT_SCALAR;
+		}
+		UTILS_VarintsToUint32Array(&bytes[pos], size - pos, &decoded[index],
+		                           count, &consumed);
+		pos += consumed;
+	}
+	return pos;
+}
+
+/* One UTILS_Uint32ToVarint call per value */
+static uint32_t perValueEncode(void)
+{
+	uint32_t pos = 0;
+	for(uint32_t index = 0; index < BENCH_VARINT_COUNT; index++)
+	{
+		uint32_t written = 0;
+		UTILS_Uint32ToVarint(values[index], &bytes[pos], sizeof(bytes) - pos,
+		                     &written);
+		pos += written;
+	}
+	return pos;
+}
+
+/* Counters of 'bits' bits at most, the varints of all of them in 'bytes'.
+ * With 0 bits every counter has random number of bits. */
+static uint32_t fillValues(uint32_t bits)
+{
+	uint32_t size;
+	for(uint32_t index = 0; index < BENCH_VARINT_COUNT; index++)
+	{
+		values[index] = BENCH_Random() >> (bits ? 32 - bits : BENCH_Random() & 31);
+	}
+	UTILS_Uint32ArrayToVarints(values, BENCH_VARINT_COUNT, bytes, sizeof(bytes),
+	                           &size);
+	return size;
+}
+
+/* The whole array takes the SSSE3 kernel on CPUs which have it, the rows
+ * of short calls and of single values measure the scalar decoder */
+static void benchDecode(const char* label, uint32_t size)
+{
+	BENCH_Sample sample;
+	char name[64];
+	uint32_t consumed;
+	const uint64_t ops = (uint64_t)BENCH_VARINT_COUNT * BENCH_VARINT_ROUNDS;
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_VARINT_ROUNDS; round++)
+	{
+		UTILS_VarintsToUint32Array(bytes, size, decoded, BENCH_VARINT_COUNT,
+		                           &consumed);
+		BENCH_KEEP(decoded[round % BENCH_VARINT_COUNT]);
+	}
+	BENCH_Stop(&sample);
+	snprintf(name, sizeof(name), "UTILS_VarintsToUint32Array %s", label);
+	BENCH_Report(name, &sample, ops, (uint64_t)size * BENCH_VARINT_ROUNDS);
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_VARINT_ROUNDS; round++)
+	{
+		BENCH_KEEP(decodeBytes(bytes, decoded, BENCH_VARINT_COUNT));
+		BENCH_KEEP(decoded[round % BENCH_VARINT_COUNT]);
+	}
+	BENCH_Stop(&sample);
+	snprintf(name, sizeof(name), "byte loop varint decode %s", label);
+	BENCH_Report(name, &sample, ops, (uint64_t)size * BENCH_VARINT_ROUNDS);
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_VARINT_ROUNDS; round++)
+	{
+		BENCH_KEEP(scalarDecode(size));
+		BENCH_KEEP(decoded[round % BENCH_VARINT_COUNT]);
+	}
+	BENCH_Stop(&sample);
+	snprintf(name, sizeof(name), "UTILS_VarintsToUint32Array scalar %s", label);
+	BENCH_Report(name, &sample, ops, (uint64_t)size * BENCH_VARINT_ROUNDS);
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_VARINT_ROUNDS; round++)
+	{
+		BENCH_KEEP(perValueDecode(size));
+		BENCH_KEEP(decoded[round % BENCH_VARINT_COUNT]);
+	}
+	BENCH_Stop(&sample);
+	snprintf(name, sizeof(name), "UTILS_VarintToUint32 per-value %s", label);
+	BENCH_Report(name, &sample, ops, (uint64_t)size * BENCH_VARINT_ROUNDS);
+}
+
+static void benchEncode(const char* label)
+{
+	BENCH_Sample sample;
+	char name[64];
+	uint32_t size = 0;
+	const uint64_t ops = (uint64_t)BENCH_VARINT_COUNT * BENCH_VARINT_ROUNDS;
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_VARINT_ROUNDS; round++)
+	{
+		UTILS_Uint32ArrayToVarints(values, BENCH_VARINT_COUNT, bytes,
+		                           sizeof(bytes), &size);
+		BENCH_KEEP(bytes[round % sizeof(bytes)]);
+	}
+	BENCH_Stop(&sample);
+	snprintf(name, sizeof(name), "UTILS_Uint32ArrayToVarints %s", label);
+	BENCH_Report(name, &sample, ops, (uint64_t)size * BENCH_VARINT_ROUNDS);
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_VARINT_ROUNDS; round++)
+	{
+		BENCH_KEEP(perValueEncode());
+		BENCH_KEEP(bytes[round % sizeof(bytes)]);
+	}
+	BENCH_Stop(&sample);
+	snprintf(name, sizeof(name), "UTILS_Uint32ToVarint per-value %s", label);
+	BENCH_Report(name, &sample, ops, (uint64_t)size * BENCH_VARINT_ROUNDS);
+}
+
+/* Zigzag deltas of a slowly changing signal */
+static void benchDeltas(void)
+{
+	BENCH_Sample sample;
+	uint32_t size;
+	uint32_t consumed;
+	const uint64_t ops = (uint64_t)BENCH_VARINT_COUNT * BENCH_VARINT_ROUNDS;
+	for(uint32_t index = 0; index < BENCH_VARINT_COUNT; index++)
+	{
+		deltas[index] = (int32_t)(BENCH_Random() % 201) - 100;
+	}
+	UTILS_Int32ArrayToVarints(deltas, BENCH_VARINT_COUNT, bytes, sizeof(bytes),
+	                          &size);
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_VARINT_ROUNDS; round++)
+	{
+		UTILS_VarintsToInt32Array(bytes, size, decodedDeltas, BENCH_VARINT_COUNT,
+		                          &consumed);
+		BENCH_KEEP(decodedDeltas[round % BENCH_VARINT_COUNT]);
+	}
+	BENCH_Stop(&sample);
+	BENCH_Report("UTILS_VarintsToInt32Array deltas +-100", &sample, ops,
+	             (uint64_t)size * BENCH_VARINT_ROUNDS);
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_VARINT_ROUNDS; round++)
+	{
+		uint32_t pos = 0;
+		for(uint32_t index = 0; index < BENCH_VARINT_COUNT; index++)
+		{
+			uint32_t length = 0;
+			UTILS_VarintToInt32(&bytes[pos], size - pos, &decodedDeltas[index],
+			                    &length);
+			pos += length;
+		}
+		BENCH_KEEP(decodedDeltas[round % BENCH_VARINT_COUNT]);
+	}
+	BENCH_Stop(&sample);
+	BENCH_Report("UTILS_VarintToInt32 per-value deltas +-100", &sample, ops,
+	             (uint64_t)size * BENCH_VARINT_ROUNDS);
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_VARINT_ROUNDS; round++)
+	{
+		uint32_t pos = 0;
+		for(uint32_t index = 0; index < BENCH_VARINT_COUNT; index++)
+		{
+			uint32_t length = 0;
+			UTILS_Int32ToVarint(deltas[index], &bytes[pos], sizeof(bytes) - pos,
+			                    &length);
+			pos += length;
+		}
+		BENCH_KEEP(bytes[round % sizeof(bytes)]);
+	}
+	BENCH_Stop(&sample);
+	BENCH_Report("UTILS_Int32ToVarint per-value deltas +-100", &sample, ops,
+	             (uint64_t)size * BENCH_VARINT_ROUNDS);
+}
+
+/* 64-bit values of random number of bits, signed ones of both signs */
+static void bench64(void)
+{
+	BENCH_Sample sample;
+	uint32_t size = 0;
+	uint32_t signedSize = 0;
+	uint32_t consumed;
+	const uint64_t ops = (uint64_t)BENCH_VARINT_COUNT * BENCH_VARINT_ROUNDS;
+	for(uint32_t index = 0; index < BENCH_VARINT_COUNT; index++)
+	{
+		uint64_t random = (uint64_t)BENCH_Random() << 32 | BENCH_Random();
+		values64[index] = random >> (BENCH_Random() & 63);
+		signed64[index] = (int64_t)random >> (BENCH_Random() & 63);
+	}
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_VARINT_ROUNDS; round++)
+	{
+		UTILS_Uint64ArrayToVarints(values64, BENCH_VARINT_COUNT, bytes,
+		                           sizeof(bytes), &size);
+		BENCH_KEEP(bytes[round % sizeof(bytes)]);
+	}
+	BENCH_Stop(&sample);
+	BENCH_Report("UTILS_Uint64ArrayToVarints mixed", &sample, ops,
+	             (uint64_t)size * BENCH_VARINT_ROUNDS);
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_VARINT_ROUNDS; round++)
+	{
+		uint32_t pos = 0;
+		for(uint32_t index = 0; index < BENCH_VARINT_COUNT; index++)
+		{
+			uint32_t length = 0;
+			UTILS_Uint64ToVarint(values64[index], &bytes[pos],
+			                     sizeof(bytes) - pos, &length);
+			pos += length;
+		}
+		BENCH_KEEP(bytes[round % sizeof(bytes)]);
+	}
+	BENCH_Stop(&sample);
+	BENCH_Report("UTILS_Uint64ToVarint per-value mixed", &sample, ops,
+	             (uint64_t)size * BENCH_VARINT_ROUNDS);
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_VARINT_ROUNDS; round++)
+	{
+		UTILS_VarintsToUint64Array(bytes, size, decoded64, BENCH_VARINT_COUNT,
+		                           &consumed);
+		BENCH_KEEP(decoded64[round % BENCH_VARINT_COUNT]);
+	}
+	BENCH_Stop(&sample);
+	BENCH_Report("UTILS_VarintsToUint64Array mixed", &sample, ops,
+	             (uint64_t)size * BENCH_VARINT_ROUNDS);
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_VARINT_ROUNDS; round++)
+	{
+		uint32_t pos = 0;
+		for(uint32_t index = 0; index < BENCH_VARINT_COUNT; index++)
+		{
+			uint32_t length = 0;
+			UTILS_VarintToUint64(&bytes[pos], size - pos, &decoded64[index],
+			                     &length);
+			pos += length;
+		}
+		BENCH_KEEP(decoded64[round % BENCH_VARINT_COUNT]);
+	}
+	BENCH_Stop(&sample);
+	BENCH_Report("UTILS_VarintToUint64 per-value mixed", &sample, ops,
+	             (uint64_t)size * BENCH_VARINT_ROUNDS);
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_VARINT_ROUNDS; round++)
+	{
+		UTILS_Int64ArrayToVarints(signed64, BENCH_VARINT_COUNT, bytes,
+		                          sizeof(bytes), &signedSize);
+		BENCH_KEEP(bytes[round % sizeof(bytes)]);
+	}
+	BENCH_Stop(&sample);
+	BENCH_Report("UTILS_Int64ArrayToVarints mixed", &sample, ops,
+	             (uint64_t)signedSize * BENCH_VARINT_ROUNDS);
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_VARINT_ROUNDS; round++)
+	{
+		uint32_t pos = 0;
+		for(uint32_t index = 0; index < BENCH_VARINT_COUNT; index++)
+		{
+			uint32_t length = 0;
+			UTILS_Int64ToVarint(signed64[index], &bytes[pos],
+			                    sizeof(bytes) - pos, &length);
+			pos += length;
+		}
+		BENCH_KEEP(bytes[round % sizeof(bytes)]);
+	}
+	BENCH_Stop(&sample);
+	BENCH_Report("UTILS_Int64ToVarint per-value mixed", &sample, ops,
+	             (uint64_t)signedSize * BENCH_VARINT_ROUNDS);
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_VARINT_ROUNDS; round++)
+	{
+		UTILS_VarintsToInt64Array(bytes, signedSize, decodedSigned64,
+		                          BENCH_VARINT_COUNT, &consumed);
+		BENCH_KEEP(decodedSigned64[round % BENCH_VARINT_COUNT]);
+	}
+	BENCH_Stop(&sample);
+	BENCH_Report("UTILS_VarintsToInt64Array mixed", &sample, ops,
+	             (uint64_t)signedSize * BENCH_VARINT_ROUNDS);
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_VARINT_ROUNDS; round++)
+	{
+		uint32_t pos = 0;
+		for(uint32_t index = 0; index < BENCH_VARINT_COUNT; index++)
+		{
+			uint32_t length = 0;
+			UTILS_VarintToInt64(&bytes[pos], signedSize - pos,
+			                    &decodedSigned64[index], &length);
+			pos += length;
+		}
+		BENCH_KEEP(decodedSigned64[round % BENCH_VARINT_COUNT]);
+	}
+	BENCH_Stop(&sample);
+	BENCH_Report("UTILS_VarintToInt64 per-value mixed", &sample, ops,
+	             (uint64_t)signedSize * BENCH_VARINT_ROUNDS);
+}
+
+void BENCH_Varint(void)
+{
+	static const uint32_t bits[] = {7, 14, 21, 32, 0};
+	for(uint32_t index = 0; index < sizeof(bits) / sizeof(bits[0]); index++)
+	{
+		char label[16];
+		uint32_t size = fillValues(bits[index]);
+		if(bits[index] != 0)
+		{
+			snprintf(label, sizeof(label), "%" PRIu32 "-bit", bits[index]);
+		}
+		else
+		{
+			snprintf(label, sizeof(label), "mixed");
+		}
+		benchDecode(label, size);
+		benchEncode(label);
+	}
+	benchDeltas();
+	bench64();
+}
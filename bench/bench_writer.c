@@ -0,0 +1,314 @@
+#include <stdio.h>
+#include <string.h>
+#include <inttypes.h>
+
+#include "bench.h"
+#include "utils.h"
+
+#define BENCH_WRITER_FIELDS     100
+#define BENCH_WRITER_RECORDS    1024
+#define BENCH_WRITER_ROUNDS     10
+/* Room for 100 binary fields of 32 digits */
+#define BENCH_WRITER_SIZE       4096
+/* Longest length of the old conversions */
+#define BENCH_WRITER_FIELD_MAX  255
+
+typedef enum
+{
+	BENCH_FIELD_STRING,
+	BENCH_FIELD_UINT,
+	BENCH_FIELD_UINT64,
+	BENCH_FIELD_INT64,
+	BENCH_FIELD_HEX64,
+	BENCH_FIELD_BIN,
+	BENCH_FIELD_OCT,
+	BENCH_FIELD_FLOAT,
+	BENCH_FIELD_FIXED,
+	BENCH_FIELD_FORMAT,
+	BENCH_FIELD_COUNT,
+}BENCH_Field;
+
+/* Append and the one-shot conversion of the same text, per field kind */
+static const char* const fieldNames[BENCH_FIELD_COUNT][2] =
+{
+	{"UTILS_WriterAppendString record", "memcpy record"},
+	{"UTILS_WriterAppendUint record",
+	 "Int2AsciiString64 of Uint + GetSize record"},
+	{"UTILS_WriterAppendUint64 record",
+	 "Int2AsciiString64 of Uint64 + GetSize record"},
+	{"UTILS_WriterAppendInt64 record",
+	 "Int2AsciiString64 of Int64 + GetSize record"},
+	{"UTILS_WriterAppendHex64 record", "Uint2Hex64 + GetSize record"},
+	{"UTILS_WriterAppendBin record", "Uint2Bin + GetSize record"},
+	{"UTILS_WriterAppendOct record", "Uint2Oct + GetSize record"},
+	{"UTILS_WriterAppendFloat record", "Float2AsciiShortest + GetSize record"},
+	{"UTILS_WriterAppendFixed record", "Fixed2AsciiString + GetSize record"},
+	{"UTILS_WriterAppendFormat record", "UTILS_Format + GetSize record"},
+};
+
+static const char words[8][9] =
+{
+	"alpha", "bravo", "charlie", "delta", "echo", "foxtrot", "golf", "hotel"
+};
+
+static int32_t fields[BENCH_WRITER_RECORDS][BENCH_WRITER_FIELDS];
+static char record[BENCH_WRITER_SIZE];
+static BENCH_Field field;
+
+/* Record of decimal and hexadecimal fields split by ',' */
+static uint32_t writeRecord(const int32_t* values)
+{
+	UTILS_WRITER writer;
+	uint32_t size;
+	UTILS_WriterInit(&writer, record, sizeof(record));
+	for(int i = 0; i < BENCH_WRITER_FIELDS; i++)
+	{
+		if(i & 1)
+		{
+			UTILS_WriterAppendHex(&writer, (uint32_t)values[i]);
+		}
+		else
+		{
+			UTILS_WriterAppendInt(&writer, values[i]);
+		}
+		UTILS_WriterAppendChar(&writer, ',');
+	}
+	UTILS_WriterFinish(&writer, &size);
+	return size;
+}
+
+/* The same record with the conversions which set the rest to NULL */
+static uint32_t convertRecord(const int32_t* values)
+{
+	uint32_t size = 0;
+	for(int i = 0; i < BENCH_WRITER_FIELDS; i++)
+	{
+		uint32_t left = sizeof(record) - size;
+		uint8_t length = left > BENCH_WRITER_FIELD_MAX ?
+		                 BENCH_WRITER_FIELD_MAX : (uint8_t)left;
+		uint32_t written;
+		if(i & 1)
+		{
+			UTILS_Uint2Hex((uint32_t)values[i], &record[size], length);
+		}
+		else
+		{
+			UTILS_Int2AsciiString(values[i], &record[size], length);
+		}
+		UTILS_GetSizeOfAsciiString(&record[size], &written);
+		size += written;
+		record[size++] = ',';
+	}
+	record[size] = 0x00;
+	return size;
+}
+
+static uint32_t printRecord(const int32_t* values)
+{
+	uint32_t size = 0;
+	for(int i = 0; i < BENCH_WRITER_FIELDS; i++)
+	{
+		if(i & 1)
+		{
+			size += (uint32_t)snprintf(&record[size], sizeof(record) - size,
+			                           "0x%" PRIX32 ",", (uint32_t)values[i]);
+		}
+		else
+		{
+			size += (uint32_t)snprintf(&record[size], sizeof(record) - size,
+			                           "%" PRId32 ",", values[i]);
+		}
+	}
+	return size;
+}
+
+/* Record of fields of one kind split by ',' */
+static uint32_t writeFields(const int32_t* values)
+{
+	UTILS_WRITER writer;
+	uint32_t size;
+	UTILS_WriterInit(&writer, record, sizeof(record));
+	for(int i = 0; i < BENCH_WRITER_FIELDS; i++)
+	{
+		uint64_t wide = (uint64_t)(uint32_t)values[i] << 31;
+		switch(field)
+		{
+		case BENCH_FIELD_STRING:
+			UTILS_WriterAppendString(&writer, words[values[i] & 7],
+			                         (uint32_t)strlen(words[values[i] & 7]));
+			break;
+		case BENCH_FIELD_UINT:
+			UTILS_WriterAppendUint(&writer, (uint32_t)values[i]);
+			break;
+		case BENCH_FIELD_UINT64:
+			UTILS_WriterAppendUint64(&writer, wide);
+			break;
+		case BENCH_FIELD_INT64:
+			UTILS_WriterAppendInt64(&writer, (int64_t)values[i] << 31);
+			break;
+		case BENCH_FIELD_HEX64:
+			UTILS_WriterAppendHex64(&writer, wide);
+			break;
+		case BENCH_FIELD_BIN:
+			UTILS_WriterAppendBin(&writer, (uint32_t)values[i]);
+			break;
+		case BENCH_FIELD_OCT:
+			UTILS_WriterAppendOct(&writer, (uint32_t)values[i]);
+			break;
+		case BENCH_FIELD_FLOAT:
+			UTILS_WriterAppendFloat(&writer, (float)values[i] / 1024.0f,
+			                        UTILS_FLOAT_FIXED);
+			break;
+		case BENCH_FIELD_FIXED:
+			UTILS_WriterAppendFixed(&writer, values[i], UTILS_Q16_16, 4);
+			break;
+		default:
+			UTILS_WriterAppendFormat(&writer, "%d", (int)values[i]);
+			break;
+		}
+		UTILS_WriterAppendChar(&writer, ',');
+	}
+	UTILS_WriterFinish(&writer, &size);
+	return size;
+}
+
+/* The same record with the one-shot conversions */
+static uint32_t convertFields(const int32_t* values)
+{
+	uint32_t size = 0;
+	for(int i = 0; i < BENCH_WRITER_FIELDS; i++)
+	{
+		uint32_t left = sizeof(record) - size;
+		uint8_t length = left > BENCH_WRITER_FIELD_MAX ?
+		                 BENCH_WRITER_FIELD_MAX : (uint8_t)left;
+		uint64_t wide = (uint64_t)(uint32_t)values[i] << 31;
+		uint32_t written;
+		switch(field)
+		{
+		case BENCH_FIELD_STRING:
+			written = (uint32_t)strlen(words[values[i] & 7]);
+			memcpy(&record[size], words[values[i] & 7], written + 1);
+			break;
+		case BENCH_FIELD_UINT:
+			UTILS_Int2AsciiString64((uint32_t)values[i], &record[size], length);
+			break;
+		case BENCH_FIELD_UINT64:
+			UTILS_Int2AsciiString64((int64_t)wide, &record[size], length);
+			break;
+		case BENCH_FIELD_INT64:
+			UTILS_Int2AsciiString64((int64_t)values[i] << 31, &record[size],
+			                        length);
+			break;
+		case BENCH_FIELD_HEX64:
+			UTILS_Uint2Hex64(wide, &record[size], length);
+			break;
+		case BENCH_FIELD_BIN:
+			UTILS_Uint2Bin((uint32_t)values[i], &record[size], length);
+			break;
+		case BENCH_FIELD_OCT:
+			UTILS_Uint2Oct((uint32_t)values[i], &record[size], length);
+			break;
+		case BENCH_FIELD_FLOAT:
+			UTILS_Float2AsciiShortest((float)values[i] / 1024.0f,
+			                          UTILS_FLOAT_FIXED, &record[size], length);
+			break;
+		case BENCH_FIELD_FIXED:
+			UTILS_Fixed2AsciiString(values[i], UTILS_Q16_16, 4, &record[size],
+			                        length);
+			break;
+		default:
+			UTILS_Format(&record[size], length, "%d", (int)values[i]);
+			break;
+		}
+		if(field != BENCH_FIELD_STRING)
+		{
+			UTILS_GetSizeOfAsciiString(&record[size], &written);
+		}
+		size += written;
+		record[size++] = ',';
+	}
+	record[size] = 0x00;
+	return size;
+}
+
+/* Whole record as bytes, hex and Base64 strings of 400 bytes */
+static uint32_t writeBytesHex(const int32_t* values)
+{
+	UTILS_WRITER writer;
+	uint32_t size;
+	UTILS_WriterInit(&writer, record, sizeof(record));
+	UTILS_WriterAppendBytesHex(&writer, (const uint8_t*)values,
+	                           BENCH_WRITER_FIELDS * sizeof(int32_t));
+	UTILS_WriterFinish(&writer, &size);
+	return size;
+}
+
+static uint32_t convertBytesHex(const int32_t* values)
+{
+	UTILS_BytesToHex((const uint8_t*)values,
+	                 BENCH_WRITER_FIELDS * sizeof(int32_t), record,
+	                 sizeof(record));
+	return 2 * BENCH_WRITER_FIELDS * sizeof(int32_t);
+}
+
+static uint32_t writeBase64(const int32_t* values)
+{
+	UTILS_WRITER writer;
+	uint32_t size;
+	UTILS_WriterInit(&writer, record, sizeof(record));
+	UTILS_WriterAppendBase64(&writer, (const uint8_t*)values,
+	                         BENCH_WRITER_FIELDS * sizeof(int32_t),
+	                         UTILS_BASE64_STANDARD);
+	UTILS_WriterFinish(&writer, &size);
+	return size;
+}
+
+static uint32_t convertBase64(const int32_t* values)
+{
+	UTILS_BytesToBase64((const uint8_t*)values,
+	                    BENCH_WRITER_FIELDS * sizeof(int32_t),
+	                    UTILS_BASE64_STANDARD, record, sizeof(record));
+	return (BENCH_WRITER_FIELDS * sizeof(int32_t) + 2) / 3 * 4;
+}
+
+static void benchRecord(const char* name, uint32_t (*build)(const int32_t*))
+{
+	BENCH_Sample sample;
+	uint64_t bytes = 0;
+	const uint64_t ops = (uint64_t)BENCH_WRITER_RECORDS * BENCH_WRITER_ROUNDS;
+
+	BENCH_Start(&sample);
+	for(int round = 0; round < BENCH_WRITER_ROUNDS; round++)
+	{
+		for(int i = 0; i < BENCH_WRITER_RECORDS; i++)
+		{
+			bytes += build(fields[i]);
+			BENCH_KEEP(record[0]);
+		}
+	}
+	BENCH_Stop(&sample);
+	BENCH_Report(name, &sample, ops, bytes);
+}
+
+void BENCH_Writer(void)
+{
+	for(int i = 0; i < BENCH_WRITER_RECORDS; i++)
+	{
+		for(int j = 0; j < BENCH_WRITER_FIELDS; j++)
+		{
+			fields[i][j] = (int32_t)BENCH_Random() >> (BENCH_Random() & 31);
+		}
+	}
+	benchRecord("UTILS_Writer record of 100 fields", writeRecord);
+	benchRecord("Int2AsciiString + GetSize record", convertRecord);
+	benchRecord("snprintf record of 100 fields", printRecord);
+	for(field = 0; field < BENCH_FIELD_COUNT; field++)
+	{
+		benchRecord(fieldNames[field][0], writeFields);
+		benchRecord(fieldNames[field][1], convertFields);
+	}
+	benchRecord("UTILS_WriterAppendBytesHex record", writeBytesHex);
+	benchRecord("UTILS_BytesToHex record", convertBytesHex);
+	benchRecord("UTILS_WriterAppendBase64 record", writeBase64);
+	benchRecord("UTILS_BytesToBase64 record", convertBase64);
+}
@@ -1,5 +1,6 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
 #include <inttypes.h>
 
@@ -71,7 +72,7 @@ int main()
 
 	UTILS_ERROR error;
 	uint8_t digits;
-	char str[11];
+	char str[12];
 	int32_t number;
 
 	for (int i = 0; i < 10; i++) {
@@ -137,7 +138,34 @@ int main()
 		if(i%2)fp = fp * (-1.0);
 		UTILS_Float2AsciiString(fp,array,sizeof(array));
 		printf("Float point %4.4f value converted to ASCII string \"%s\"\n",fp,array);
-		for(int i=0;i<10;i++)array[i] = 0x00;
+		for(int i=0;i<(int)sizeof(array);i++)array[i] = 0x00;
 	}
-
+	printf("[TEST] Flags of unsigned conversion in formatted string \n");
+	{
+		const char* formats[] = {"%+u", "% u", "%+5u", "% -5u|"};
+		for(int i=0;i<(int)(sizeof(formats)/sizeof(formats[0]));i++)
+		{
+			char text[16];
+			char expected[16];
+			UTILS_Format(text,sizeof(text),formats[i],5u);
+			snprintf(expected,sizeof(expected),formats[i],5u);
+			printf("Format \"%s\" of 5 gives \"%s\", expected \"%s\": %s\n",
+			       formats[i],text,expected,
+			       strcmp(text,expected) ? "FAIL" : "PASS");
+		}
+	}
+#if defined(UTILS_STATS)
+	printf("[TEST] Call statistics of the library \n");
+	{
+		static UTILS_STATS_SNAPSHOT stats;
+		UTILS_StatsSnapshot(&stats);
+		for(int function=0;function<UTILS_STATS_FUNCTIONS;function++)
+		{
+			if(stats.calls[function] == 0) continue;
+			printf("Function %2d: %" PRIu64 " calls, %" PRIu64 " failed conversions\n",
+			       function, stats.calls[function],
+			       stats.errors[function][ERROR_CONVERSION_FAIL]);
+		}
+	}
+#endif
 }
@@ -30,6 +30,11 @@
 #define INC_UTILS_H_
 
 #include "inttypes.h"
+#include "stdarg.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
 
 typedef enum
 {
@@ -39,6 +44,307 @@ typedef enum
 	ERROR_FAIL              = 0x03,
 }UTILS_ERROR;
 
+typedef enum
+{
+	UTILS_FLOAT_FIXED       = 0x00,
+	UTILS_FLOAT_SCIENTIFIC  = 0x01,
+}UTILS_FLOAT_NOTATION;
+
+typedef enum
+{
+	UTILS_LITTLE_ENDIAN     = 0x00,
+	UTILS_BIG_ENDIAN        = 0x01,
+}UTILS_BYTE_ORDER;
+
+typedef enum
+{
+	UTILS_BASE64_STANDARD   = 0x00,
+	UTILS_BASE64_URL        = 0x01,
+}UTILS_BASE64_ALPHABET;
+
+/* With UTILS_HEADER_ONLY the trivial conversions (declared with UTILS_INLINE)
+ * are static inline definitions of utils_inline.h instead of calls to the
+ * library. The library itself is always built with external definitions. */
+#if defined(UTILS_HEADER_ONLY) && !defined(UTILS_BUILD)
+#define UTILS_INLINE    static inline
+#else
+#define UTILS_INLINE
+#endif
+
+/* Arguments of UTILS_Format() are checked against the format as of printf */
+#if defined(__GNUC__)
+#define UTILS_PRINTF_FORMAT(string, first)  __attribute__((format(printf, string, first)))
+#else
+#define UTILS_PRINTF_FORMAT(string, first)
+#endif
+
+/* Speed and footprint profile of the library, selected when it is built with
+ * -DUTILS_PROFILE_TINY, -DUTILS_PROFILE_BALANCED or -DUTILS_PROFILE_FAST
+ * (default). It chooses implementation of the digit, hex and CRC kernels:
+ *
+ *            decimal digits    hex digits              CRC engines
+ * TINY       loop              loop                    bitwise
+ * BALANCED   pair table        nibble table, SIMD      bitwise, nibble
+ * FAST       pair table        byte table, SIMD        all
+ *
+ * The pair table of decimal digits with powers of ten takes 401 bytes, the
+ * nibble table of hex digits 17 bytes and the byte table 513 more. CRC
+ * tables are given by the caller, see UTILS_CrcInit(). Sizes of every
+ * profile are reported by 'make sizes'. */
+#if (defined(UTILS_PROFILE_TINY) + defined(UTILS_PROFILE_BALANCED) + \
+     defined(UTILS_PROFILE_FAST)) > 1
+#error "Only one of UTILS_PROFILE_TINY, UTILS_PROFILE_BALANCED and UTILS_PROFILE_FAST can be defined"
+#endif
+
+#define UTILS_IMPL_LOOP                 0
+#define UTILS_IMPL_NIBBLE               1
+#define UTILS_IMPL_TABLE                2
+
+#if defined(UTILS_PROFILE_TINY)
+#define UTILS_DIGITS_IMPL               UTILS_IMPL_LOOP
+#define UTILS_HEX_IMPL                  UTILS_IMPL_LOOP
+#define UTILS_CRC_IMPL                  UTILS_IMPL_LOOP
+#elif defined(UTILS_PROFILE_BALANCED)
+#define UTILS_DIGITS_IMPL               UTILS_IMPL_TABLE
+#define UTILS_HEX_IMPL                  UTILS_IMPL_NIBBLE
+#define UTILS_CRC_IMPL                  UTILS_IMPL_NIBBLE
+#else
+#define UTILS_DIGITS_IMPL               UTILS_IMPL_TABLE
+#define UTILS_HEX_IMPL                  UTILS_IMPL_TABLE
+#define UTILS_CRC_IMPL                  UTILS_IMPL_TABLE
+#endif
+
+/* Instrumented functions, see UTILS_StatsSnapshot() */
+typedef enum
+{
+	UTILS_STATS_UINT2BYTEARRAY       = 0,
+	UTILS_STATS_BYTEARRAY2UINT       = 1,
+	UTILS_STATS_UINT16ARRAYTOBYTES   = 2,
+	UTILS_STATS_UINT32ARRAYTOBYTES   = 3,
+	UTILS_STATS_UINT64ARRAYTOBYTES   = 4,
+	UTILS_STATS_BYTESTOUINT16ARRAY   = 5,
+	UTILS_STATS_BYTESTOUINT32ARRAY   = 6,
+	UTILS_STATS_BYTESTOUINT64ARRAY   = 7,
+	UTILS_STATS_SWAPBYTES16          = 8,
+	UTILS_STATS_SWAPBYTES32          = 9,
+	UTILS_STATS_SWAPBYTES64          = 10,
+	UTILS_STATS_GETSIZEOFASCIISTRING = 11,
+	UTILS_STATS_GETNUMBEROFDIGIT     = 12,
+	UTILS_STATS_GETNUMBEROFDIGIT64   = 13,
+	UTILS_STATS_ASCIIDIGIT2BYTE      = 14,
+	UTILS_STATS_BYTE2ASCIIDIGIT      = 15,
+	UTILS_STATS_ASCIISTRING2INT      = 16,
+	UTILS_STATS_PARSEINT32LIST       = 17,
+	UTILS_STATS_INT2ASCIISTRING      = 18,
+	UTILS_STATS_INT2ASCIISTRING64    = 19,
+	UTILS_STATS_INT32ARRAYTOASCII    = 20,
+	UTILS_STATS_FLOAT2UINT           = 21,
+	UTILS_STATS_UINT2FLOAT           = 22,
+	UTILS_STATS_HEX2UINT             = 23,
+	UTILS_STATS_HEX2UINT64           = 24,
+	UTILS_STATS_UINT2HEX             = 25,
+	UTILS_STATS_UINT2HEX64           = 26,
+	UTILS_STATS_BYTESTOHEX           = 27,
+	UTILS_STATS_HEXTOBYTES           = 28,
+	UTILS_STATS_FLOAT2HEX            = 29,
+	UTILS_STATS_FLOAT2ASCIISTRING    = 30,
+	UTILS_STATS_FLOAT2ASCIISHORTEST  = 31,
+	UTILS_STATS_ASCIISTRING2FLOAT    = 32,
+	UTILS_STATS_BASE64INIT           = 33,
+	UTILS_STATS_BASE64ENCODEUPDATE   = 34,
+	UTILS_STATS_BASE64ENCODEFINAL    = 35,
+	UTILS_STATS_BASE64DECODEUPDATE   = 36,
+	UTILS_STATS_BASE64DECODEFINAL    = 37,
+	UTILS_STATS_BYTESTOBASE64        = 38,
+	UTILS_STATS_BASE64TOBYTES        = 39,
+	UTILS_STATS_HEXDUMPSIZE          = 40,
+	UTILS_STATS_HEXDUMP              = 41,
+	UTILS_STATS_FIXED2ASCIISTRING    = 42,
+	UTILS_STATS_ASCIISTRING2FIXED    = 43,
+	UTILS_STATS_UINT2BIN             = 44,
+	UTILS_STATS_BIN2UINT             = 45,
+	UTILS_STATS_UINT2OCT             = 46,
+	UTILS_STATS_OCT2UINT             = 47,
+	UTILS_STATS_UINT32ARRAYTOBIN     = 48,
+	UTILS_STATS_UINT32ARRAYTOOCT     = 49,
+	UTILS_STATS_WRITERINIT           = 50,
+	UTILS_STATS_WRITERAPPENDCHAR     = 51,
+	UTILS_STATS_WRITERAPPENDSTRING   = 52,
+	UTILS_STATS_WRITERAPPENDINT      = 53,
+	UTILS_STATS_WRITERAPPENDUINT     = 54,
+	UTILS_STATS_WRITERAPPENDINT64    = 55,
+	UTILS_STATS_WRITERAPPENDUINT64   = 56,
+	UTILS_STATS_WRITERAPPENDHEX      = 57,
+	UTILS_STATS_WRITERAPPENDHEX64    = 58,
+	UTILS_STATS_WRITERAPPENDBIN      = 59,
+	UTILS_STATS_WRITERAPPENDOCT      = 60,
+	UTILS_STATS_WRITERAPPENDFLOAT    = 61,
+	UTILS_STATS_WRITERAPPENDFIXED    = 62,
+	UTILS_STATS_WRITERAPPENDBYTESHEX = 63,
+	UTILS_STATS_WRITERAPPENDBASE64   = 64,
+	UTILS_STATS_WRITERFINISH         = 65,
+	UTILS_STATS_FORMAT               = 66,
+	UTILS_STATS_FORMATV              = 67,
+	UTILS_STATS_WRITERAPPENDFORMAT   = 68,
+	UTILS_STATS_SCANNERINIT          = 69,
+	UTILS_STATS_SCANNERNEXTINT       = 70,
+	UTILS_STATS_SCANNERNEXTHEX       = 71,
+	UTILS_STATS_SCANNERNEXTFLOAT     = 72,
+	UTILS_STATS_SCANNERSKIPUNTIL     = 73,
+	UTILS_STATS_SCANNEREXPECT        = 74,
+	UTILS_STATS_CRCINIT              = 75,
+	UTILS_STATS_CRCRESET             = 76,
+	UTILS_STATS_CRCUPDATE            = 77,
+	UTILS_STATS_CRCFINAL             = 78,
+	UTILS_STATS_UINT32TOVARINT       = 79,
+	UTILS_STATS_UINT64TOVARINT       = 80,
+	UTILS_STATS_INT32TOVARINT        = 81,
+	UTILS_STATS_INT64TOVARINT        = 82,
+	UTILS_STATS_VARINTTOUINT32       = 83,
+	UTILS_STATS_VARINTTOUINT64       = 84,
+	UTILS_STATS_VARINTTOINT32        = 85,
+	UTILS_STATS_VARINTTOINT64        = 86,
+	UTILS_STATS_UINT32ARRAYTOVARINTS = 87,
+	UTILS_STATS_UINT64ARRAYTOVARINTS = 88,
+	UTILS_STATS_INT32ARRAYTOVARINTS  = 89,
+	UTILS_STATS_INT64ARRAYTOVARINTS  = 90,
+	UTILS_STATS_VARINTSTOUINT32ARRAY = 91,
+	UTILS_STATS_VARINTSTOUINT64ARRAY = 92,
+	UTILS_STATS_VARINTSTOINT32ARRAY  = 93,
+	UTILS_STATS_VARINTSTOINT64ARRAY  = 94,
+	UTILS_STATS_FLOATARRAYTOHALF     = 95,
+	UTILS_STATS_HALFTOFLOATARRAY     = 96,
+	UTILS_STATS_FLOATARRAYTOBFLOAT16 = 97,
+	UTILS_STATS_BFLOAT16TOFLOATARRAY = 98,
+	UTILS_STATS_FUNCTIONS            = 99,
+}UTILS_STATS_FUNCTION;
+
+/* Latency bucket 'b' counts calls which took [2^b, 2^(b+1)) cycles,
+ * the first one starts with 0 and the last one has no upper limit */
+#define UTILS_STATS_LATENCY_BUCKETS     16
+#define UTILS_STATS_ERRORS              (ERROR_FAIL + 1)
+
+typedef struct
+{
+	uint64_t calls[UTILS_STATS_FUNCTIONS];
+	uint64_t errors[UTILS_STATS_FUNCTIONS][UTILS_STATS_ERRORS];
+	uint64_t latency[UTILS_STATS_FUNCTIONS][UTILS_STATS_LATENCY_BUCKETS];
+}UTILS_STATS_SNAPSHOT;
+
+/* Decimal digits of int32_t without sign, e.g. 2147483647 */
+#define UTILS_INT_MAX_DIGITS            10
+
+/* Longest float ASCII string ("-0.", 44 zeros and digit) with NULL */
+#define UTILS_FLOAT_STRING_MAX_SIZE     49
+
+/* Base64 characters of 'size' bytes with padding, and bytes of 'length'
+ * characters at most */
+#define UTILS_BASE64_ENCODED_SIZE(size)     ((((size) + 2) / 3) * 4)
+#define UTILS_BASE64_DECODED_SIZE(length)   ((((length) + 3) / 4) * 3)
+
+/* State of streaming Base64 codec, the fields are private */
+typedef struct
+{
+	uint8_t pending[4];
+	uint8_t count;
+	uint8_t padding;
+	uint8_t finished;
+	uint8_t alphabet;
+}UTILS_BASE64_STREAM;
+
+/* Layout of UTILS_HexDump(), NULL options give {16, 8, 8, 1} */
+typedef struct
+{
+	uint8_t bytesPerLine;   /* 1..255 */
+	uint8_t groupSize;      /* extra space after every group, 0 - none */
+	uint8_t offsetDigits;   /* 0..16, 0 - without offset column */
+	uint8_t ascii;          /* non 0 - column of printable characters */
+}UTILS_HEXDUMP_OPTIONS;
+
+/* Fixed-point format: width of the value with sign and fraction bits */
+#define UTILS_FIXED_FORMAT(width, fraction)  ((uint16_t)(((width) << 8) | (fraction)))
+#define UTILS_Q15                       UTILS_FIXED_FORMAT(16, 15)
+#define UTILS_Q31                       UTILS_FIXED_FORMAT(32, 31)
+#define UTILS_Q16_16                    UTILS_FIXED_FORMAT(32, 16)
+
+/* Fraction digits of UTILS_Fixed2AsciiString(), enough for exact Q31 */
+#define UTILS_FIXED_MAX_DECIMALS        31
+
+/* Longest fixed-point ASCII string ("-2147483648." and 31 digits) with NULL */
+#define UTILS_FIXED_STRING_MAX_SIZE     44
+
+/* Decimals of %f conversion of UTILS_Format() */
+#define UTILS_FORMAT_MAX_PRECISION      12
+
+/* Writer of characters, see UTILS_WriterInit(). The text is
+ * buffer[0..cursor), overflow is set by the first append which does not fit */
+typedef struct
+{
+	char* buffer;
+	uint32_t capacity;
+	uint32_t cursor;
+	uint8_t overflow;
+}UTILS_WRITER;
+
+/* Scanner of characters, see UTILS_ScannerInit(). The characters which are
+ * left are buffer[cursor..length) */
+typedef struct
+{
+	const char* buffer;
+	uint32_t length;
+	uint32_t cursor;
+}UTILS_SCANNER;
+
+/* CRC model in the notation of the CRC catalogue: polynomial without the
+ * top bit, init and xorOut as the CRC value, the same bit order of data
+ * and CRC (reflected - LSB first) */
+typedef struct
+{
+	uint8_t width;          /* 8, 16 or 32 */
+	uint8_t reflected;
+	uint32_t polynomial;
+	uint32_t init;
+	uint32_t xorOut;
+}UTILS_CRC_MODEL;
+
+/* Initializers of UTILS_CRC_MODEL, CRC of "123456789" is given for check */
+#define UTILS_CRC8_MODEL            {8, 0, 0x07, 0x00, 0x00}                    /* 0xF4 */
+#define UTILS_CRC16_CCITT_MODEL     {16, 0, 0x1021, 0xFFFF, 0x0000}             /* 0x29B1 */
+#define UTILS_CRC16_MODBUS_MODEL    {16, 1, 0x8005, 0xFFFF, 0x0000}             /* 0x4B37 */
+#define UTILS_CRC32_MODEL           {32, 1, 0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF} /* 0xCBF43926 */
+#define UTILS_CRC32C_MODEL          {32, 1, 0x1EDC6F41, 0xFFFFFFFF, 0xFFFFFFFF} /* 0xE3069283 */
+
+typedef enum
+{
+	UTILS_CRC_BITWISE       = 0x00,
+	UTILS_CRC_NIBBLE        = 0x01,
+	UTILS_CRC_SLICING8      = 0x02,
+	UTILS_CRC_CLMUL         = 0x03,
+}UTILS_CRC_ENGINE;
+
+/* Entries of uint32_t table of UTILS_CrcInit() per engine */
+#define UTILS_CRC_NIBBLE_TABLE_SIZE     16
+#define UTILS_CRC_SLICING8_TABLE_SIZE   (8 * 256)
+
+/* CRC engine and register of frame, see UTILS_CrcInit(), the fields are
+ * private */
+typedef struct
+{
+	const uint32_t* table;
+	uint64_t fold[8];
+	uint32_t polynomial;
+	uint32_t init;
+	uint32_t xorOut;
+	uint32_t value;
+	uint8_t width;
+	uint8_t reflected;
+	uint8_t engine;
+}UTILS_CRC;
+
+/* Maximum number of bytes of varint of 32 and 64-bit value */
+#define UTILS_VARINT32_MAX_SIZE     5
+#define UTILS_VARINT64_MAX_SIZE     10
+
 /**
 * @brief    Convert unsigned integer variable to byte array of size of four.
 * @note     The minimum size of byteArray must be bigger then 4
@@ -48,7 +354,7 @@ typedef enum
 *    ERROR_NULL_POINTER    - byteArray is equal null
 *    ERROR_SUCCESS         - conversion executed without errors
 */
-UTILS_ERROR UTILS_Uint2ByteArray(uint32_t integer, uint8_t* byteArray);
+UTILS_INLINE UTILS_ERROR UTILS_Uint2ByteArray(uint32_t integer, uint8_t* byteArray);
 
 /**
 * @brief    Convert array of four bytes to unsigned integer
@@ -59,7 +365,186 @@ UTILS_ERROR UTILS_Uint2ByteArray(uint32_t integer, uint8_t* byteArray);
 *     ERROR_NULL_POINTER    - byteArray or integer are equals null
 *     ERROR_SUCCES          - conversion executed without errors
 */
-UTILS_ERROR UTILS_ByteArray2Uint(uint8_t* byteArray, uint32_t* integer);
+UTILS_INLINE UTILS_ERROR UTILS_ByteArray2Uint(uint8_t* byteArray, uint32_t* integer);
+
+/**
+ * @brief    Convert array of 16-bit values to bytes in selected byte order
+ *
+ * Every value takes two bytes, so 'size' of 'bytes' must be at least two
+ * times 'count'. The 'bytes' buffer can be the same memory as 'values'
+ * (in-place conversion), but the buffers must not partially overlap.
+ *
+ * @param[in]    values:    array of values
+ * @param[in]    count:     number of values
+ * @param[in]    order:     byte order of the result
+ * @param[out]   bytes:     conversion result
+ * @param[in]    size:      size of bytes buffer
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to values or bytes is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible.
+ *                                 bytes buffer is too small or order is wrong
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_Uint16ArrayToBytes(const uint16_t* values, uint32_t count,
+                                     UTILS_BYTE_ORDER order,
+                                     uint8_t* bytes, uint32_t size);
+
+/**
+ * @brief    Convert array of 32-bit values to bytes in selected byte order
+ *
+ * Every value takes four bytes, so 'size' of 'bytes' must be at least four
+ * times 'count'. The 'bytes' buffer can be the same memory as 'values'
+ * (in-place conversion), but the buffers must not partially overlap.
+ *
+ * @param[in]    values:    array of values
+ * @param[in]    count:     number of values
+ * @param[in]    order:     byte order of the result
+ * @param[out]   bytes:     conversion result
+ * @param[in]    size:      size of bytes buffer
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to values or bytes is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible.
+ *                                 bytes buffer is too small or order is wrong
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_Uint32ArrayToBytes(const uint32_t* values, uint32_t count,
+                                     UTILS_BYTE_ORDER order,
+                                     uint8_t* bytes, uint32_t size);
+
+/**
+ * @brief    Convert array of 64-bit values to bytes in selected byte order
+ *
+ * Every value takes eight bytes, so 'size' of 'bytes' must be at least eight
+ * times 'count'. The 'bytes' buffer can be the same memory as 'values'
+ * (in-place conversion), but the buffers must not partially overlap.
+ *
+ * @param[in]    values:    array of values
+ * @param[in]    count:     number of values
+ * @param[in]    order:     byte order of the result
+ * @param[out]   bytes:     conversion result
+ * @param[in]    size:      size of bytes buffer
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to values or bytes is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible.
+ *                                 bytes buffer is too small or order is wrong
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_Uint64ArrayToBytes(const uint64_t* values, uint32_t count,
+                                     UTILS_BYTE_ORDER order,
+                                     uint8_t* bytes, uint32_t size);
+
+/**
+ * @brief    Convert bytes in selected byte order to array of 16-bit values
+ *
+ * All 'size' bytes are converted, so 'size' must be even and 'count' of
+ * 'values' must be at least half of 'size'. The 'values' array can be the
+ * same memory as 'bytes', but the buffers must not partially overlap.
+ *
+ * @param[in]    bytes:     buffer of values in 'order'
+ * @param[in]    size:      number of bytes to convert
+ * @param[in]    order:     byte order of the bytes buffer
+ * @param[out]   values:    conversion result
+ * @param[in]    count:     number of values in values array
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to bytes or values is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible. Size is not
+ *                                 a multiple of value, values array is too
+ *                                 small or order is wrong
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_BytesToUint16Array(const uint8_t* bytes, uint32_t size,
+                                     UTILS_BYTE_ORDER order,
+                                     uint16_t* values, uint32_t count);
+
+/**
+ * @brief    Convert bytes in selected byte order to array of 32-bit values
+ *
+ * All 'size' bytes are converted, so 'size' must be a multiple of four and
+ * 'count' of 'values' must be at least quarter of 'size'. The 'values' array
+ * can be the same memory as 'bytes', but the buffers must not partially
+ * overlap.
+ *
+ * @param[in]    bytes:     buffer of values in 'order'
+ * @param[in]    size:      number of bytes to convert
+ * @param[in]    order:     byte order of the bytes buffer
+ * @param[out]   values:    conversion result
+ * @param[in]    count:     number of values in values array
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to bytes or values is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible. Size is not
+ *                                 a multiple of value, values array is too
+ *                                 small or order is wrong
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_BytesToUint32Array(const uint8_t* bytes, uint32_t size,
+                                     UTILS_BYTE_ORDER order,
+                                     uint32_t* values, uint32_t count);
+
+/**
+ * @brief    Convert bytes in selected byte order to array of 64-bit values
+ *
+ * All 'size' bytes are converted, so 'size' must be a multiple of eight and
+ * 'count' of 'values' must be at least one eighth of 'size'. The 'values'
+ * array can be the same memory as 'bytes', but the buffers must not
+ * partially overlap.
+ *
+ * @param[in]    bytes:     buffer of values in 'order'
+ * @param[in]    size:      number of bytes to convert
+ * @param[in]    order:     byte order of the bytes buffer
+ * @param[out]   values:    conversion result
+ * @param[in]    count:     number of values in values array
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to bytes or values is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible. Size is not
+ *                                 a multiple of value, values array is too
+ *                                 small or order is wrong
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_BytesToUint64Array(const uint8_t* bytes, uint32_t size,
+                                     UTILS_BYTE_ORDER order,
+                                     uint64_t* values, uint32_t count);
+
+/**
+ * @brief    Reverse byte order of every value in 16-bit array (in place)
+ *
+ * @param[in,out]    values:    array of values
+ * @param[in]        count:     number of values
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to values is NULL
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_SwapBytes16(uint16_t* values, uint32_t count);
+
+/**
+ * @brief    Reverse byte order of every value in 32-bit array (in place)
+ *
+ * @param[in,out]    values:    array of values
+ * @param[in]        count:     number of values
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to values is NULL
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_SwapBytes32(uint32_t* values, uint32_t count);
+
+/**
+ * @brief    Reverse byte order of every value in 64-bit array (in place)
+ *
+ * @param[in,out]    values:    array of values
+ * @param[in]        count:     number of values
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to values is NULL
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_SwapBytes64(uint64_t* values, uint32_t count);
 
 /**
  * @brief    Get size of ASCII sting
@@ -85,10 +570,21 @@ UTILS_ERROR UTILS_GetSizeOfAsciiString(char* string, uint32_t* size);
  * @return Utils error:
  *     ERROR_NULL_POINTER    - digits pointer is equal null
  *     ERROR_SUCCESS         - function executed without errors
- *     ERROR_FAIL            - general error
  */
 UTILS_ERROR UTILS_GetNumberOfDigit(int32_t number,uint8_t* digits);
 
+/**
+ * @brief    Get number of digits in 64-bit integer value
+ *
+ * @param[in]    number:    an integer value to calculate the number of digits
+ * @param[out]   digits:    number of digits
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER    - digits pointer is equal null
+ *     ERROR_SUCCESS         - function executed without errors
+ */
+UTILS_ERROR UTILS_GetNumberOfDigit64(int64_t number, uint8_t* digits);
+
 /**
  * @brief    Convert single ASCII character to digit
  *
@@ -105,7 +601,7 @@ UTILS_ERROR UTILS_GetNumberOfDigit(int32_t number,uint8_t* digits);
  *                                 ASCII character is not a digit.
  *     ERROR_SUCCESS             - conversion executed without errors
  */
-UTILS_ERROR UTILS_AsciiDigit2Byte(char ascii, uint8_t* byte);
+UTILS_INLINE UTILS_ERROR UTILS_AsciiDigit2Byte(char ascii, uint8_t* byte);
 
 /**
  * @brief    Convert byte with range <0..9> to ASCII digit
@@ -119,7 +615,7 @@ UTILS_ERROR UTILS_AsciiDigit2Byte(char ascii, uint8_t* byte);
  *                                 Byte is out of range
  *     ERROR_SUCCESS             - conversion executed without errors
  */
-UTILS_ERROR UTILS_Byte2AsciiDigit(uint8_t byte, char* ascii);
+UTILS_INLINE UTILS_ERROR UTILS_Byte2AsciiDigit(uint8_t byte, char* ascii);
 
 /**
  * @brief    Convert ASCII string to 32-bit integer value with sign
@@ -136,19 +632,51 @@ UTILS_ERROR UTILS_Byte2AsciiDigit(uint8_t byte, char* ascii);
  * @return Utils error:
  *     ERROR_NULL_POINTER        - pointer to string or integer is NULL
  *     ERROR_CONVERSION_FAIL     - conversion is not possible.
- *                                 ASCII string is too long
+ *                                 ASCII string is too long, empty, has
+ *                                 not a digit or value is out of range
  *     ERROR_SUCCESS             - conversion executed without errors
  *     ERROR_FAIL                - general error‬
  */
 UTILS_ERROR UTILS_AsciiString2Int(char* string, int32_t* integer);
 
+/**
+ * @brief    Parse delimited list of integers
+ *
+ * Every token must be a decimal integer with an optional '+' or '-' sign,
+ * in range of int32_t. Tokens are split by one or more characters from the
+ * 'delimiters' string (e.g. ",; \t\r\n"), which must not contain digits or
+ * signs. Delimiters at the beginning and at the end of buffer are allowed.
+ * The buffer is read up to 'length' characters and does not need NULL.
+ *
+ * @param[in]    buffer:       text with list of integers
+ * @param[in]    length:       number of characters in buffer
+ * @param[in]    delimiters:   NULL terminated string of delimiter characters
+ * @param[out]   integers:     array for parsed values
+ * @param[in]    maxCount:     size of integers array
+ * @param[out]   count:        number of parsed values
+ * @param[out]   position:     position of the first wrong character, or
+ *                             'length' when all buffer was parsed
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to buffer, delimiters, integers,
+ *                                 count or position is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible. There is not
+ *                                 allowed character, value out of range or
+ *                                 more values than 'maxCount' at 'position'
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_ParseInt32List(const char* buffer, uint32_t length,
+                                 const char* delimiters, int32_t* integers,
+                                 uint32_t maxCount, uint32_t* count,
+                                 uint32_t* position);
+
 /**
  * @brief    Convert integer value to ASCII character string
  *
  * The 'string' must have allocated memory for a number with a minimum 'length'
  * equal to the number of digits in the 'integer' value plus the character sign
  * (if a value of 'integer' is negative). If the size of number is unknown
- * that is safe to use UTILS_INT_MAX_DIGITS to allocate 'string' array.
+ * that is safe to allocate 11 characters for the 'string' array.
  * All empty bytes will be set as NULL.
  *
  * @param[in]    integer:    integer value to be converted to ASCII string
@@ -160,10 +688,59 @@ UTILS_ERROR UTILS_AsciiString2Int(char* string, int32_t* integer);
  *     ERROR_CONVERSION_FAIL     - conversion is not possible.
  *                                 Length of string is too small.
  *     ERROR_SUCCESS             - conversion executed without errors
- *     ERROR_FAIL                - general error
  */
 UTILS_ERROR UTILS_Int2AsciiString(int32_t integer, char* string, uint8_t length);
 
+/**
+ * @brief    Convert 64-bit integer value to ASCII character string
+ *
+ * The 'string' must have allocated memory for a number with a minimum 'length'
+ * equal to the number of digits in the 'integer' value plus the character sign
+ * (if a value of 'integer' is negative). If the size of number is unknown
+ * that is safe to allocate 20 characters for the 'string' array.
+ * All empty bytes will be set as NULL.
+ *
+ * @param[in]    integer:    integer value to be converted to ASCII string
+ * @param[out]   string:     ASCII string of integer value
+ * @param[in]    length:     length of string (before conversion)
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to string is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible.
+ *                                 Length of string is too small.
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_Int2AsciiString64(int64_t integer, char* string,
+                                    uint8_t length);
+
+/**
+ * @brief    Convert array of integer values to ASCII character string
+ *
+ * Values are written one after another and split by 'separator' (there is no
+ * separator after the last value). Each value takes exactly the number of its
+ * digits plus the character sign, so the whole 'string' can be allocated as
+ * 'count' * (UTILS_INT_MAX_DIGITS + 2). The terminating NULL is written when
+ * there is space left, but it is not counted in 'written'.
+ *
+ * @param[in]    integers:    array of integer values to be converted
+ * @param[in]    count:       number of values in 'integers' array
+ * @param[in]    separator:   character put between two values
+ * @param[out]   string:      ASCII string of integer values
+ * @param[in]    length:      length of string (before conversion)
+ * @param[out]   written:     number of characters written to string
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to integers, string or written
+ *                                 is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible.
+ *                                 Length of string is too small. 'written'
+ *                                 holds characters of values converted so far
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_Int32ArrayToAscii(const int32_t* integers, uint32_t count,
+                                    char separator, char* string,
+                                    uint32_t length, uint32_t* written);
+
 /**
  * @brief    Get the physical byting form of the floating point variable
  *
@@ -174,7 +751,7 @@ UTILS_ERROR UTILS_Int2AsciiString(int32_t integer, char* string, uint8_t length)
  *     ERROR_NULL_POINTER        - pointer to integer is NULL
  *     ERROR_SUCCESS             - conversion executed without errors
  */
-UTILS_ERROR UTILS_Float2Uint(float fp, uint32_t* integer);
+UTILS_INLINE UTILS_ERROR UTILS_Float2Uint(float fp, uint32_t* integer);
 
 /**
  * @brief    Transform binary form to floating precision
@@ -187,26 +764,46 @@ UTILS_ERROR UTILS_Float2Uint(float fp, uint32_t* integer);
  *                                  variable is NULL
  *     ERROR_SUCCESS             - conversion executed without errors
  */
-UTILS_ERROR UTILS_Uint2Float(uint32_t integer, float* fp);
+UTILS_INLINE UTILS_ERROR UTILS_Uint2Float(uint32_t integer, float* fp);
 
 /**
  * @brief    Convert hexadecimal string to unsigned integer
  *
  * Hexadecimal string can has "0x" and "x" on the beginning. However, all string
  * must consist only hex characters just like: 0,1,2,3,4,5,6,7,8,9,A,B,C,D,E,F
- * and also: a,b,c,d,e,f.
+ * and also: a,b,c,d,e,f. There must be at least one digit and no more than
+ * 8 significant digits (leading zeros are not counted).
  *
  * @param[in]    hex:        hexadecimal string
  * @param[out]   integer:    conversion result
  *
  * @return Utils error:
- *     ERROR_NULL_POINTER        - pointer to hex is NULL
+ *     ERROR_NULL_POINTER        - pointer to hex or integer is NULL
  *     ERROR_CONVERSION_FAIL     - conversion is not possible.
- *                                 In hex string is not allowed character
+ *                                 In hex string is not allowed character,
+ *                                 there is no digit or value is too big
  *     ERROR_SUCCESS             - conversion executed without errors
  */
 UTILS_ERROR UTILS_Hex2Uint(char* hex, uint32_t* integer);
 
+/**
+ * @brief    Convert hexadecimal string to 64-bit unsigned integer
+ *
+ * The rules are the same as for UTILS_Hex2Uint(), but the string can have
+ * up to 16 significant digits.
+ *
+ * @param[in]    hex:        hexadecimal string
+ * @param[out]   integer:    conversion result
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to hex or integer is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible.
+ *                                 In hex string is not allowed character,
+ *                                 there is no digit or value is too big
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_Hex2Uint64(char* hex, uint64_t* integer);
+
 /**
  * @brief    Convert integer to hexadecimal string
  *
@@ -229,43 +826,1683 @@ UTILS_ERROR UTILS_Hex2Uint(char* hex, uint32_t* integer);
 UTILS_ERROR UTILS_Uint2Hex(uint32_t integer, char* hex, uint8_t length);
 
 /**
- * @brief    Convert float position variable to hexadecimal ASCII string
+ * @brief    Convert 64-bit integer to hexadecimal string
  *
- * The minimum of 'hex' string must be 10 (Number of max. digit in hex format
- * plus '0x' prefix) or greater.
+ * The rules are the same as for UTILS_Uint2Hex(). If value of integer is not
+ * known, allocate size of 'hex' as 16 digits + 2('0x') characters.
  *
- * @param[in]    fp:        floating point value
- * @param[out]   hex:       pointer to hexadecimal string
- * @param[in]    length:    length of string (before conversion)
+ * @param[in]    integer:    integer value to be converted to hexadecimal string
+ * @param[out]   hex:        hexadecimal string
+ * @param[in]    length:     length of hex string (before conversion)
  *
  * @return Utils error:
  *     ERROR_NULL_POINTER        - pointer to hex is NULL
  *     ERROR_CONVERSION_FAIL     - conversion is not possible.
- *                                 Length of hex is too short
- *     ERROR_FAIL                - general error
+ *                                 length of hex is too short.
  *     ERROR_SUCCESS             - conversion executed without errors
  */
-UTILS_ERROR UTILS_Float2Hex(float fp, char* hex, uint8_t length);
+UTILS_ERROR UTILS_Uint2Hex64(uint64_t integer, char* hex, uint8_t length);
 
 /**
- * @brief    Convert float position variable to digits ASCII string
+ * @brief    Convert byte buffer to hexadecimal ASCII string
  *
- * Length of 'ascii' array should be adequate to size of floating point 'fp'.
- * This means that this function returns an error if the size of the integer
- * "fp" does not fit in the array. Otherwise, the "ascii" array will be filled
- *  with decimal digits to the end or set the rest of the cell to 0.
+ * Every byte is converted to two upper case hexadecimal characters, without
+ * "0x" prefix, so 'length' of 'hex' must be at least two times 'size'.
+ * The terminating NULL is written when there is space left.
  *
- * @param[in]    fp:        floating point value
- * @param[out]   ascii:     pointer to ascii array
- * @param[in]    length:    length of string (before conversion)
+ * @param[in]    bytes:     buffer to convert
+ * @param[in]    size:      number of bytes in buffer
+ * @param[out]   hex:       hexadecimal string
+ * @param[in]    length:    length of hex string (before conversion)
  *
  * @return Utils error:
- *     ERROR_NULL_POINTER        - pointer to string is NULL
+ *     ERROR_NULL_POINTER        - pointer to bytes or hex is NULL
  *     ERROR_CONVERSION_FAIL     - conversion is not possible.
- *                                 length of ascii is too short
- *     ERROR_FAIL                - general error
+ *                                 length of hex is too short.
  *     ERROR_SUCCESS             - conversion executed without errors
  */
-UTILS_ERROR UTILS_Float2AsciiString(float fp, char* ascii, uint8_t length);
+UTILS_ERROR UTILS_BytesToHex(const uint8_t* bytes, uint32_t size,
+                             char* hex, uint32_t length);
+
+/**
+ * @brief    Convert hexadecimal ASCII string to byte buffer
+ *
+ * The 'hex' string must consist only of hexadecimal characters (upper and
+ * lower case) without "0x" prefix, and 'length' must be even. Two characters
+ * give one byte, so 'size' of 'bytes' must be at least half of 'length'.
+ *
+ * @param[in]    hex:       hexadecimal string
+ * @param[in]    length:    number of characters to convert
+ * @param[out]   bytes:     conversion result
+ * @param[in]    size:      size of bytes buffer
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to hex or bytes is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible. Length is odd,
+ *                                 bytes buffer is too small or in hex string
+ *                                 is not allowed character
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_HexToBytes(const char* hex, uint32_t length,
+                             uint8_t* bytes, uint32_t size);
+
+/**
+ * @brief    Get size of buffer for UTILS_HexDump()
+ *
+ * @param[in]    size:      number of bytes to dump
+ * @param[in]    options:   layout of the dump, NULL for the default layout
+ * @param[out]   length:    number of characters with terminating NULL
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to length is NULL
+ *     ERROR_CONVERSION_FAIL     - options are wrong or the dump is longer
+ *                                 than 4 GB
+ *     ERROR_SUCCESS             - function executed without errors
+ */
+UTILS_ERROR UTILS_HexDumpSize(uint32_t size,
+                              const UTILS_HEXDUMP_OPTIONS* options,
+                              uint32_t* length);
+
+/**
+ * @brief    Format byte buffer as canonical hex dump
+ *
+ * Every line has the offset, the bytes as upper case hexadecimal pairs and
+ * the printable characters of the bytes ('.' for others), e.g. with the
+ * default options (16 bytes per line, groups of 8, 8 offset digits):
+ * "00000010  48 65 6C 6C 6F 20 57 6F  72 6C 64 0A 00 01 02 03  |Hello World.....|"
+ * Lines end with '\n' and the dump is always terminated with NULL, so
+ * 'length' must be at least the value of UTILS_HexDumpSize().
+ *
+ * @param[in]    bytes:     buffer to dump
+ * @param[in]    size:      number of bytes in buffer
+ * @param[out]   dump:      hex dump string
+ * @param[in]    length:    length of dump string (before conversion)
+ * @param[in]    options:   layout of the dump, NULL for the default layout
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to bytes or dump is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible. length of dump
+ *                                 is too short or options are wrong
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_HexDump(const uint8_t* bytes, uint32_t size,
+                          char* dump, uint32_t length,
+                          const UTILS_HEXDUMP_OPTIONS* options);
+
+/**
+ * @brief    Convert byte buffer to Base64 ASCII string
+ *
+ * 'length' of 'base64' must be at least UTILS_BASE64_ENCODED_SIZE(size)
+ * for standard alphabet (padded), URL-safe alphabet needs (size * 4 + 2) / 3
+ * characters. The terminating NULL is written when there is space left.
+ *
+ * @param[in]    bytes:     buffer to convert
+ * @param[in]    size:      number of bytes in buffer
+ * @param[in]    alphabet:  standard or URL-safe alphabet
+ * @param[out]   base64:    Base64 string
+ * @param[in]    length:    length of base64 string (before conversion)
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to bytes or base64 is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible. length of
+ *                                 base64 is too short or alphabet is wrong
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_BytesToBase64(const uint8_t* bytes, uint32_t size,
+                                UTILS_BASE64_ALPHABET alphabet,
+                                char* base64, uint32_t length);
+
+/**
+ * @brief    Convert Base64 ASCII string to byte buffer
+ *
+ * Decoding is strict, see UTILS_Base64DecodeUpdate(). Standard alphabet
+ * requires padding, URL-safe alphabet accepts input with or without it.
+ * UTILS_BASE64_DECODED_SIZE(length) is always enough for 'size'.
+ *
+ * @param[in]    base64:    Base64 string
+ * @param[in]    length:    number of characters to convert
+ * @param[in]    alphabet:  standard or URL-safe alphabet
+ * @param[out]   bytes:     conversion result
+ * @param[in]    size:      size of bytes buffer
+ * @param[out]   written:   number of bytes written to bytes buffer
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to any argument is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible. bytes buffer
+ *                                 is too small, alphabet is wrong or
+ *                                 base64 string is not valid
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_Base64ToBytes(const char* base64, uint32_t length,
+                                UTILS_BASE64_ALPHABET alphabet,
+                                uint8_t* bytes, uint32_t size,
+                                uint32_t* written);
+
+/**
+ * @brief    Prepare state of streaming Base64 encoder or decoder
+ *
+ * One stream is used either for encoding or for decoding. After the final
+ * call (or an error) it must be prepared again before next use.
+ *
+ * @param[out]   stream:    state of the stream
+ * @param[in]    alphabet:  standard or URL-safe alphabet
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to stream is NULL
+ *     ERROR_CONVERSION_FAIL     - alphabet is wrong
+ *     ERROR_SUCCESS             - function executed without errors
+ */
+UTILS_ERROR UTILS_Base64Init(UTILS_BASE64_STREAM* stream,
+                             UTILS_BASE64_ALPHABET alphabet);
+
+/**
+ * @brief    Encode next part of byte stream to Base64 characters
+ *
+ * Only full quanta (3 bytes to 4 characters) are written, up to 2 bytes are
+ * kept in the stream for the next call or UTILS_Base64EncodeFinal(). No
+ * NULL is written. 'length' must be at least (kept + size) / 3 * 4.
+ *
+ * @param[in,out] stream:   state of the stream
+ * @param[in]    bytes:     next part of the buffer to encode
+ * @param[in]    size:      number of bytes in this part
+ * @param[out]   base64:    Base64 characters
+ * @param[in]    length:    length of base64 buffer
+ * @param[out]   written:   number of characters written to base64
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to any argument is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible.
+ *                                 length of base64 is too short
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_Base64EncodeUpdate(UTILS_BASE64_STREAM* stream,
+                                     const uint8_t* bytes, uint32_t size,
+                                     char* base64, uint32_t length,
+                                     uint32_t* written);
+
+/**
+ * @brief    Encode bytes kept in the stream and finish the encoding
+ *
+ * Standard alphabet writes 0 or 4 characters (with '=' padding), URL-safe
+ * alphabet 0, 2 or 3 characters (without padding). No NULL is written.
+ *
+ * @param[in,out] stream:   state of the stream
+ * @param[out]   base64:    Base64 characters
+ * @param[in]    length:    length of base64 buffer
+ * @param[out]   written:   number of characters written to base64
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to any argument is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible.
+ *                                 length of base64 is too short
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_Base64EncodeFinal(UTILS_BASE64_STREAM* stream,
+                                    char* base64, uint32_t length,
+                                    uint32_t* written);
+
+/**
+ * @brief    Decode next part of Base64 character stream to bytes
+ *
+ * Only full quanta are written, characters of not finished quantum are kept
+ * in the stream. Decoding is strict: any character out of the alphabet
+ * (white space too), misplaced padding or data after padding is an error.
+ * On error 'written' bytes are valid and the stream must be prepared again.
+ *
+ * @param[in,out] stream:   state of the stream
+ * @param[in]    base64:    next part of the Base64 characters
+ * @param[in]    length:    number of characters in this part
+ * @param[out]   bytes:     conversion result
+ * @param[in]    size:      size of bytes buffer
+ * @param[out]   written:   number of bytes written to bytes buffer
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to any argument is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible. Character is
+ *                                 not allowed or bytes buffer is too small
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_Base64DecodeUpdate(UTILS_BASE64_STREAM* stream,
+                                     const char* base64, uint32_t length,
+                                     uint8_t* bytes, uint32_t size,
+                                     uint32_t* written);
+
+/**
+ * @brief    Finish decoding of Base64 character stream
+ *
+ * Standard alphabet requires padded input, so nothing is left to decode.
+ * URL-safe alphabet accepts input without padding, then the last 2 or 3
+ * characters kept in the stream give 1 or 2 bytes.
+ *
+ * @param[in,out] stream:   state of the stream
+ * @param[out]   bytes:     conversion result
+ * @param[in]    size:      size of bytes buffer
+ * @param[out]   written:   number of bytes written to bytes buffer
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to any argument is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible. Input is cut,
+ *                                 padding is missing or bytes buffer is
+ *                                 too small
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_Base64DecodeFinal(UTILS_BASE64_STREAM* stream,
+                                    uint8_t* bytes, uint32_t size,
+                                    uint32_t* written);
+
+/**
+ * @brief    Convert float position variable to hexadecimal ASCII string
+ *
+ * The minimum of 'hex' string must be 10 (Number of max. digit in hex format
+ * plus '0x' prefix) or greater.
+ *
+ * @param[in]    fp:        floating point value
+ * @param[out]   hex:       pointer to hexadecimal string
+ * @param[in]    length:    length of string (before conversion)
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to hex is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible.
+ *                                 Length of hex is too short
+ *     ERROR_FAIL                - general error
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_Float2Hex(float fp, char* hex, uint8_t length);
+
+/**
+ * @brief    Convert float position variable to digits ASCII string
+ *
+ * Length of 'ascii' array should be adequate to size of floating point 'fp'.
+ * This means that this function returns an error if the size of the integer
+ * "fp" does not fit in the array. The decimal digits are the shortest ones
+ * which give back the same 'fp' (see UTILS_Float2AsciiShortest()) and they
+ * are cut when the array is too short. Otherwise, the "ascii" array will
+ * be filled with decimal digits to the end or set the rest of the cell to 0.
+ *
+ * @param[in]    fp:        floating point value
+ * @param[out]   ascii:     pointer to ascii array
+ * @param[in]    length:    length of string (before conversion)
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to string is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible.
+ *                                 length of ascii is too short
+ *     ERROR_FAIL                - general error
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_Float2AsciiString(float fp, char* ascii, uint8_t length);
+
+/**
+ * @brief    Convert floating point variable to the shortest ASCII string
+ *
+ * The string has the minimum number of digits needed to get back the same
+ * 'fp' value, e.g. 0.1f is converted to "0.1" in fixed and to "1e-1" in
+ * scientific notation. The fixed notation always has a decimal point.
+ * Infinity is converted to "inf" and not a number to "nan". All floats
+ * fit into UTILS_FLOAT_STRING_MAX_SIZE characters with the terminating
+ * NULL, which is written when there is space left.
+ *
+ * @param[in]    fp:         floating point value
+ * @param[in]    notation:   fixed or scientific notation
+ * @param[out]   string:     pointer to ascii array
+ * @param[in]    length:     length of string (before conversion)
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to string is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible.
+ *                                 length of string is too short
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_Float2AsciiShortest(float fp, UTILS_FLOAT_NOTATION notation,
+                                      char* string, uint8_t length);
+
+/**
+ * @brief    Convert decimal ASCII string to floating point variable
+ *
+ * The string can start with '+' or '-' sign, then has decimal digits with
+ * an optional decimal point, and an optional exponent just like "-1.5e-3".
+ * "inf", "infinity" and "nan" are accepted in any letter case. Conversion
+ * stops at the first character which does not belong to the number, or
+ * after 'length' characters, so the string does not need NULL at the end.
+ * The result is correctly rounded (to nearest, ties to even) for any
+ * number of digits and it does not depend on the locale.
+ *
+ * @param[in]    string:     decimal ASCII string
+ * @param[in]    length:     maximum number of characters to read
+ * @param[out]   fp:         conversion result
+ * @param[out]   consumed:   number of characters of the number
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to string, fp or consumed is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible.
+ *                                 String does not start with a number
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_AsciiString2Float(const char* string, uint32_t length,
+                                    float* fp, uint32_t* consumed);
+
+/**
+ * @brief    Convert fixed-point value to decimal ASCII string
+ *
+ * The string has an optional '-' sign, the integer part and, when
+ * 'decimals' is not 0, decimal point and exactly 'decimals' fraction
+ * digits, e.g. Q15 value 0x6000 with 3 decimals is "0.750". The value is
+ * rounded to nearest with ties to even, like printf("%.*f") of the exact
+ * value. The terminating NULL is written when there is space left.
+ *
+ * @param[in]    value:     fixed-point value, sign extended to 32 bits
+ * @param[in]    format:    UTILS_Q15, UTILS_Q31, UTILS_Q16_16 or other
+ *                          UTILS_FIXED_FORMAT(width, fraction)
+ * @param[in]    decimals:  number of fraction digits, up to
+ *                          UTILS_FIXED_MAX_DECIMALS
+ * @param[out]   ascii:     pointer to ascii array
+ * @param[in]    length:    length of string (before conversion)
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to ascii is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible. length of
+ *                                 ascii is too short, format or decimals
+ *                                 is wrong or value is out of format range
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_Fixed2AsciiString(int32_t value, uint16_t format,
+                                    uint8_t decimals, char* ascii,
+                                    uint32_t length);
+
+/**
+ * @brief    Convert decimal ASCII string to fixed-point value
+ *
+ * The string can start with '+' or '-' sign, then has decimal digits with
+ * an optional decimal point, like "-0.125". Conversion stops at the first
+ * character which does not belong to the number, or after 'length'
+ * characters. Any number of fraction digits is accepted and the result is
+ * rounded to nearest with ties to even.
+ *
+ * @param[in]    string:    decimal ASCII string
+ * @param[in]    length:    maximum number of characters to read
+ * @param[in]    format:    UTILS_Q15, UTILS_Q31, UTILS_Q16_16 or other
+ *                          UTILS_FIXED_FORMAT(width, fraction)
+ * @param[out]   value:     conversion result, sign extended to 32 bits
+ * @param[out]   consumed:  number of characters of the number
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to string, value or consumed
+ *                                 is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible. String does
+ *                                 not start with a number, format is wrong
+ *                                 or the number is out of format range
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_AsciiString2Fixed(const char* string, uint32_t length,
+                                    uint16_t format, int32_t* value,
+                                    uint32_t* consumed);
+
+/**
+ * @brief    Convert integer to binary string
+ *
+ * The string has "0b" prefix and the significant digits of 'integer' (one
+ * digit for 0) and the rest of the 'bin' is set as NULL, just like
+ * UTILS_Uint2Hex(). If value of integer is not known, allocate size of
+ * 'bin' as 32 digits + 2('0b') characters.
+ *
+ * @param[in]    integer:    integer value to be converted to binary string
+ * @param[out]   bin:        binary string
+ * @param[in]    length:     length of bin string (before conversion)
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to bin is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible.
+ *                                 length of bin is too short.
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_Uint2Bin(uint32_t integer, char* bin, uint8_t length);
+
+/**
+ * @brief    Convert binary string to unsigned integer
+ *
+ * Binary string can has "0b" and "b" on the beginning, then only '0' and
+ * '1' characters to the terminating NULL. There must be at least one digit
+ * and no more than 32 significant digits (leading zeros are not counted).
+ *
+ * @param[in]    bin:        binary string
+ * @param[out]   integer:    conversion result
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to bin or integer is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible.
+ *                                 In bin string is not allowed character,
+ *                                 there is no digit or value is too big
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_Bin2Uint(const char* bin, uint32_t* integer);
+
+/**
+ * @brief    Convert integer to octal string
+ *
+ * The string has "0o" prefix and the significant digits of 'integer' (one
+ * digit for 0) and the rest of the 'oct' is set as NULL, just like
+ * UTILS_Uint2Hex(). If value of integer is not known, allocate size of
+ * 'oct' as 11 digits + 2('0o') characters.
+ *
+ * @param[in]    integer:    integer value to be converted to octal string
+ * @param[out]   oct:        octal string
+ * @param[in]    length:     length of oct string (before conversion)
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to oct is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible.
+ *                                 length of oct is too short.
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_Uint2Oct(uint32_t integer, char* oct, uint8_t length);
+
+/**
+ * @brief    Convert octal string to unsigned integer
+ *
+ * Octal string can has "0o" and "o" on the beginning, then only '0'..'7'
+ * characters to the terminating NULL. There must be at least one digit and
+ * the value must fit in 32 bits (leading zeros are not counted).
+ *
+ * @param[in]    oct:        octal string
+ * @param[out]   integer:    conversion result
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to oct or integer is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible.
+ *                                 In oct string is not allowed character,
+ *                                 there is no digit or value is too big
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_Oct2Uint(const char* oct, uint32_t* integer);
+
+/**
+ * @brief    Convert array of integers to binary strings of fixed width
+ *
+ * Every value is written as "0b" and all 32 digits (with leading zeros), so
+ * the columns of register dumps are aligned, and values are split by
+ * 'separator'. The whole 'string' takes 'count' * 35 - 1 characters. The
+ * terminating NULL is written when there is space left, but it is not
+ * counted in 'written'.
+ *
+ * @param[in]    integers:    array of integer values to be converted
+ * @param[in]    count:       number of values in 'integers' array
+ * @param[in]    separator:   character put between two values
+ * @param[out]   string:      binary strings of the values
+ * @param[in]    length:      length of string (before conversion)
+ * @param[out]   written:     number of characters written to string
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to integers, string or written
+ *                                 is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible.
+ *                                 Length of string is too small
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_Uint32ArrayToBin(const uint32_t* integers, uint32_t count,
+                                   char separator, char* string,
+                                   uint32_t length, uint32_t* written);
+
+/**
+ * @brief    Convert array of integers to octal strings of fixed width
+ *
+ * Every value is written as "0o" and all 11 digits (with leading zeros) and
+ * values are split by 'separator'. The whole 'string' takes 'count' * 14 - 1
+ * characters. The terminating NULL is written when there is space left, but
+ * it is not counted in 'written'.
+ *
+ * @param[in]    integers:    array of integer values to be converted
+ * @param[in]    count:       number of values in 'integers' array
+ * @param[in]    separator:   character put between two values
+ * @param[out]   string:      octal strings of the values
+ * @param[in]    length:      length of string (before conversion)
+ * @param[out]   written:     number of characters written to string
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to integers, string or written
+ *                                 is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible.
+ *                                 Length of string is too small
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_Uint32ArrayToOct(const uint32_t* integers, uint32_t count,
+                                   char separator, char* string,
+                                   uint32_t length, uint32_t* written);
+
+/**
+ * @brief    Initialize writer of characters to buffer
+ *
+ * @param[out]   writer:     writer to initialize
+ * @param[in]    buffer:     buffer for characters
+ * @param[in]    capacity:   size of buffer
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to writer or buffer is NULL
+ *     ERROR_SUCCESS             - writer is ready
+ */
+UTILS_ERROR UTILS_WriterInit(UTILS_WRITER* writer, char* buffer,
+                             uint32_t capacity);
+
+/**
+ * @brief    Append one character
+ *
+ * @param[in,out] writer:    writer of characters
+ * @param[in]    character:  character to append
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to writer is NULL
+ *     ERROR_CONVERSION_FAIL     - character does not fit or writer has
+ *                                 overflowed before
+ *     ERROR_SUCCESS             - character is appended
+ */
+UTILS_ERROR UTILS_WriterAppendChar(UTILS_WRITER* writer, char character);
+
+/**
+ * @brief    Append characters of string
+ *
+ * Exactly 'length' characters are copied, NULL characters are not searched,
+ * so the string does not need to be terminated.
+ *
+ * @param[in,out] writer:    writer of characters
+ * @param[in]    string:     characters to append
+ * @param[in]    length:     number of characters
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to writer or string is NULL
+ *     ERROR_CONVERSION_FAIL     - string does not fit or writer has
+ *                                 overflowed before
+ *     ERROR_SUCCESS             - string is appended
+ */
+UTILS_ERROR UTILS_WriterAppendString(UTILS_WRITER* writer, const char* string,
+                                     uint32_t length);
+
+/**
+ * @brief    Append decimal digits of integer
+ *
+ * The digits are the same as of UTILS_Int2AsciiString(), with '-' sign for
+ * negative values, but nothing else is written.
+ *
+ * @param[in,out] writer:    writer of characters
+ * @param[in]    integer:    integer value to append
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to writer is NULL
+ *     ERROR_CONVERSION_FAIL     - digits do not fit or writer has
+ *                                 overflowed before
+ *     ERROR_SUCCESS             - digits are appended
+ */
+UTILS_ERROR UTILS_WriterAppendInt(UTILS_WRITER* writer, int32_t integer);
+
+/**
+ * @brief    Append decimal digits of unsigned integer
+ *
+ * @param[in,out] writer:    writer of characters
+ * @param[in]    integer:    unsigned integer value to append
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to writer is NULL
+ *     ERROR_CONVERSION_FAIL     - digits do not fit or writer has
+ *                                 overflowed before
+ *     ERROR_SUCCESS             - digits are appended
+ */
+UTILS_ERROR UTILS_WriterAppendUint(UTILS_WRITER* writer, uint32_t integer);
+
+/**
+ * @brief    Append decimal digits of 64-bit integer
+ *
+ * The digits are the same as of UTILS_Int2AsciiString64(), with '-' sign
+ * for negative values, but nothing else is written.
+ *
+ * @param[in,out] writer:    writer of characters
+ * @param[in]    integer:    integer value to append
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to writer is NULL
+ *     ERROR_CONVERSION_FAIL     - digits do not fit or writer has
+ *                                 overflowed before
+ *     ERROR_SUCCESS             - digits are appended
+ */
+UTILS_ERROR UTILS_WriterAppendInt64(UTILS_WRITER* writer, int64_t integer);
+
+/**
+ * @brief    Append decimal digits of unsigned 64-bit integer
+ *
+ * @param[in,out] writer:    writer of characters
+ * @param[in]    integer:    unsigned integer value to append
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to writer is NULL
+ *     ERROR_CONVERSION_FAIL     - digits do not fit or writer has
+ *                                 overflowed before
+ *     ERROR_SUCCESS             - digits are appended
+ */
+UTILS_ERROR UTILS_WriterAppendUint64(UTILS_WRITER* writer, uint64_t integer);
+
+/**
+ * @brief    Append hexadecimal string of integer
+ *
+ * The string is the same as of UTILS_Uint2Hex(): "0x" prefix and the
+ * significant digits, but the rest of the buffer is not set to NULL.
+ *
+ * @param[in,out] writer:    writer of characters
+ * @param[in]    integer:    integer value to append
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to writer is NULL
+ *     ERROR_CONVERSION_FAIL     - string does not fit or writer has
+ *                                 overflowed before
+ *     ERROR_SUCCESS             - string is appended
+ */
+UTILS_ERROR UTILS_WriterAppendHex(UTILS_WRITER* writer, uint32_t integer);
+
+/**
+ * @brief    Append hexadecimal string of 64-bit integer
+ *
+ * The string is the same as of UTILS_Uint2Hex64(): "0x" prefix and the
+ * significant digits, but the rest of the buffer is not set to NULL.
+ *
+ * @param[in,out] writer:    writer of characters
+ * @param[in]    integer:    integer value to append
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to writer is NULL
+ *     ERROR_CONVERSION_FAIL     - string does not fit or writer has
+ *                                 overflowed before
+ *     ERROR_SUCCESS             - string is appended
+ */
+UTILS_ERROR UTILS_WriterAppendHex64(UTILS_WRITER* writer, uint64_t integer);
+
+/**
+ * @brief    Append binary string of integer
+ *
+ * The string is the same as of UTILS_Uint2Bin(): "0b" prefix and the
+ * significant digits, but the rest of the buffer is not set to NULL.
+ *
+ * @param[in,out] writer:    writer of characters
+ * @param[in]    integer:    integer value to append
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to writer is NULL
+ *     ERROR_CONVERSION_FAIL     - string does not fit or writer has
+ *                                 overflowed before
+ *     ERROR_SUCCESS             - string is appended
+ */
+UTILS_ERROR UTILS_WriterAppendBin(UTILS_WRITER* writer, uint32_t integer);
+
+/**
+ * @brief    Append octal string of integer
+ *
+ * The string is the same as of UTILS_Uint2Oct(): "0o" prefix and the
+ * significant digits, but the rest of the buffer is not set to NULL.
+ *
+ * @param[in,out] writer:    writer of characters
+ * @param[in]    integer:    integer value to append
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to writer is NULL
+ *     ERROR_CONVERSION_FAIL     - string does not fit or writer has
+ *                                 overflowed before
+ *     ERROR_SUCCESS             - string is appended
+ */
+UTILS_ERROR UTILS_WriterAppendOct(UTILS_WRITER* writer, uint32_t integer);
+
+/**
+ * @brief    Append the shortest decimal string of float
+ *
+ * The string is the same as of UTILS_Float2AsciiShortest().
+ *
+ * @param[in,out] writer:    writer of characters
+ * @param[in]    fp:         floating point value
+ * @param[in]    notation:   fixed or scientific notation
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to writer is NULL
+ *     ERROR_CONVERSION_FAIL     - string does not fit or writer has
+ *                                 overflowed before
+ *     ERROR_SUCCESS             - string is appended
+ */
+UTILS_ERROR UTILS_WriterAppendFloat(UTILS_WRITER* writer, float fp,
+                                    UTILS_FLOAT_NOTATION notation);
+
+/**
+ * @brief    Append decimal string of fixed-point value
+ *
+ * The string is the same as of UTILS_Fixed2AsciiString(). Wrong format,
+ * decimals or value out of format range fail without the overflow.
+ *
+ * @param[in,out] writer:    writer of characters
+ * @param[in]    value:      fixed-point value, sign extended to 32 bits
+ * @param[in]    format:     UTILS_Q15, UTILS_Q31, UTILS_Q16_16 or other
+ *                           UTILS_FIXED_FORMAT(width, fraction)
+ * @param[in]    decimals:   number of fraction digits, up to
+ *                           UTILS_FIXED_MAX_DECIMALS
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to writer is NULL
+ *     ERROR_CONVERSION_FAIL     - string does not fit, writer has
+ *                                 overflowed before or conversion is
+ *                                 not possible
+ *     ERROR_SUCCESS             - string is appended
+ */
+UTILS_ERROR UTILS_WriterAppendFixed(UTILS_WRITER* writer, int32_t value,
+                                    uint16_t format, uint8_t decimals);
+
+/**
+ * @brief    Append hexadecimal string of byte buffer
+ *
+ * The string is the same as of UTILS_BytesToHex(): two upper case
+ * characters per byte without prefix.
+ *
+ * @param[in,out] writer:    writer of characters
+ * @param[in]    bytes:      buffer to convert
+ * @param[in]    size:       number of bytes in buffer
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to writer or bytes is NULL
+ *     ERROR_CONVERSION_FAIL     - string does not fit or writer has
+ *                                 overflowed before
+ *     ERROR_SUCCESS             - string is appended
+ */
+UTILS_ERROR UTILS_WriterAppendBytesHex(UTILS_WRITER* writer,
+                                       const uint8_t* bytes, uint32_t size);
+
+/**
+ * @brief    Append Base64 string of byte buffer
+ *
+ * The string is the same as of UTILS_BytesToBase64(): padded for standard
+ * alphabet and without padding for URL-safe one.
+ *
+ * @param[in,out] writer:    writer of characters
+ * @param[in]    bytes:      buffer to convert
+ * @param[in]    size:       number of bytes in buffer
+ * @param[in]    alphabet:   standard or URL-safe alphabet
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to writer or bytes is NULL
+ *     ERROR_CONVERSION_FAIL     - string does not fit, writer has
+ *                                 overflowed before or alphabet is wrong
+ *     ERROR_SUCCESS             - string is appended
+ */
+UTILS_ERROR UTILS_WriterAppendBase64(UTILS_WRITER* writer, const uint8_t* bytes,
+                                     uint32_t size, UTILS_BASE64_ALPHABET alphabet);
+
+/**
+ * @brief    Finish the text of writer
+ *
+ * The terminating NULL is written after the last character, but it is not
+ * counted in 'size'. Appends after an overflow are not written, so checking
+ * the result of this function is enough for the whole text.
+ *
+ * @param[in,out] writer:    writer of characters
+ * @param[out]   size:       number of characters of the text
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to writer or size is NULL
+ *     ERROR_CONVERSION_FAIL     - any append has overflowed or there is no
+ *                                 space for NULL, the text is cut
+ *     ERROR_SUCCESS             - text is complete
+ */
+UTILS_ERROR UTILS_WriterFinish(UTILS_WRITER* writer, uint32_t* size);
+
+/**
+ * @brief    Format text to buffer, subset of snprintf
+ *
+ * Conversions %d %i %u %x %X %f %s %c and %% are supported with flags
+ * '-', '0', '+', ' ' and '#', width and precision (also given as '*'
+ * arguments), and 'l' or 'll' length of integers. %f prints the argument
+ * rounded to float with at most UTILS_FORMAT_MAX_PRECISION decimals. The
+ * text is always terminated with NULL. When a conversion does not fit, the
+ * text ends before it.
+ *
+ * @param[out]   buffer:     buffer for text with NULL
+ * @param[in]    length:     size of buffer
+ * @param[in]    format:     format string
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to buffer, format or string
+ *                                 argument of %s is NULL
+ *     ERROR_CONVERSION_FAIL     - text does not fit and it is cut or format
+ *                                 is not supported
+ *     ERROR_SUCCESS             - text is complete
+ */
+UTILS_ERROR UTILS_Format(char* buffer, uint32_t length, const char* format, ...)
+	UTILS_PRINTF_FORMAT(3, 4);
+
+/**
+ * @brief    Format text to buffer with va_list of arguments
+ *
+ * See UTILS_Format().
+ *
+ * @param[out]   buffer:     buffer for text with NULL
+ * @param[in]    length:     size of buffer
+ * @param[in]    format:     format string
+ * @param[in]    args:       arguments of conversions
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to buffer, format or string
+ *                                 argument of %s is NULL
+ *     ERROR_CONVERSION_FAIL     - text does not fit and it is cut or format
+ *                                 is not supported
+ *     ERROR_SUCCESS             - text is complete
+ */
+UTILS_ERROR UTILS_FormatV(char* buffer, uint32_t length, const char* format,
+                          va_list args);
+
+/**
+ * @brief    Append formatted text to writer
+ *
+ * The format is the same as of UTILS_Format(), but the text continues at the
+ * cursor of writer and it is not terminated.
+ *
+ * @param[in,out] writer:    writer of characters
+ * @param[in]    format:     format string
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to writer, format or string
+ *                                 argument of %s is NULL
+ *     ERROR_CONVERSION_FAIL     - text does not fit, writer has overflowed
+ *                                 before or format is not supported
+ *     ERROR_SUCCESS             - text is appended
+ */
+UTILS_ERROR UTILS_WriterAppendFormat(UTILS_WRITER* writer, const char* format, ...)
+	UTILS_PRINTF_FORMAT(2, 3);
+
+/**
+ * @brief    Initialize scanner of characters
+ *
+ * The characters are not copied, so the buffer must not change while it is
+ * scanned. It is read only up to 'length' and does not need NULL.
+ *
+ * @param[out]   scanner:    scanner to initialize
+ * @param[in]    buffer:     characters to scan
+ * @param[in]    length:     number of characters
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to scanner or buffer is NULL
+ *     ERROR_SUCCESS             - scanner is ready
+ */
+UTILS_ERROR UTILS_ScannerInit(UTILS_SCANNER* scanner, const char* buffer,
+                              uint32_t length);
+
+/**
+ * @brief    Parse decimal integer at the cursor
+ *
+ * The integer can start with '+' or '-' sign and ends at the first character
+ * which is not a digit. Whitespaces are not skipped.
+ *
+ * @param[in,out] scanner:   scanner of characters
+ * @param[out]   integer:    parsed value
+ * @param[out]   consumed:   number of characters of the integer, can be NULL
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to scanner or integer is NULL
+ *     ERROR_CONVERSION_FAIL     - there is no digit at the cursor or value
+ *                                 is out of range of int32_t
+ *     ERROR_SUCCESS             - integer is parsed
+ */
+UTILS_ERROR UTILS_ScannerNextInt(UTILS_SCANNER* scanner, int32_t* integer,
+                                 uint32_t* consumed);
+
+/**
+ * @brief    Parse hexadecimal integer at the cursor
+ *
+ * The integer can start with "0x" or "0X" prefix and ends at the first
+ * character which is not a hexadecimal digit. Leading zeros are skipped,
+ * so only significant digits are limited to eight.
+ *
+ * @param[in,out] scanner:   scanner of characters
+ * @param[out]   integer:    parsed value
+ * @param[out]   consumed:   number of characters of the integer, can be NULL
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to scanner or integer is NULL
+ *     ERROR_CONVERSION_FAIL     - there is no digit at the cursor or value
+ *                                 is out of range of uint32_t
+ *     ERROR_SUCCESS             - integer is parsed
+ */
+UTILS_ERROR UTILS_ScannerNextHex(UTILS_SCANNER* scanner, uint32_t* integer,
+                                 uint32_t* consumed);
+
+/**
+ * @brief    Parse decimal floating point number at the cursor
+ *
+ * The number has the format of UTILS_AsciiString2Float() and it is read
+ * only up to the end of scanner.
+ *
+ * @param[in,out] scanner:   scanner of characters
+ * @param[out]   fp:         parsed value
+ * @param[out]   consumed:   number of characters of the number, can be NULL
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to scanner or fp is NULL
+ *     ERROR_CONVERSION_FAIL     - there is no number at the cursor
+ *     ERROR_SUCCESS             - number is parsed
+ */
+UTILS_ERROR UTILS_ScannerNextFloat(UTILS_SCANNER* scanner, float* fp,
+                                   uint32_t* consumed);
+
+/**
+ * @brief    Move the cursor to the next 'delimiter' character
+ *
+ * The delimiter itself is not consumed, so it can be checked with
+ * UTILS_ScannerExpect(). Skipping a field of "a,b,c" is SkipUntil(',')
+ * and Expect(",").
+ *
+ * @param[in,out] scanner:   scanner of characters
+ * @param[in]    delimiter:  character to find
+ * @param[out]   consumed:   number of skipped characters, can be NULL
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to scanner is NULL
+ *     ERROR_CONVERSION_FAIL     - there is no delimiter up to the end,
+ *                                 the cursor is not moved
+ *     ERROR_SUCCESS             - cursor is at the delimiter
+ */
+UTILS_ERROR UTILS_ScannerSkipUntil(UTILS_SCANNER* scanner, char delimiter,
+                                   uint32_t* consumed);
+
+/**
+ * @brief    Consume expected text at the cursor
+ *
+ * @param[in,out] scanner:   scanner of characters
+ * @param[in]    text:       NULL terminated text which must be at the cursor
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to scanner or text is NULL
+ *     ERROR_CONVERSION_FAIL     - characters at the cursor are different,
+ *                                 the cursor is not moved
+ *     ERROR_SUCCESS             - text is consumed
+ */
+UTILS_ERROR UTILS_ScannerExpect(UTILS_SCANNER* scanner, const char* text);
+
+/**
+ * @brief    Initialize CRC engine of model
+ *
+ * UTILS_CRC_BITWISE needs no table, UTILS_CRC_NIBBLE needs
+ * UTILS_CRC_NIBBLE_TABLE_SIZE entries, UTILS_CRC_SLICING8 and
+ * UTILS_CRC_CLMUL need UTILS_CRC_SLICING8_TABLE_SIZE entries. The table is
+ * computed here and only read later, so copies of the initialized engine
+ * can compute CRCs of other frames at the same time. UTILS_CRC_CLMUL uses
+ * slicing-by-8 on CPUs without PCLMULQDQ. Engines which are not built in
+ * the profile of the library (see UTILS_PROFILE_TINY) are replaced with
+ * the fastest one which is, it needs the same or smaller table.
+ *
+ * @param[out]   crc:        engine to initialize
+ * @param[in]    model:      width, polynomial, init, xorOut and bit order,
+ *                           e.g. UTILS_CRC32_MODEL
+ * @param[in]    engine:     implementation of engine
+ * @param[out]   table:      table of engine, can be NULL for bitwise one
+ * @param[in]    entries:    number of entries in table
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to crc or model is NULL, or table
+ *                                 is NULL but the engine needs it
+ *     ERROR_CONVERSION_FAIL     - width is not 8, 16 or 32, engine is wrong
+ *                                 or table is too small
+ *     ERROR_SUCCESS             - engine is ready
+ */
+UTILS_ERROR UTILS_CrcInit(UTILS_CRC* crc, const UTILS_CRC_MODEL* model,
+                          UTILS_CRC_ENGINE engine, uint32_t* table,
+                          uint32_t entries);
+
+/**
+ * @brief    Start CRC of next frame
+ *
+ * @param[in,out] crc:       initialized engine
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to crc is NULL
+ *     ERROR_SUCCESS             - register is set to init value of model
+ */
+UTILS_ERROR UTILS_CrcReset(UTILS_CRC* crc);
+
+/**
+ * @brief    Add bytes of frame to CRC
+ *
+ * A frame can be given in parts of any size as it is received, the result
+ * is the same as for the whole frame at once.
+ *
+ * @param[in,out] crc:       initialized engine
+ * @param[in]    bytes:      next bytes of frame
+ * @param[in]    size:       number of bytes
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to crc or bytes is NULL
+ *     ERROR_SUCCESS             - bytes are added
+ */
+UTILS_ERROR UTILS_CrcUpdate(UTILS_CRC* crc, const uint8_t* bytes, uint32_t size);
+
+/**
+ * @brief    Get CRC of bytes added since init or reset
+ *
+ * The register is not changed, so more bytes can be added later.
+ *
+ * @param[in]    crc:        initialized engine
+ * @param[out]   value:      CRC of model width, reflected and xored with
+ *                           xorOut as defined by the model
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to crc or value is NULL
+ *     ERROR_SUCCESS             - CRC is returned
+ */
+UTILS_ERROR UTILS_CrcFinal(const UTILS_CRC* crc, uint32_t* value);
+
+/**
+ * @brief    Encode 32-bit value to varint
+ *
+ * @param[in]    value:      value to encode
+ * @param[out]   bytes:      varint of one to UTILS_VARINT32_MAX_SIZE bytes
+ * @param[in]    size:       size of bytes buffer
+ * @param[out]   written:    number of bytes of varint
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to bytes or written is NULL
+ *     ERROR_CONVERSION_FAIL     - bytes buffer is too small
+ *     ERROR_SUCCESS             - value is encoded
+ */
+UTILS_ERROR UTILS_Uint32ToVarint(uint32_t value, uint8_t* bytes, uint32_t size,
+                                 uint32_t* written);
+
+/**
+ * @brief    Encode 64-bit value to varint
+ *
+ * @param[in]    value:      value to encode
+ * @param[out]   bytes:      varint of one to UTILS_VARINT64_MAX_SIZE bytes
+ * @param[in]    size:       size of bytes buffer
+ * @param[out]   written:    number of bytes of varint
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to bytes or written is NULL
+ *     ERROR_CONVERSION_FAIL     - bytes buffer is too small
+ *     ERROR_SUCCESS             - value is encoded
+ */
+UTILS_ERROR UTILS_Uint64ToVarint(uint64_t value, uint8_t* bytes, uint32_t size,
+                                 uint32_t* written);
+
+/**
+ * @brief    Encode signed 32-bit value to zigzag varint
+ *
+ * @param[in]    value:      value to encode
+ * @param[out]   bytes:      varint of one to UTILS_VARINT32_MAX_SIZE bytes
+ * @param[in]    size:       size of bytes buffer
+ * @param[out]   written:    number of bytes of varint
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to bytes or written is NULL
+ *     ERROR_CONVERSION_FAIL     - bytes buffer is too small
+ *     ERROR_SUCCESS             - value is encoded
+ */
+UTILS_ERROR UTILS_Int32ToVarint(int32_t value, uint8_t* bytes, uint32_t size,
+                                uint32_t* written);
+
+/**
+ * @brief    Encode signed 64-bit value to zigzag varint
+ *
+ * @param[in]    value:      value to encode
+ * @param[out]   bytes:      varint of one to UTILS_VARINT64_MAX_SIZE bytes
+ * @param[in]    size:       size of bytes buffer
+ * @param[out]   written:    number of bytes of varint
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to bytes or written is NULL
+ *     ERROR_CONVERSION_FAIL     - bytes buffer is too small
+ *     ERROR_SUCCESS             - value is encoded
+ */
+UTILS_ERROR UTILS_Int64ToVarint(int64_t value, uint8_t* bytes, uint32_t size,
+                                uint32_t* written);
+
+/**
+ * @brief    Decode varint to 32-bit value
+ *
+ * @param[in]    bytes:      buffer which starts with varint
+ * @param[in]    size:       number of bytes in buffer
+ * @param[out]   value:      decoded value
+ * @param[out]   consumed:   number of bytes of varint
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to bytes, value or consumed is NULL
+ *     ERROR_CONVERSION_FAIL     - varint does not end in size bytes, is longer
+ *                                 than UTILS_VARINT32_MAX_SIZE or the value
+ *                                 does not fit in 32 bits
+ *     ERROR_SUCCESS             - value is decoded
+ */
+UTILS_ERROR UTILS_VarintToUint32(const uint8_t* bytes, uint32_t size,
+                                 uint32_t* value, uint32_t* consumed);
+
+/**
+ * @brief    Decode varint to 64-bit value
+ *
+ * @param[in]    bytes:      buffer which starts with varint
+ * @param[in]    size:       number of bytes in buffer
+ * @param[out]   value:      decoded value
+ * @param[out]   consumed:   number of bytes of varint
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to bytes, value or consumed is NULL
+ *     ERROR_CONVERSION_FAIL     - varint does not end in size bytes, is longer
+ *                                 than UTILS_VARINT64_MAX_SIZE or the value
+ *                                 does not fit in 64 bits
+ *     ERROR_SUCCESS             - value is decoded
+ */
+UTILS_ERROR UTILS_VarintToUint64(const uint8_t* bytes, uint32_t size,
+                                 uint64_t* value, uint32_t* consumed);
+
+/**
+ * @brief    Decode zigzag varint to signed 32-bit value
+ *
+ * @param[in]    bytes:      buffer which starts with varint
+ * @param[in]    size:       number of bytes in buffer
+ * @param[out]   value:      decoded value
+ * @param[out]   consumed:   number of bytes of varint
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to bytes, value or consumed is NULL
+ *     ERROR_CONVERSION_FAIL     - varint does not end in size bytes, is longer
+ *                                 than UTILS_VARINT32_MAX_SIZE or the value
+ *                                 does not fit in 32 bits
+ *     ERROR_SUCCESS             - value is decoded
+ */
+UTILS_ERROR UTILS_VarintToInt32(const uint8_t* bytes, uint32_t size,
+                                int32_t* value, uint32_t* consumed);
+
+/**
+ * @brief    Decode zigzag varint to signed 64-bit value
+ *
+ * @param[in]    bytes:      buffer which starts with varint
+ * @param[in]    size:       number of bytes in buffer
+ * @param[out]   value:      decoded value
+ * @param[out]   consumed:   number of bytes of varint
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to bytes, value or consumed is NULL
+ *     ERROR_CONVERSION_FAIL     - varint does not end in size bytes, is longer
+ *                                 than UTILS_VARINT64_MAX_SIZE or the value
+ *                                 does not fit in 64 bits
+ *     ERROR_SUCCESS             - value is decoded
+ */
+UTILS_ERROR UTILS_VarintToInt64(const uint8_t* bytes, uint32_t size,
+                                int64_t* value, uint32_t* consumed);
+
+/**
+ * @brief    Encode array of 32-bit values to consecutive varints
+ *
+ * @param[in]    values:     array of values
+ * @param[in]    count:      number of values
+ * @param[out]   bytes:      varints of values
+ * @param[in]    size:       size of bytes buffer
+ * @param[out]   written:    number of bytes of all varints
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to values, bytes or written is NULL
+ *     ERROR_CONVERSION_FAIL     - bytes buffer is too small
+ *     ERROR_SUCCESS             - values are encoded
+ */
+UTILS_ERROR UTILS_Uint32ArrayToVarints(const uint32_t* values, uint32_t count,
+                                       uint8_t* bytes, uint32_t size,
+                                       uint32_t* written);
+
+/**
+ * @brief    Encode array of 64-bit values to consecutive varints
+ *
+ * @param[in]    values:     array of values
+ * @param[in]    count:      number of values
+ * @param[out]   bytes:      varints of values
+ * @param[in]    size:       size of bytes buffer
+ * @param[out]   written:    number of bytes of all varints
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to values, bytes or written is NULL
+ *     ERROR_CONVERSION_FAIL     - bytes buffer is too small
+ *     ERROR_SUCCESS             - values are encoded
+ */
+UTILS_ERROR UTILS_Uint64ArrayToVarints(const uint64_t* values, uint32_t count,
+                                       uint8_t* bytes, uint32_t size,
+                                       uint32_t* written);
+
+/**
+ * @brief    Encode array of signed 32-bit values to consecutive zigzag varints
+ *
+ * @param[in]    values:     array of values
+ * @param[in]    count:      number of values
+ * @param[out]   bytes:      varints of values
+ * @param[in]    size:       size of bytes buffer
+ * @param[out]   written:    number of bytes of all varints
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to values, bytes or written is NULL
+ *     ERROR_CONVERSION_FAIL     - bytes buffer is too small
+ *     ERROR_SUCCESS             - values are encoded
+ */
+UTILS_ERROR UTILS_Int32ArrayToVarints(const int32_t* values, uint32_t count,
+                                      uint8_t* bytes, uint32_t size,
+                                      uint32_t* written);
+
+/**
+ * @brief    Encode array of signed 64-bit values to consecutive zigzag varints
+ *
+ * @param[in]    values:     array of values
+ * @param[in]    count:      number of values
+ * @param[out]   bytes:      varints of values
+ * @param[in]    size:       size of bytes buffer
+ * @param[out]   written:    number of bytes of all varints
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to values, bytes or written is NULL
+ *     ERROR_CONVERSION_FAIL     - bytes buffer is too small
+ *     ERROR_SUCCESS             - values are encoded
+ */
+UTILS_ERROR UTILS_Int64ArrayToVarints(const int64_t* values, uint32_t count,
+                                      uint8_t* bytes, uint32_t size,
+                                      uint32_t* written);
+
+/**
+ * @brief    Decode consecutive varints to array of 32-bit values
+ *
+ * Exactly 'count' values are decoded, bytes after them are not consumed.
+ *
+ * @param[in]    bytes:      varints of values
+ * @param[in]    size:       number of bytes in buffer
+ * @param[out]   values:     decoded values
+ * @param[in]    count:      number of values to decode
+ * @param[out]   consumed:   number of bytes of all varints
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to bytes, values or consumed is NULL
+ *     ERROR_CONVERSION_FAIL     - there are less than count varints in size
+ *                                 bytes or one of them is not valid, see
+ *                                 UTILS_VarintToUint32()
+ *     ERROR_SUCCESS             - values are decoded
+ */
+UTILS_ERROR UTILS_VarintsToUint32Array(const uint8_t* bytes, uint32_t size,
+                                       uint32_t* values, uint32_t count,
+                                       uint32_t* consumed);
+
+/**
+ * @brief    Decode consecutive varints to array of 64-bit values
+ *
+ * Exactly 'count' values are decoded, bytes after them are not consumed.
+ *
+ * @param[in]    bytes:      varints of values
+ * @param[in]    size:       number of bytes in buffer
+ * @param[out]   values:     decoded values
+ * @param[in]    count:      number of values to decode
+ * @param[out]   consumed:   number of bytes of all varints
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to bytes, values or consumed is NULL
+ *     ERROR_CONVERSION_FAIL     - there are less than count varints in size
+ *                                 bytes or one of them is not valid, see
+ *                                 UTILS_VarintToUint64()
+ *     ERROR_SUCCESS             - values are decoded
+ */
+UTILS_ERROR UTILS_VarintsToUint64Array(const uint8_t* bytes, uint32_t size,
+                                       uint64_t* values, uint32_t count,
+                                       uint32_t* consumed);
+
+/**
+ * @brief    Decode consecutive zigzag varints to array of signed 32-bit values
+ *
+ * Exactly 'count' values are decoded, bytes after them are not consumed.
+ *
+ * @param[in]    bytes:      varints of values
+ * @param[in]    size:       number of bytes in buffer
+ * @param[out]   values:     decoded values
+ * @param[in]    count:      number of values to decode
+ * @param[out]   consumed:   number of bytes of all varints
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to bytes, values or consumed is NULL
+ *     ERROR_CONVERSION_FAIL     - there are less than count varints in size
+ *                                 bytes or one of them is not valid, see
+ *                                 UTILS_VarintToInt32()
+ *     ERROR_SUCCESS             - values are decoded
+ */
+UTILS_ERROR UTILS_VarintsToInt32Array(const uint8_t* bytes, uint32_t size,
+                                      int32_t* values, uint32_t count,
+                                      uint32_t* consumed);
+
+/**
+ * @brief    Decode consecutive zigzag varints to array of signed 64-bit values
+ *
+ * Exactly 'count' values are decoded, bytes after them are not consumed.
+ *
+ * @param[in]    bytes:      varints of values
+ * @param[in]    size:       number of bytes in buffer
+ * @param[out]   values:     decoded values
+ * @param[in]    count:      number of values to decode
+ * @param[out]   consumed:   number of bytes of all varints
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to bytes, values or consumed is NULL
+ *     ERROR_CONVERSION_FAIL     - there are less than count varints in size
+ *                                 bytes or one of them is not valid, see
+ *                                 UTILS_VarintToInt64()
+ *     ERROR_SUCCESS             - values are decoded
+ */
+UTILS_ERROR UTILS_VarintsToInt64Array(const uint8_t* bytes, uint32_t size,
+                                      int64_t* values, uint32_t count,
+                                      uint32_t* consumed);
+
+/**
+ * @brief    Convert array of floats to IEEE half precision floats
+ *
+ * Values are rounded to nearest even. Magnitudes from 65520 up become
+ * infinity, magnitudes below 2^-14 are rounded in denormal steps of 2^-24
+ * and magnitudes up to 2^-25 become zero.
+ *
+ * @param[in]    values:     array of floats
+ * @param[in]    count:      number of values
+ * @param[out]   halves:     array of 'count' halves, it must not overlap
+ *                           values
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to values or halves is NULL
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_FloatArrayToHalf(const float* values, uint32_t count,
+                                   uint16_t* halves);
+
+/**
+ * @brief    Convert array of IEEE half precision floats to floats
+ *
+ * Every half has exact float value.
+ *
+ * @param[in]    halves:     array of halves
+ * @param[in]    count:      number of values
+ * @param[out]   values:     array of 'count' floats, it must not overlap
+ *                           halves
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to halves or values is NULL
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_HalfToFloatArray(const uint16_t* halves, uint32_t count,
+                                   float* values);
+
+/**
+ * @brief    Convert array of floats to bfloat16
+ *
+ * Values are rounded to nearest even, the largest floats become infinity.
+ *
+ * @param[in]    values:     array of floats
+ * @param[in]    count:      number of values
+ * @param[out]   bfloats:    array of 'count' bfloat16 values, it must not
+ *                           overlap values
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to values or bfloats is NULL
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_FloatArrayToBfloat16(const float* values, uint32_t count,
+                                       uint16_t* bfloats);
+
+/**
+ * @brief    Convert array of bfloat16 values to floats
+ *
+ * Every bfloat16 is the top half of float, so the conversion is exact.
+ *
+ * @param[in]    bfloats:    array of bfloat16 values
+ * @param[in]    count:      number of values
+ * @param[out]   values:     array of 'count' floats, it must not overlap
+ *                           bfloats
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to bfloats or values is NULL
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_Bfloat16ToFloatArray(const uint16_t* bfloats, uint32_t count,
+                                       float* values);
+
+/**
+ * @brief    Get sum of statistics of all threads
+ *
+ * Statistics are gathered only when the library and the code which calls it
+ * are built with UTILS_STATS defined, e.g. "make STATS=1". Every thread
+ * counts its own calls, so instrumentation does not share cache lines
+ * between threads. Calls made inside the library are not counted.
+ *
+ * @param[out]   stats:    number of calls, returned errors and latency
+ *                         histogram of every function
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to stats is NULL
+ *     ERROR_FAIL                - library is built without UTILS_STATS,
+ *                                 all statistics are set to 0
+ *     ERROR_SUCCESS             - function executed without errors
+ */
+UTILS_ERROR UTILS_StatsSnapshot(UTILS_STATS_SNAPSHOT* stats);
+
+/**
+ * @brief    Set statistics of all threads to 0
+ *
+ * Calls which run in other threads during reset may be counted or not.
+ * Counters are not locked, so an increment which read a counter before it
+ * was cleared can store its old value plus one after the reset.
+ *
+ * @return Utils error:
+ *     ERROR_FAIL                - library is built without UTILS_STATS
+ *     ERROR_SUCCESS             - function executed without errors
+ */
+UTILS_ERROR UTILS_StatsReset(void);
+
+/* Used by the instrumentation macros below, not to be called directly */
+uint64_t UTILS_StatsBegin(void);
+UTILS_ERROR UTILS_StatsEnd(UTILS_STATS_FUNCTION function, uint64_t begin,
+                           UTILS_ERROR error);
+
+#if defined(UTILS_HEADER_ONLY) && !defined(UTILS_BUILD)
+#include "utils_inline.h"
+#endif
+
+/* Every call of the user code is wrapped. The library itself is built with
+ * UTILS_BUILD, so its definitions and internal calls are left as they are */
+#if defined(UTILS_STATS) && defined(__GNUC__) && !defined(UTILS_BUILD)
+#define UTILS_STATS_CALL(function, call)                                   \
+	__extension__ ({                                                       \
+		uint64_t utilsStatsBegin = UTILS_StatsBegin();                     \
+		UTILS_StatsEnd(function, utilsStatsBegin, call);                   \
+	})
+#define UTILS_Uint2ByteArray(...) \
+	UTILS_STATS_CALL(UTILS_STATS_UINT2BYTEARRAY, UTILS_Uint2ByteArray(__VA_ARGS__))
+#define UTILS_ByteArray2Uint(...) \
+	UTILS_STATS_CALL(UTILS_STATS_BYTEARRAY2UINT, UTILS_ByteArray2Uint(__VA_ARGS__))
+#define UTILS_Uint16ArrayToBytes(...) \
+	UTILS_STATS_CALL(UTILS_STATS_UINT16ARRAYTOBYTES, UTILS_Uint16ArrayToBytes(__VA_ARGS__))
+#define UTILS_Uint32ArrayToBytes(...) \
+	UTILS_STATS_CALL(UTILS_STATS_UINT32ARRAYTOBYTES, UTILS_Uint32ArrayToBytes(__VA_ARGS__))
+#define UTILS_Uint64ArrayToBytes(...) \
+	UTILS_STATS_CALL(UTILS_STATS_UINT64ARRAYTOBYTES, UTILS_Uint64ArrayToBytes(__VA_ARGS__))
+#define UTILS_BytesToUint16Array(...) \
+	UTILS_STATS_CALL(UTILS_STATS_BYTESTOUINT16ARRAY, UTILS_BytesToUint16Array(__VA_ARGS__))
+#define UTILS_BytesToUint32Array(...) \
+	UTILS_STATS_CALL(UTILS_STATS_BYTESTOUINT32ARRAY, UTILS_BytesToUint32Array(__VA_ARGS__))
+#define UTILS_BytesToUint64Array(...) \
+	UTILS_STATS_CALL(UTILS_STATS_BYTESTOUINT64ARRAY, UTILS_BytesToUint64Array(__VA_ARGS__))
+#define UTILS_SwapBytes16(...) \
+	UTILS_STATS_CALL(UTILS_STATS_SWAPBYTES16, UTILS_SwapBytes16(__VA_ARGS__))
+#define UTILS_SwapBytes32(...) \
+	UTILS_STATS_CALL(UTILS_STATS_SWAPBYTES32, UTILS_SwapBytes32(__VA_ARGS__))
+#define UTILS_SwapBytes64(...) \
+	UTILS_STATS_CALL(UTILS_STATS_SWAPBYTES64, UTILS_SwapBytes64(__VA_ARGS__))
+#define UTILS_GetSizeOfAsciiString(...) \
+	UTILS_STATS_CALL(UTILS_STATS_GETSIZEOFASCIISTRING, UTILS_GetSizeOfAsciiString(__VA_ARGS__))
+#define UTILS_GetNumberOfDigit(...) \
+	UTILS_STATS_CALL(UTILS_STATS_GETNUMBEROFDIGIT, UTILS_GetNumberOfDigit(__VA_ARGS__))
+#define UTILS_GetNumberOfDigit64(...) \
+	UTILS_STATS_CALL(UTILS_STATS_GETNUMBEROFDIGIT64, UTILS_GetNumberOfDigit64(__VA_ARGS__))
+#define UTILS_AsciiDigit2Byte(...) \
+	UTILS_STATS_CALL(UTILS_STATS_ASCIIDIGIT2BYTE, UTILS_AsciiDigit2Byte(__VA_ARGS__))
+#define UTILS_Byte2AsciiDigit(...) \
+	UTILS_STATS_CALL(UTILS_STATS_BYTE2ASCIIDIGIT, UTILS_Byte2AsciiDigit(__VA_ARGS__))
+#define UTILS_AsciiString2Int(...) \
+	UTILS_STATS_CALL(UTILS_STATS_ASCIISTRING2INT, UTILS_AsciiString2Int(__VA_ARGS__))
+#define UTILS_ParseInt32List(...) \
+	UTILS_STATS_CALL(UTILS_STATS_PARSEINT32LIST, UTILS_ParseInt32List(__VA_ARGS__))
+#define UTILS_Int2AsciiString(...) \
+	UTILS_STATS_CALL(UTILS_STATS_INT2ASCIISTRING, UTILS_Int2AsciiString(__VA_ARGS__))
+#define UTILS_Int2AsciiString64(...) \
+	UTILS_STATS_CALL(UTILS_STATS_INT2ASCIISTRING64, UTILS_Int2AsciiString64(__VA_ARGS__))
+#define UTILS_Int32ArrayToAscii(...) \
+	UTILS_STATS_CALL(UTILS_STATS_INT32ARRAYTOASCII, UTILS_Int32ArrayToAscii(__VA_ARGS__))
+#define UTILS_Float2Uint(...) \
+	UTILS_STATS_CALL(UTILS_STATS_FLOAT2UINT, UTILS_Float2Uint(__VA_ARGS__))
+#define UTILS_Uint2Float(...) \
+	UTILS_STATS_CALL(UTILS_STATS_UINT2FLOAT, UTILS_Uint2Float(__VA_ARGS__))
+#define UTILS_Hex2Uint(...) \
+	UTILS_STATS_CALL(UTILS_STATS_HEX2UINT, UTILS_Hex2Uint(__VA_ARGS__))
+#define UTILS_Hex2Uint64(...) \
+	UTILS_STATS_CALL(UTILS_STATS_HEX2UINT64, UTILS_Hex2Uint64(__VA_ARGS__))
+#define UTILS_Uint2Hex(...) \
+	UTILS_STATS_CALL(UTILS_STATS_UINT2HEX, UTILS_Uint2Hex(__VA_ARGS__))
+#define UTILS_Uint2Hex64(...) \
+	UTILS_STATS_CALL(UTILS_STATS_UINT2HEX64, UTILS_Uint2Hex64(__VA_ARGS__))
+#define UTILS_BytesToHex(...) \
+	UTILS_STATS_CALL(UTILS_STATS_BYTESTOHEX, UTILS_BytesToHex(__VA_ARGS__))
+#define UTILS_HexToBytes(...) \
+	UTILS_STATS_CALL(UTILS_STATS_HEXTOBYTES, UTILS_HexToBytes(__VA_ARGS__))
+#define UTILS_Base64Init(...) \
+	UTILS_STATS_CALL(UTILS_STATS_BASE64INIT, UTILS_Base64Init(__VA_ARGS__))
+#define UTILS_Base64EncodeUpdate(...) \
+	UTILS_STATS_CALL(UTILS_STATS_BASE64ENCODEUPDATE, UTILS_Base64EncodeUpdate(__VA_ARGS__))
+#define UTILS_Base64EncodeFinal(...) \
+	UTILS_STATS_CALL(UTILS_STATS_BASE64ENCODEFINAL, UTILS_Base64EncodeFinal(__VA_ARGS__))
+#define UTILS_Base64DecodeUpdate(...) \
+	UTILS_STATS_CALL(UTILS_STATS_BASE64DECODEUPDATE, UTILS_Base64DecodeUpdate(__VA_ARGS__))
+#define UTILS_Base64DecodeFinal(...) \
+	UTILS_STATS_CALL(UTILS_STATS_BASE64DECODEFINAL, UTILS_Base64DecodeFinal(__VA_ARGS__))
+#define UTILS_BytesToBase64(...) \
+	UTILS_STATS_CALL(UTILS_STATS_BYTESTOBASE64, UTILS_BytesToBase64(__VA_ARGS__))
+#define UTILS_Base64ToBytes(...) \
+	UTILS_STATS_CALL(UTILS_STATS_BASE64TOBYTES, UTILS_Base64ToBytes(__VA_ARGS__))
+#define UTILS_HexDumpSize(...) \
+	UTILS_STATS_CALL(UTILS_STATS_HEXDUMPSIZE, UTILS_HexDumpSize(__VA_ARGS__))
+#define UTILS_HexDump(...) \
+	UTILS_STATS_CALL(UTILS_STATS_HEXDUMP, UTILS_HexDump(__VA_ARGS__))
+#define UTILS_Fixed2AsciiString(...) \
+	UTILS_STATS_CALL(UTILS_STATS_FIXED2ASCIISTRING, UTILS_Fixed2AsciiString(__VA_ARGS__))
+#define UTILS_AsciiString2Fixed(...) \
+	UTILS_STATS_CALL(UTILS_STATS_ASCIISTRING2FIXED, UTILS_AsciiString2Fixed(__VA_ARGS__))
+#define UTILS_Uint2Bin(...) \
+	UTILS_STATS_CALL(UTILS_STATS_UINT2BIN, UTILS_Uint2Bin(__VA_ARGS__))
+#define UTILS_Bin2Uint(...) \
+	UTILS_STATS_CALL(UTILS_STATS_BIN2UINT, UTILS_Bin2Uint(__VA_ARGS__))
+#define UTILS_Uint2Oct(...) \
+	UTILS_STATS_CALL(UTILS_STATS_UINT2OCT, UTILS_Uint2Oct(__VA_ARGS__))
+#define UTILS_Oct2Uint(...) \
+	UTILS_STATS_CALL(UTILS_STATS_OCT2UINT, UTILS_Oct2Uint(__VA_ARGS__))
+#define UTILS_Uint32ArrayToBin(...) \
+	UTILS_STATS_CALL(UTILS_STATS_UINT32ARRAYTOBIN, UTILS_Uint32ArrayToBin(__VA_ARGS__))
+#define UTILS_Uint32ArrayToOct(...) \
+	UTILS_STATS_CALL(UTILS_STATS_UINT32ARRAYTOOCT, UTILS_Uint32ArrayToOct(__VA_ARGS__))
+#define UTILS_WriterInit(...) \
+	UTILS_STATS_CALL(UTILS_STATS_WRITERINIT, UTILS_WriterInit(__VA_ARGS__))
+#define UTILS_WriterAppendChar(...) \
+	UTILS_STATS_CALL(UTILS_STATS_WRITERAPPENDCHAR, UTILS_WriterAppendChar(__VA_ARGS__))
+#define UTILS_WriterAppendString(...) \
+	UTILS_STATS_CALL(UTILS_STATS_WRITERAPPENDSTRING, UTILS_WriterAppendString(__VA_ARGS__))
+#define UTILS_WriterAppendInt(...) \
+	UTILS_STATS_CALL(UTILS_STATS_WRITERAPPENDINT, UTILS_WriterAppendInt(__VA_ARGS__))
+#define UTILS_WriterAppendUint(...) \
+	UTILS_STATS_CALL(UTILS_STATS_WRITERAPPENDUINT, UTILS_WriterAppendUint(__VA_ARGS__))
+#define UTILS_WriterAppendInt64(...) \
+	UTILS_STATS_CALL(UTILS_STATS_WRITERAPPENDINT64, UTILS_WriterAppendInt64(__VA_ARGS__))
+#define UTILS_WriterAppendUint64(...) \
+	UTILS_STATS_CALL(UTILS_STATS_WRITERAPPENDUINT64, UTILS_WriterAppendUint64(__VA_ARGS__))
+#define UTILS_WriterAppendHex(...) \
+	UTILS_STATS_CALL(UTILS_STATS_WRITERAPPENDHEX, UTILS_WriterAppendHex(__VA_ARGS__))
+#define UTILS_WriterAppendHex64(...) \
+	UTILS_STATS_CALL(UTILS_STATS_WRITERAPPENDHEX64, UTILS_WriterAppendHex64(__VA_ARGS__))
+#define UTILS_WriterAppendBin(...) \
+	UTILS_STATS_CALL(UTILS_STATS_WRITERAPPENDBIN, UTILS_WriterAppendBin(__VA_ARGS__))
+#define UTILS_WriterAppendOct(...) \
+	UTILS_STATS_CALL(UTILS_STATS_WRITERAPPENDOCT, UTILS_WriterAppendOct(__VA_ARGS__))
+#define UTILS_WriterAppendFloat(...) \
+	UTILS_STATS_CALL(UTILS_STATS_WRITERAPPENDFLOAT, UTILS_WriterAppendFloat(__VA_ARGS__))
+#define UTILS_WriterAppendFixed(...) \
+	UTILS_STATS_CALL(UTILS_STATS_WRITERAPPENDFIXED, UTILS_WriterAppendFixed(__VA_ARGS__))
+#define UTILS_WriterAppendBytesHex(...) \
+	UTILS_STATS_CALL(UTILS_STATS_WRITERAPPENDBYTESHEX, UTILS_WriterAppendBytesHex(__VA_ARGS__))
+#define UTILS_WriterAppendBase64(...) \
+	UTILS_STATS_CALL(UTILS_STATS_WRITERAPPENDBASE64, UTILS_WriterAppendBase64(__VA_ARGS__))
+#define UTILS_WriterFinish(...) \
+	UTILS_STATS_CALL(UTILS_STATS_WRITERFINISH, UTILS_WriterFinish(__VA_ARGS__))
+#define UTILS_Format(...) \
+	UTILS_STATS_CALL(UTILS_STATS_FORMAT, UTILS_Format(__VA_ARGS__))
+#define UTILS_FormatV(...) \
+	UTILS_STATS_CALL(UTILS_STATS_FORMATV, UTILS_FormatV(__VA_ARGS__))
+#define UTILS_WriterAppendFormat(...) \
+	UTILS_STATS_CALL(UTILS_STATS_WRITERAPPENDFORMAT, UTILS_WriterAppendFormat(__VA_ARGS__))
+#define UTILS_ScannerInit(...) \
+	UTILS_STATS_CALL(UTILS_STATS_SCANNERINIT, UTILS_ScannerInit(__VA_ARGS__))
+#define UTILS_ScannerNextInt(...) \
+	UTILS_STATS_CALL(UTILS_STATS_SCANNERNEXTINT, UTILS_ScannerNextInt(__VA_ARGS__))
+#define UTILS_ScannerNextHex(...) \
+	UTILS_STATS_CALL(UTILS_STATS_SCANNERNEXTHEX, UTILS_ScannerNextHex(__VA_ARGS__))
+#define UTILS_ScannerNextFloat(...) \
+	UTILS_STATS_CALL(UTILS_STATS_SCANNERNEXTFLOAT, UTILS_ScannerNextFloat(__VA_ARGS__))
+#define UTILS_ScannerSkipUntil(...) \
+	UTILS_STATS_CALL(UTILS_STATS_SCANNERSKIPUNTIL, UTILS_ScannerSkipUntil(__VA_ARGS__))
+#define UTILS_ScannerExpect(...) \
+	UTILS_STATS_CALL(UTILS_STATS_SCANNEREXPECT, UTILS_ScannerExpect(__VA_ARGS__))
+#define UTILS_CrcInit(...) \
+	UTILS_STATS_CALL(UTILS_STATS_CRCINIT, UTILS_CrcInit(__VA_ARGS__))
+#define UTILS_CrcReset(...) \
+	UTILS_STATS_CALL(UTILS_STATS_CRCRESET, UTILS_CrcReset(__VA_ARGS__))
+#define UTILS_CrcUpdate(...) \
+	UTILS_STATS_CALL(UTILS_STATS_CRCUPDATE, UTILS_CrcUpdate(__VA_ARGS__))
+#define UTILS_CrcFinal(...) \
+	UTILS_STATS_CALL(UTILS_STATS_CRCFINAL, UTILS_CrcFinal(__VA_ARGS__))
+#define UTILS_Uint32ToVarint(...) \
+	UTILS_STATS_CALL(UTILS_STATS_UINT32TOVARINT, UTILS_Uint32ToVarint(__VA_ARGS__))
+#define UTILS_Uint64ToVarint(...) \
+	UTILS_STATS_CALL(UTILS_STATS_UINT64TOVARINT, UTILS_Uint64ToVarint(__VA_ARGS__))
+#define UTILS_Int32ToVarint(...) \
+	UTILS_STATS_CALL(UTILS_STATS_INT32TOVARINT, UTILS_Int32ToVarint(__VA_ARGS__))
+#define UTILS_Int64ToVarint(...) \
+	UTILS_STATS_CALL(UTILS_STATS_INT64TOVARINT, UTILS_Int64ToVarint(__VA_ARGS__))
+#define UTILS_VarintToUint32(...) \
+	UTILS_STATS_CALL(UTILS_STATS_VARINTTOUINT32, UTILS_VarintToUint32(__VA_ARGS__))
+#define UTILS_VarintToUint64(...) \
+	UTILS_STATS_CALL(UTILS_STATS_VARINTTOUINT64, UTILS_VarintToUint64(__VA_ARGS__))
+#define UTILS_VarintToInt32(...) \
+	UTILS_STATS_CALL(UTILS_STATS_VARINTTOINT32, UTILS_VarintToInt32(__VA_ARGS__))
+#define UTILS_VarintToInt64(...) \
+	UTILS_STATS_CALL(UTILS_STATS_VARINTTOINT64, UTILS_VarintToInt64(__VA_ARGS__))
+#define UTILS_Uint32ArrayToVarints(...) \
+	UTILS_STATS_CALL(UTILS_STATS_UINT32ARRAYTOVARINTS, UTILS_Uint32ArrayToVarints(__VA_ARGS__))
+#define UTILS_Uint64ArrayToVarints(...) \
+	UTILS_STATS_CALL(UTILS_STATS_UINT64ARRAYTOVARINTS, UTILS_Uint64ArrayToVarints(__VA_ARGS__))
+#define UTILS_Int32ArrayToVarints(...) \
+	UTILS_STATS_CALL(UTILS_STATS_INT32ARRAYTOVARINTS, UTILS_Int32ArrayToVarints(__VA_ARGS__))
+#define UTILS_Int64ArrayToVarints(...) \
+	UTILS_STATS_CALL(UTILS_STATS_INT64ARRAYTOVARINTS, UTILS_Int64ArrayToVarints(__VA_ARGS__))
+#define UTILS_VarintsToUint32Array(...) \
+	UTILS_STATS_CALL(UTILS_STATS_VARINTSTOUINT32ARRAY, UTILS_VarintsToUint32Array(__VA_ARGS__))
+#define UTILS_VarintsToUint64Array(...) \
+	UTILS_STATS_CALL(UTILS_STATS_VARINTSTOUINT64ARRAY, UTILS_VarintsToUint64Array(__VA_ARGS__))
+#define UTILS_VarintsToInt32Array(...) \
+	UTILS_STATS_CALL(UTILS_STATS_VARINTSTOINT32ARRAY, UTILS_VarintsToInt32Array(__VA_ARGS__))
+#define UTILS_VarintsToInt64Array(...) \
+	UTILS_STATS_CALL(UTILS_STATS_VARINTSTOINT64ARRAY, UTILS_VarintsToInt64Array(__VA_ARGS__))
+#define UTILS_FloatArrayToHalf(...) \
+	UTILS_STATS_CALL(UTILS_STATS_FLOATARRAYTOHALF, UTILS_FloatArrayToHalf(__VA_ARGS__))
+#define UTILS_HalfToFloatArray(...) \
+	UTILS_STATS_CALL(UTILS_STATS_HALFTOFLOATARRAY, UTILS_HalfToFloatArray(__VA_ARGS__))
+#define UTILS_FloatArrayToBfloat16(...) \
+	UTILS_STATS_CALL(UTILS_STATS_FLOATARRAYTOBFLOAT16, UTILS_FloatArrayToBfloat16(__VA_ARGS__))
+#define UTILS_Bfloat16ToFloatArray(...) \
+	UTILS_STATS_CALL(UTILS_STATS_BFLOAT16TOFLOATARRAY, UTILS_Bfloat16ToFloatArray(__VA_ARGS__))
+#define UTILS_Float2Hex(...) \
+	UTILS_STATS_CALL(UTILS_STATS_FLOAT2HEX, UTILS_Float2Hex(__VA_ARGS__))
+#define UTILS_Float2AsciiString(...) \
+	UTILS_STATS_CALL(UTILS_STATS_FLOAT2ASCIISTRING, UTILS_Float2AsciiString(__VA_ARGS__))
+#define UTILS_Float2AsciiShortest(...) \
+	UTILS_STATS_CALL(UTILS_STATS_FLOAT2ASCIISHORTEST, UTILS_Float2AsciiShortest(__VA_ARGS__))
+#define UTILS_AsciiString2Float(...) \
+	UTILS_STATS_CALL(UTILS_STATS_ASCIISTRING2FLOAT, UTILS_AsciiString2Float(__VA_ARGS__))
+#endif
+
+#ifdef __cplusplus
+}
+#endif
 
 #endif /* INC_UTILS_H_ */
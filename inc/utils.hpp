@@ -0,0 +1,365 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ * @copyrights Copyrights 2019 Stanislaw Pietrzak. All rights reserved.
+ * @file utils.hpp
+ * @author Stanislaw Pietrzak
+ * @email integralzerox@gmail.com
+ * @date 16 October 2026
+ * @brief C++ compile time front-end of the integer conversions
+ *
+ * Header only, C++17. The templates use the algorithms of the C library:
+ * number of digits from the bit length and a power of ten table, decimal
+ * digits written backwards in pairs, and hexadecimal digits written per
+ * nibble. Every function is constexpr, so conversions of constants are done
+ * by the compiler, and runtime calls are specialized per type and base.
+ * Hexadecimal digits are upper case, without "0x" prefix.
+ *
+ * @see https://github.com/Dev4Embedded/
+ */
+#ifndef INC_UTILS_HPP_
+#define INC_UTILS_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace utils
+{
+
+/* Result of from_chars(): 'ptr' is the first character after the number,
+ * 'ok' is false when there is no digit or the value is out of range */
+template <typename T>
+struct from_chars_result
+{
+	const char* ptr;
+	T value;
+	bool ok;
+};
+
+/* NULL terminated string of 'N' characters made at compile time */
+template <std::size_t N>
+struct fixed_string
+{
+	char data[N + 1];
+
+	constexpr const char* c_str() const { return data; }
+	static constexpr std::size_t size() { return N; }
+	constexpr char operator[](std::size_t index) const { return data[index]; }
+};
+
+namespace detail
+{
+
+constexpr char digitPairs[] =
+	"00010203040506070809101112131415161718192021222324"
+	"25262728293031323334353637383940414243444546474849"
+	"50515253545556575859606162636465666768697071727374"
+	"75767778798081828384858687888990919293949596979899";
+constexpr char digits[] = "0123456789ABCDEF";
+constexpr std::uint64_t decimalPowers[] =
+{
+	1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull,
+	10000000ull, 100000000ull, 1000000000ull, 10000000000ull,
+	100000000000ull, 1000000000000ull, 10000000000000ull,
+	100000000000000ull, 1000000000000000ull, 10000000000000000ull,
+	100000000000000000ull, 1000000000000000000ull, 10000000000000000000ull
+};
+
+/* Types narrower than 32 bits are counted and written as 32-bit values */
+template <typename U>
+using Wide = std::conditional_t<(sizeof(U) > sizeof(std::uint32_t)),
+                                std::uint64_t, std::uint32_t>;
+
+template <typename T, unsigned Base>
+constexpr void checkTemplate()
+{
+	static_assert(std::is_integral_v<T> && !std::is_same_v<T, bool>,
+	              "utils: T must be an integer type");
+	static_assert(sizeof(T) <= sizeof(std::uint64_t),
+	              "utils: T must have up to 64 bits");
+	static_assert(Base >= 2 && Base <= 16, "utils: Base must be in <2..16>");
+}
+
+constexpr bool isPowerOfTwo(unsigned base)
+{
+	return (base & (base - 1)) == 0;
+}
+
+constexpr unsigned log2(unsigned base)
+{
+	unsigned bits = 0;
+	while(base >>= 1)
+	{
+		bits++;
+	}
+	return bits;
+}
+
+/* Number of significant bits, 1 for zero */
+template <typename W>
+constexpr unsigned bitLength(W value)
+{
+	value |= 1;
+#if defined(__GNUC__)
+	if constexpr(sizeof(W) == sizeof(std::uint64_t))
+		return 64 - __builtin_clzll(value);
+	else
+		return 32 - __builtin_clz(value);
+#else
+	unsigned bits = 0;
+	for(; value != 0; value >>= 1)
+	{
+		bits++;
+	}
+	return bits;
+#endif
+}
+
+/* Number of digits, 1 for zero */
+template <unsigned Base, typename W>
+constexpr unsigned countDigits(W value)
+{
+	if constexpr(Base == 10)
+	{
+		unsigned digits = (bitLength(value) * 1233) >> 12;
+		return digits + 1 - ((value | 1) < decimalPowers[digits]);
+	}
+	else if constexpr(isPowerOfTwo(Base))
+	{
+		return (bitLength(value) + log2(Base) - 1) / log2(Base);
+	}
+	else
+	{
+		unsigned digits = 1;
+		for(; value >= Base; value /= Base)
+		{
+			digits++;
+		}
+		return digits;
+	}
+}
+
+/* Write digits of 'value' backwards, ending just before 'end' */
+template <unsigned Base, typename W>
+constexpr void writeDigits(W value, char* end)
+{
+	if constexpr(Base == 10)
+	{
+		while(value >= 100)
+		{
+			unsigned pair = static_cast<unsigned>(value % 100) * 2;
+			value /= 100;
+			*--end = digitPairs[pair + 1];
+			*--end = digitPairs[pair];
+		}
+		if(value >= 10)
+		{
+			*--end = digitPairs[value * 2 + 1];
+			*--end = digitPairs[value * 2];
+		}
+		else
+		{
+			*--end = static_cast<char>('0' + value);
+		}
+	}
+	else if constexpr(isPowerOfTwo(Base))
+	{
+		do
+		{
+			*--end = digits[value & (Base - 1)];
+			value >>= log2(Base);
+		}while(value != 0);
+	}
+	else
+	{
+		do
+		{
+			*--end = digits[value % Base];
+			value /= Base;
+		}while(value != 0);
+	}
+}
+
+/* Value of digit, or 'Base' (or more) if the character is not a digit */
+template <unsigned Base>
+constexpr unsigned digitValue(char character)
+{
+	unsigned digit = static_cast<unsigned char>(character) - '0';
+	unsigned letter = (static_cast<unsigned char>(character) | 0x20) - 'a';
+	if(digit < 10)
+		return digit;
+	if(letter < 6)
+		return letter + 10;
+	return Base;
+}
+
+template <typename T>
+constexpr bool isNegative(T value)
+{
+	if constexpr(std::is_signed_v<T>)
+		return value < 0;
+	else
+		return false;
+}
+
+template <typename T>
+constexpr std::make_unsigned_t<T> magnitude(T value)
+{
+	using U = std::make_unsigned_t<T>;
+	if(isNegative(value))
+		return static_cast<U>(U(0) - static_cast<U>(value));
+	return static_cast<U>(value);
+}
+
+/* Characters of 'value' with the sign */
+template <typename T, unsigned Base>
+constexpr std::size_t countChars(T value)
+{
+	using W = Wide<std::make_unsigned_t<T>>;
+	return countDigits<Base>(static_cast<W>(magnitude(value))) + isNegative(value);
+}
+
+} /* namespace detail */
+
+/**
+ * @brief    Convert integer value to ASCII digits in 'Base'
+ *
+ * Same as UTILS_Int2AsciiString() (Base 10) and UTILS_Uint2Hex() (Base 16,
+ * without "0x" prefix). Only the characters of the number are written,
+ * there is no terminating NULL.
+ *
+ * @param[out]   first:    first character of the output range
+ * @param[in]    last:     end of the output range
+ * @param[in]    value:    integer value to be converted
+ *
+ * @return   End of the written characters, or nullptr if the range is
+ *           too short (then nothing is written)
+ */
+template <typename T, unsigned Base = 10>
+constexpr char* to_chars(char* first, char* last, T value) noexcept
+{
+	detail::checkTemplate<T, Base>();
+	using W = detail::Wide<std::make_unsigned_t<T>>;
+	const std::size_t size = detail::countChars<T, Base>(value);
+	if(first == nullptr || last < first ||
+	   static_cast<std::size_t>(last - first) < size)
+	{
+		return nullptr;
+	}
+	if(detail::isNegative(value))
+	{
+		*first = '-';
+	}
+	detail::writeDigits<Base>(static_cast<W>(detail::magnitude(value)),
+	                          first + size);
+	return first + size;
+}
+
+/**
+ * @brief    Convert ASCII digits in 'Base' to integer value
+ *
+ * Signed types accept '-' before digits. Base 16 accepts "0x" and "x"
+ * prefixes just like UTILS_Hex2Uint(). Conversion stops at the first
+ * character which is not a digit, or at 'last'.
+ *
+ * @param[in]    first:    first character of the number
+ * @param[in]    last:     end of the input range
+ *
+ * @return   Value, end of the number and status. 'ok' is false if there
+ *           is no digit or the value does not fit in T.
+ */
+template <typename T, unsigned Base = 10>
+constexpr from_chars_result<T> from_chars(const char* first,
+                                          const char* last) noexcept
+{
+	detail::checkTemplate<T, Base>();
+	using U = std::make_unsigned_t<T>;
+	from_chars_result<T> result = {first, T(0), false};
+	if(first == nullptr || last <= first)
+	{
+		return result;
+	}
+	const char* ptr = first;
+	bool negative = false;
+	if constexpr(std::is_signed_v<T>)
+	{
+		if(*ptr == '-')
+		{
+			negative = true;
+			ptr++;
+		}
+	}
+	if constexpr(Base == 16)
+	{
+		if(last - ptr > 1 && ptr[0] == '0' && (ptr[1] | 0x20) == 'x')
+			ptr += 2;
+		else if(ptr < last && (*ptr | 0x20) == 'x')
+			ptr += 1;
+	}
+	const U limit = static_cast<U>(std::numeric_limits<T>::max()) + negative;
+	const char* digitsBegin = ptr;
+	U value = 0;
+	bool overflow = false;
+	for(; ptr < last; ptr++)
+	{
+		unsigned digit = detail::digitValue<Base>(*ptr);
+		if(digit >= Base)
+		{
+			break;
+		}
+		if(value > (limit - digit) / Base)
+		{
+			overflow = true;
+		}
+		value = static_cast<U>(value * Base + digit);
+	}
+	if(ptr == digitsBegin)
+	{
+		return result;
+	}
+	result.ptr = ptr;
+	if(!overflow)
+	{
+		result.value = negative ? static_cast<T>(U(0) - value) :
+		                          static_cast<T>(value);
+		result.ok = true;
+	}
+	return result;
+}
+
+/**
+ * @brief    Convert constant to NULL terminated string at compile time
+ *
+ * The string has exactly the size of the number, e.g.
+ * "constexpr auto id = utils::to_string<0xBEEFu, 16>();" gives "BEEF".
+ *
+ * @return   fixed_string with digits of 'Value' in 'Base'
+ */
+template <auto Value, unsigned Base = 10>
+constexpr auto to_string() noexcept
+{
+	using T = decltype(Value);
+	constexpr std::size_t size = detail::countChars<T, Base>(Value);
+	fixed_string<size> string = {};
+	to_chars<T, Base>(string.data, string.data + size, Value);
+	string.data[size] = '\0';
+	return string;
+}
+
+} /* namespace utils */
+
+#endif /* INC_UTILS_HPP_ */
@@ -0,0 +1,182 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ * @copyrights Copyrights 2019 Stanislaw Pietrzak. All rights reserved.
+ * @file utils_inline.h
+ * @author Stanislaw Pietrzak
+ * @email integralzerox@gmail.com
+ * @date 16 October 2026
+ * @brief Definitions of the trivial conversions of the library
+ *
+ * The library build includes this file from utils.c, so the functions are
+ * ordinary external ones. With UTILS_HEADER_ONLY the file is included by
+ * utils.h and every definition is static inline, so calls disappear into
+ * the loop of the caller and the compiler can vectorize it.
+ *
+ * @see https://github.com/Dev4Embedded/
+ */
+#ifndef INC_UTILS_INLINE_H_
+#define INC_UTILS_INLINE_H_
+
+#include "stddef.h"
+#include "string.h"
+#include "utils.h"
+
+/**
+* @brief    Convert unsigned integer variable to byte array of size of four.
+* @note     The minimum size of byteArray must be bigger then 4
+* @param[IN]    integer:      unsigned integer value
+* @param[OUT]   byteArray:    pointer to array
+* @return Utils error:
+*    ERROR_NULL_POINTER    - byteArray is equal null
+*    ERROR_SUCCESS         - conversion executed without errors
+*/
+UTILS_INLINE UTILS_ERROR UTILS_Uint2ByteArray(uint32_t integer, uint8_t* byteArray)
+{
+	if(byteArray == NULL) return ERROR_NULL_POINTER;
+
+	for(int8_t byte = 3; byte >= 0; byte--)
+	{
+		byteArray[byte] = integer >> (byte * 8);
+	}
+
+	return ERROR_SUCCESS;
+}
+
+/**
+* @brief    Convert array of four bytes to unsigned integer
+* @note     The minimum size of byteArray must be bigger then 4
+* @param[IN]    byteArray:    pointer to array
+* @param[OUT]   integer:      pointer to unsigned integer variable
+* @return Utils error:
+*     ERROR_NULL_POINTER    - byteArray or integer are equals null
+*     ERROR_SUCCES          - conversion executed without errors
+*/
+UTILS_INLINE UTILS_ERROR UTILS_ByteArray2Uint(uint8_t* byteArray, uint32_t* integer)
+{
+	if(byteArray == NULL || integer == NULL) return ERROR_NULL_POINTER;
+
+	uint32_t value = 0;
+
+	for(int8_t byte = 3; byte >= 0; byte--)
+	{
+		value <<= 8;
+		value |= byteArray[byte];
+	}
+	*integer = value;
+
+	return ERROR_SUCCESS;
+}
+
+/**
+ * @brief    Convert single ASCII character to digit
+ *
+ * Conversion is possible only for single byte characters which are digits:
+ * 0, 1, 2..8 and 9. To convert ASCII strings, please use
+ * UTILS_AsciiString2Int() function.
+ *
+ * @param[in]    ascii:    ASCII character
+ * @param[out]   byte:     value of digit
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to byte is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible.
+ *                                 ASCII character is not a digit.
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_INLINE UTILS_ERROR UTILS_AsciiDigit2Byte(char ascii, uint8_t* byte)
+{
+	if(byte == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	if(ascii >='0' && ascii<='9')
+	{
+		*byte = ascii - '0';
+		return ERROR_SUCCESS;
+	}
+
+	return ERROR_CONVERSION_FAIL;
+}
+
+/**
+ * @brief    Convert byte with range <0..9> to ASCII digit
+ *
+ * @param[in]    byte:     byte to convert
+ * @param[out]   ascii:    value of digit
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to ascii is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible.
+ *                                 Byte is out of range
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_INLINE UTILS_ERROR UTILS_Byte2AsciiDigit(uint8_t byte, char* ascii)
+{
+	if(ascii == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	if(byte <= 9)
+	{
+		*ascii = byte + '0';
+		return ERROR_SUCCESS;
+	}
+
+	return ERROR_CONVERSION_FAIL;
+}
+
+/**
+ * @brief    Get the physical byting form of the floating point variable
+ *
+ * @param[in]    fp:         floating point variable
+ * @param[out]   integer:    physical format of float stored in memory
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to integer is NULL
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_INLINE UTILS_ERROR UTILS_Float2Uint(float fp, uint32_t* integer)
+{
+	if(integer == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	memcpy(integer, &fp, sizeof(*integer));
+	return ERROR_SUCCESS;
+}
+
+/**
+ * @brief    Transform binary form to floating precision
+ *
+ * @param[in]    integer:    binary format
+ * @param[out]   fp:         floating precision value
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to floating precision
+ *                                  variable is NULL
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_INLINE UTILS_ERROR UTILS_Uint2Float(uint32_t integer, float* fp)
+{
+	if(fp == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	memcpy(fp, &integer, sizeof(*fp));
+	return ERROR_SUCCESS;
+}
+
+#endif /* INC_UTILS_INLINE_H_ */
@@ -28,130 +28,413 @@
  */
 
 #include "math.h"
+#include "stddef.h"
+#include "stdlib.h"
+#include "string.h"
 #include "utils.h"
+#include "utils_cpu.h"
+#include "utils_inline.h"
+#include "utils_private.h"
 
 #define UTILS_INT_MAX_VALUE              0x7FFFFFFF //‭2147483647
-#define UTILS_INT_MAX_DIGITS             10	        //‭2.147.483.647
-#define UTILS_HEX_MAX_DIGITS             8
+#define UTILS_HEX64_MAX_DIGITS           16
 #define UTILS_SIZE_OF_HEX_PREFIX         2
 #define UTILS_HEX2BYTE(hex)        (hex >= '0' && hex <='9') ? \
                                    (hex - '0') : (hex >= 'a' && hex <= 'f') ? \
                                    (hex - 'a' + 10) : (hex - 'A' + 10)
-#define UTILS_INT2HEX(integer)     (integer >= 0 && integer <= 9) ? \
-                                   (integer + '0') : (integer + 'A' - 10)
-#define UTILS_FLOAT_EXPONENT_BIAS       127
-#define UTILS_FLOAT_MAX_ACCURACY        9
-#define UTILS_FLOAT_SIGN_POSITION       31
-#define UTILS_FLOAT_SIGN_MASK           0x80000000
-#define UTILS_FLOAT_EXPONENT_POSITION   23
-#define UTILS_FLOAT_EXPONENT_MASK       0x7F800000
-#define UTILS_FLOAT_FRACTION_POSITION   0
-#define UTILS_FLOAT_FRACTION_MASK       0x007FFFFF
-#define UTILS_FLOAT_FRACTION_BITS       22
-
-#define UTILS_FLOAT_GET_SIGN(fp)        (fp & UTILS_FLOAT_SIGN_MASK)\
-                                        >> UTILS_FLOAT_SIGN_POSITION
-#define UTILS_FLOAT_GET_EXPONENT(fp)    (fp & UTILS_FLOAT_EXPONENT_MASK)\
-                                        >> UTILS_FLOAT_EXPONENT_POSITION
-#define UTILS_FLOAT_GET_FRACTION(fp)    (fp & UTILS_FLOAT_FRACTION_MASK)\
-                                        >> UTILS_FLOAT_FRACTION_POSITION
-const char hexDigits[] =    {'0','1','2','3','4','5','6','7','8','9','A',
-                             'B','C','D','E','F','a','b','c','d','e','f'};
-
-union UTILS_ConversionUnion
-{
-	float fp;
-	uint32_t integer;
-}ConversionUnion;
+#define UTILS_WORD_ONES                 0x0101010101010101ull
+#define UTILS_WORD_LOW7                 0x7F7F7F7F7F7F7F7Full
+#define UTILS_WORD_HIGH                 0x8080808080808080ull
+#define UTILS_WORD_ASCII_ZEROS          0x3030303030303030ull
+#define UTILS_IS_ASCII_SYMBOL(c)        ((c) > 0 && (c) < 127)
+#if UTILS_DIGITS_IMPL != UTILS_IMPL_LOOP
+static const char decimalDigitPairs[] =
+                            "00010203040506070809101112131415161718192021222324"
+                            "25262728293031323334353637383940414243444546474849"
+                            "50515253545556575859606162636465666768697071727374"
+                            "75767778798081828384858687888990919293949596979899";
+static const uint32_t decimalPowers32[] =
+{
+	1u, 10u, 100u, 1000u, 10000u, 100000u, 1000000u, 10000000u, 100000000u,
+	1000000000u
+};
+static const uint64_t decimalPowers64[] =
+{
+	1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull,
+	10000000ull, 100000000ull, 1000000000ull, 10000000000ull,
+	100000000000ull, 1000000000000ull, 10000000000000ull,
+	100000000000000ull, 1000000000000000ull, 10000000000000000ull,
+	100000000000000000ull, 1000000000000000000ull, 10000000000000000000ull
+};
+#endif
+#if UTILS_HEX_IMPL != UTILS_IMPL_LOOP
+const char utilsHexNibbles[] = "0123456789ABCDEF";
+#endif
+#if UTILS_HEX_IMPL == UTILS_IMPL_TABLE
+const char utilsHexBytes[] =
+                            "000102030405060708090A0B0C0D0E0F"
+                            "101112131415161718191A1B1C1D1E1F"
+                            "202122232425262728292A2B2C2D2E2F"
+                            "303132333435363738393A3B3C3D3E3F"
+                            "404142434445464748494A4B4C4D4E4F"
+                            "505152535455565758595A5B5C5D5E5F"
+                            "606162636465666768696A6B6C6D6E6F"
+                            "707172737475767778797A7B7C7D7E7F"
+                            "808182838485868788898A8B8C8D8E8F"
+                            "909192939495969798999A9B9C9D9E9F"
+                            "A0A1A2A3A4A5A6A7A8A9AAABACADAEAF"
+                            "B0B1B2B3B4B5B6B7B8B9BABBBCBDBEBF"
+                            "C0C1C2C3C4C5C6C7C8C9CACBCCCDCECF"
+                            "D0D1D2D3D4D5D6D7D8D9DADBDCDDDEDF"
+                            "E0E1E2E3E4E5E6E7E8E9EAEBECEDEEEF"
+                            "F0F1F2F3F4F5F6F7F8F9FAFBFCFDFEFF";
+#endif
 
 static int isHexDigit(char* digit)
-
 {
 	if(digit == NULL) return 0;
-	for(uint8_t digitCtr = 0; digitCtr < sizeof(hexDigits); digitCtr++)
-	{
-		if(*digit == hexDigits[digitCtr]) return 1;
-	}
-	return 0;
+	return (*digit >= '0' && *digit <= '9') ||
+	       (*digit >= 'a' && *digit <= 'f') ||
+	       (*digit >= 'A' && *digit <= 'F');
 }
-static uint32_t getNumberOfHexDigits(uint32_t hex)
+/* Number of significant nibbles, 1 for zero */
+static uint8_t getNumberOfHexDigits(uint32_t hex)
 {
-	if(hex <= 0xF)          return 1;
-	if(hex <= 0xFF)         return 2;
-	if(hex <= 0xFFF)        return 3;
-	if(hex <= 0xFFFF)       return 4;
-	if(hex <= 0xFFFFF)      return 5;
-	if(hex <= 0xFFFFFF)     return 6;
-	if(hex <= 0xFFFFFFF)    return 7;
-	if(hex <= 0xFFFFFFFF)   return 8;
-	return 0;
+	return (uint8_t)((32 - utilsCountLeadingZeros32(hex | 1) + 3) / 4);
 }
 
-static float calculateMantissa(uint32_t mantissa)
+static uint8_t getNumberOfHexDigits64(uint64_t hex)
 {
-	float calMantissa = 1.0;
-	uint8_t power = UTILS_FLOAT_FRACTION_BITS;
-	uint32_t bitMask = (1<<power);
-	if(mantissa&bitMask)
+	return (uint8_t)((64 - utilsCountLeadingZeros64(hex | 1) + 3) / 4);
+}
+
+/* Optional 'x' or '0x' prefix and at least one digit up to NULL. Leading
+ * zeros are skipped, so only significant digits are limited by 'maxDigits' */
+static UTILS_ERROR parseHex(char* hex, uint8_t maxDigits, uint64_t* integer)
+{
+	if(hex[0] == 'x' || hex[0] == 'X')
 	{
-		calMantissa = 1.0;
+		hex += 1;
 	}
-	while(--power)
+	else if(hex[0] == '0' && (hex[1] == 'x' || hex[1] == 'X'))
 	{
-		if(mantissa&bitMask)
+		hex += UTILS_SIZE_OF_HEX_PREFIX;
+	}
+	if(*hex == 0x00)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	while(*hex == '0')
+	{
+		hex++;
+	}
+	uint64_t value = 0;
+	for(uint8_t digitCtr = 0; *hex != 0x00; digitCtr++, hex++)
+	{
+		if(digitCtr == maxDigits || isHexDigit(hex) == 0)
 		{
-			calMantissa += pow(2,(UTILS_FLOAT_FRACTION_BITS-power)*(-1));
+			return ERROR_CONVERSION_FAIL;
 		}
-		bitMask>>=1;
+		value = (value << 4) | (uint64_t)(UTILS_HEX2BYTE(*hex));
 	}
-	return calMantissa;
+	*integer = value;
+	return ERROR_SUCCESS;
 }
 
-/**
-* @brief    Convert unsigned integer variable to byte array of size of four.
-* @note     The minimum size of byteArray must be bigger then 4
-* @param[IN]    integer:      unsigned integer value
-* @param[OUT]   byteArray:    pointer to array
-* @return Utils error:
-*    ERROR_NULL_POINTER    - byteArray is equal null
-*    ERROR_SUCCESS         - conversion executed without errors
-*/
-UTILS_ERROR UTILS_Uint2ByteArray(uint32_t integer, uint8_t* byteArray)
+/* '0x' prefix and 'digits' nibbles written backwards, rest is set as NULL */
+static UTILS_ERROR writeHex(uint64_t integer, uint8_t digits, char* hex,
+                            uint8_t length)
 {
-	if(byteArray == NULL) return ERROR_NULL_POINTER;
+	uint8_t charCounter = digits + UTILS_SIZE_OF_HEX_PREFIX;
+	if(charCounter > length)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	hex[0] = '0';
+	hex[1] = 'x';
+	utilsWriteHexDigits(integer, digits, &hex[charCounter], 'A');
+	for(uint8_t fill = charCounter; fill < length; fill++)
+	{
+		hex[fill] = 0x00;
+	}
+	return ERROR_SUCCESS;
+}
 
-	for(int8_t byte = 3; byte >= 0; byte--)
+#if UTILS_DIGITS_IMPL == UTILS_IMPL_LOOP
+/* Powers of ten are computed on the way, the loop stops before the power
+ * would overflow */
+uint8_t utilsGetNumberOfDecimalDigits(uint32_t number)
+{
+	uint8_t digits = 1;
+	for(uint32_t power = 10; digits < 10 && number >= power; power *= 10)
 	{
-		byteArray[byte] = integer >> (byte * 8);
+		digits++;
 	}
+	return digits;
+}
 
-	return ERROR_SUCCESS;
+uint8_t utilsGetNumberOfDecimalDigits64(uint64_t number)
+{
+	uint8_t digits = 1;
+	for(uint64_t power = 10; digits < 20 && number >= power; power *= 10)
+	{
+		digits++;
+	}
+	return digits;
+}
+#else
+/* log10(2) ~ 1233 / 4096 gives the number of digits from the bit length,
+ * it is one too big below the next power of ten which corrects the table */
+uint8_t utilsGetNumberOfDecimalDigits(uint32_t number)
+{
+	number |= 1;
+	uint32_t digits = ((32 - utilsCountLeadingZeros32(number)) * 1233) >> 12;
+	return (uint8_t)(digits + 1 - (number < decimalPowers32[digits]));
 }
 
-/**
-* @brief    Convert array of four bytes to unsigned integer
-* @note     The minimum size of byteArray must be bigger then 4
-* @param[IN]    byteArray:    pointer to array
-* @param[OUT]   integer:      pointer to unsigned integer variable
-* @return Utils error:
-*     ERROR_NULL_POINTER    - byteArray or integer are equals null
-*     ERROR_SUCCES          - conversion executed without errors
-*/
-UTILS_ERROR UTILS_ByteArray2Uint(uint8_t* byteArray, uint32_t* integer)
+uint8_t utilsGetNumberOfDecimalDigits64(uint64_t number)
+{
+	number |= 1;
+	uint32_t digits = ((64 - utilsCountLeadingZeros64(number)) * 1233) >> 12;
+	return (uint8_t)(digits + 1 - (number < decimalPowers64[digits]));
+}
+#endif
+
+/* Eight ASCII digits, the first one in the lowest byte, with three
+ * multiplications: pairs, then quadruples, then the whole chunk */
+uint32_t utilsParseEightDigits(uint64_t chunk)
+{
+	chunk -= UTILS_WORD_ASCII_ZEROS;
+	chunk = (chunk * 10) + (chunk >> 8);
+	chunk = (((chunk & 0x000000FF000000FFull) * (100 + (1000000ull << 32))) +
+	         (((chunk >> 16) & 0x000000FF000000FFull) * (1 + (10000ull << 32))))
+	        >> 32;
+	return (uint32_t)chunk;
+}
+
+/* All bytes are in <'0'..'9'>: high nibble is 3 before and after adding 6 */
+static int isEightDigits(uint64_t chunk)
+{
+	return ((chunk & 0xF0F0F0F0F0F0F0F0ull) |
+	        (((chunk + 0x0606060606060606ull) & 0xF0F0F0F0F0F0F0F0ull) >> 4))
+	       == 0x3333333333333333ull;
+}
+
+static uint64_t loadLittleEndian64(const char* bytes)
 {
-	if(byteArray == NULL || integer == NULL) return ERROR_NULL_POINTER;
+	uint64_t chunk;
+	memcpy(&chunk, bytes, sizeof(chunk));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+	chunk = __builtin_bswap64(chunk);
+#endif
+	return chunk;
+}
+
+/* Digits are right aligned in 16 characters padded with '0', so both halves
+ * are validated and converted by the same branch free kernel */
+uint8_t utilsParseDecimalDigits(const char* digits, uint32_t count,
+                                uint64_t* value)
+{
+	char padded[16];
+	if(count > sizeof(padded))
+	{
+		return 0;
+	}
+	memset(padded, '0', sizeof(padded));
+	memcpy(&padded[sizeof(padded) - count], digits, count);
+	uint64_t high = loadLittleEndian64(&padded[0]);
+	uint64_t low = loadLittleEndian64(&padded[8]);
+	*value = (uint64_t)utilsParseEightDigits(high) * 100000000u +
+	         utilsParseEightDigits(low);
+	return isEightDigits(high) & isEightDigits(low);
+}
 
-	*integer = 0;
+/* Tables have uppercase letters, 0x20 is set for lowercase ones which does
+ * not change characters of digits */
+void utilsWriteHexDigits(uint64_t number, uint8_t digits, char* end,
+                         char letterA)
+{
+#if UTILS_HEX_IMPL == UTILS_IMPL_LOOP
+	for(; digits > 0; digits--)
+	{
+		uint8_t nibble = number & 0xF;
+		*--end = (char)((nibble <= 9) ? nibble + '0' : nibble - 10 + letterA);
+		number >>= 4;
+	}
+#else
+	char lowercase = (char)(letterA - 'A');
+#if UTILS_HEX_IMPL == UTILS_IMPL_TABLE
+	for(; digits >= 2; digits -= 2)
+	{
+		uint32_t byte = (uint32_t)(number & 0xFF) * 2;
+		*--end = (char)(utilsHexBytes[byte + 1] | lowercase);
+		*--end = (char)(utilsHexBytes[byte] | lowercase);
+		number >>= 8;
+	}
+#endif
+	for(; digits > 0; digits--)
+	{
+		*--end = (char)(utilsHexNibbles[number & 0xF] | lowercase);
+		number >>= 4;
+	}
+#endif
+}
 
-	for(int8_t byte = 3; byte >= 0; byte--)
+#if UTILS_DIGITS_IMPL == UTILS_IMPL_LOOP
+/* One digit per division by 10 */
+void utilsWriteDecimalDigits(uint32_t number, char* end)
+{
+	while(number >= 10)
+	{
+		*--end = (char)('0' + number % 10);
+		number /= 10;
+	}
+	*--end = (char)('0' + number);
+}
+#else
+/* Two digits are emitted per step from the decimalDigitPairs table */
+void utilsWriteDecimalDigits(uint32_t number, char* end)
+{
+	while(number >= 100)
 	{
-		*integer <<= 8;
-		*integer |= byteArray[byte];
+		uint32_t pair = (number % 100) * 2;
+		number /= 100;
+		*--end = decimalDigitPairs[pair + 1];
+		*--end = decimalDigitPairs[pair];
 	}
+	if(number >= 10)
+	{
+		*--end = decimalDigitPairs[number * 2 + 1];
+		*--end = decimalDigitPairs[number * 2];
+	}
+	else
+	{
+		*--end = (char)('0' + number);
+	}
+}
+#endif
 
-	return ERROR_SUCCESS;
+/* Full groups of eight digits (with leading zeros) are split off by 10^8,
+ * so the rest fits in the 32-bit writer */
+void utilsWriteDecimalDigits64(uint64_t number, char* end)
+{
+	while(number > UINT32_MAX)
+	{
+		uint32_t group = (uint32_t)(number % 100000000u);
+		number /= 100000000u;
+#if UTILS_DIGITS_IMPL == UTILS_IMPL_LOOP
+		for(uint8_t digit = 0; digit < 8; digit++)
+		{
+			*--end = (char)('0' + group % 10);
+			group /= 10;
+		}
+#else
+		for(uint8_t pairs = 0; pairs < 4; pairs++)
+		{
+			uint32_t pair = (group % 100) * 2;
+			group /= 100;
+			*--end = decimalDigitPairs[pair + 1];
+			*--end = decimalDigitPairs[pair];
+		}
+#endif
+	}
+	utilsWriteDecimalDigits((uint32_t)number, end);
 }
 
+/* Word and AVX2 scans read aligned blocks which can start before the string
+ * and end after its stop byte. A block never crosses a page boundary, and
+ * the page of a string byte is mapped, so the read cannot fault. The extra
+ * bytes only change bits which are dropped or come after the stop. Address
+ * sanitizer still reports them as overflow of the object, so sanitized
+ * builds scan byte by byte. */
+#if defined(__SANITIZE_ADDRESS__)
+#define UTILS_SANITIZE_ADDRESS          1
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define UTILS_SANITIZE_ADDRESS          1
+#endif
+#endif
+
+#if defined(UTILS_SANITIZE_ADDRESS)
+static uint32_t getSizeOfAsciiStringBytes(const char* string)
+{
+	const char* ptr = string;
+	while(UTILS_IS_ASCII_SYMBOL(*ptr))
+	{
+		ptr++;
+	}
+	return ptr - string;
+}
+#else
+/* High bit is set in every byte of 'word' which stops an ASCII string:
+ * NULL, DEL or any byte >= 0x80. There are no carries between bytes. */
+static uint64_t getStopBytes(uint64_t word)
+{
+	uint64_t low = word & UTILS_WORD_LOW7;
+	uint64_t delOrHigh = (low + UTILS_WORD_ONES) | word;
+	uint64_t zero = ~((low + UTILS_WORD_LOW7) | word);
+	return (delOrHigh | zero) & UTILS_WORD_HIGH;
+}
+
+/* Eight bytes per step from aligned words */
+static uint32_t getSizeOfAsciiStringWord(const char* string)
+{
+	const char* ptr = string;
+	uint64_t word;
+	while(((uintptr_t)ptr & (sizeof(uint64_t) - 1)) != 0)
+	{
+		if(!UTILS_IS_ASCII_SYMBOL(*ptr)) return ptr - string;
+		ptr++;
+	}
+	for(;;)
+	{
+		memcpy(&word, ptr, sizeof(word));
+		if(getStopBytes(word) != 0) break;
+		ptr += sizeof(uint64_t);
+	}
+	while(UTILS_IS_ASCII_SYMBOL(*ptr))
+	{
+		ptr++;
+	}
+	return ptr - string;
+}
+
+#if UTILS_X86
+/* 32 bytes per step from aligned blocks. The first block starts before
+ * the string, so its leading bytes are dropped from the mask. */
+UTILS_TARGET("avx2")
+static uint32_t getSizeOfAsciiStringAvx2(const char* string)
+{
+	const __m256i zero = _mm256_setzero_si256();
+	const __m256i del = _mm256_set1_epi8(127);
+	uintptr_t offset = (uintptr_t)string & 31;
+	const char* ptr = string - offset;
+	uint32_t stop;
+
+	__m256i block = _mm256_load_si256((const __m256i*)ptr);
+	__m256i valid = _mm256_and_si256(_mm256_cmpgt_epi8(block, zero),
+	                                 _mm256_cmpgt_epi8(del, block));
+	stop = ~(uint32_t)_mm256_movemask_epi8(valid) >> offset;
+	if(stop != 0)
+	{
+		return __builtin_ctz(stop);
+	}
+	for(;;)
+	{
+		ptr += 32;
+		block = _mm256_load_si256((const __m256i*)ptr);
+		valid = _mm256_and_si256(_mm256_cmpgt_epi8(block, zero),
+		                         _mm256_cmpgt_epi8(del, block));
+		stop = ~(uint32_t)_mm256_movemask_epi8(valid);
+		if(stop != 0)
+		{
+			return (ptr - string) + __builtin_ctz(stop);
+		}
+	}
+}
+#endif
+#endif
+
 /**
  * @brief    Get size of ASCII sting
  *
@@ -168,14 +451,20 @@ UTILS_ERROR UTILS_ByteArray2Uint(uint8_t* byteArray, uint32_t* integer)
 UTILS_ERROR UTILS_GetSizeOfAsciiString(char* string, uint32_t* size)
 {
 	if(string == NULL || size == NULL) return ERROR_NULL_POINTER;
-	uint32_t t_size=0;
-	while(string != NULL && *string > 0 && *string < 127)
+#if defined(UTILS_SANITIZE_ADDRESS)
+	*size = getSizeOfAsciiStringBytes(string);
+	return ERROR_SUCCESS;
+#else
+#if UTILS_X86
+	if(UTILS_CPU_HAS("avx2"))
 	{
-		t_size++;
-		string++;
+		*size = getSizeOfAsciiStringAvx2(string);
+		return ERROR_SUCCESS;
 	}
-	*size = t_size;
+#endif
+	*size = getSizeOfAsciiStringWord(string);
 	return ERROR_SUCCESS;
+#endif
 }
 
 /**
@@ -187,7 +476,6 @@ UTILS_ERROR UTILS_GetSizeOfAsciiString(char* string, uint32_t* size)
  * @return Utils error:
  *     ERROR_NULL_POINTER    - digits pointer is equal null
  *     ERROR_SUCCESS         - function executed without errors
- *     ERROR_FAIL            - general error
  */
 UTILS_ERROR UTILS_GetNumberOfDigit(int32_t number,uint8_t* digits)
 {
@@ -195,81 +483,32 @@ UTILS_ERROR UTILS_GetNumberOfDigit(int32_t number,uint8_t* digits)
 	{
 		return ERROR_NULL_POINTER;
 	}
-	if(number == 0)
-	{
-		*digits = 1;
-		return ERROR_SUCCESS;
-	}
-	uint32_t divider = 1;
-	number = abs(number);
-	for(uint8_t digit = 1; digit <= UTILS_INT_MAX_DIGITS; digit++)
-	{
-		if(number / divider <= 0)
-		{
-			*digits = digit-1;
-			return ERROR_SUCCESS;
-		}
-		divider *= 10;
-	}
-	return ERROR_FAIL;
-}
-
-/**
- * @brief    Convert single ASCII character to digit
- *
- * Conversion is possible only for single byte characters which are digits:
- * 0, 1, 2..8 and 9. To convert ASCII strings, please use
- * UTILS_AsciiString2Int() function.
- *
- * @param[in]    ascii:    ASCII character
- * @param[out]   byte:     value of digit
- *
- * @return Utils error:
- *     ERROR_NULL_POINTER        - pointer to byte is NULL
- *     ERROR_CONVERSION_FAIL     - conversion is not possible.
- *                                 ASCII character is not a digit.
- *     ERROR_SUCCESS             - conversion executed without errors
- */
-UTILS_ERROR UTILS_AsciiDigit2Byte(char ascii, uint8_t* byte)
-{
-	if(byte == NULL)
-	{
-		return ERROR_NULL_POINTER;
-	}
-	if(ascii >='0' && ascii<='9')
-	{
-		*byte = ascii - '0';
-		return ERROR_SUCCESS;
-	}
-
-	return ERROR_CONVERSION_FAIL;
+	uint32_t magnitude = (number < 0) ? 0u - (uint32_t)number :
+	                                    (uint32_t)number;
+	*digits = utilsGetNumberOfDecimalDigits(magnitude);
+	return ERROR_SUCCESS;
 }
 
 /**
- * @brief    Convert byte with range <0..9> to ASCII digit
+ * @brief    Get number of digits in 64-bit integer value
  *
- * @param[in]    byte:     byte to convert
- * @param[out]   ascii:    value of digit
+ * @param[in]    number:    an integer value to calculate the number of digits
+ * @param[out]   digits:    number of digits
  *
  * @return Utils error:
- *     ERROR_NULL_POINTER        - pointer to ascii is NULL
- *     ERROR_CONVERSION_FAIL     - conversion is not possible.
- *                                 Byte is out of range
- *     ERROR_SUCCESS             - conversion executed without errors
+ *     ERROR_NULL_POINTER    - digits pointer is equal null
+ *     ERROR_SUCCESS         - function executed without errors
  */
-UTILS_ERROR UTILS_Byte2AsciiDigit(uint8_t byte, char* ascii)
+UTILS_ERROR UTILS_GetNumberOfDigit64(int64_t number, uint8_t* digits)
 {
-	if(ascii == NULL)
+	if(digits == NULL)
 	{
 		return ERROR_NULL_POINTER;
 	}
-	if(byte >=0 && byte <= 9)
-	{
-		*ascii = byte + '0';
-		return ERROR_SUCCESS;
-	}
-
-	return ERROR_CONVERSION_FAIL;
+	uint64_t magnitude = (number < 0) ? 0u - (uint64_t)number :
+	                                    (uint64_t)number;
+	*digits = utilsGetNumberOfDecimalDigits64(magnitude);
+	return ERROR_SUCCESS;
 }
 
 /**
@@ -287,13 +526,14 @@ UTILS_ERROR UTILS_Byte2AsciiDigit(uint8_t byte, char* ascii)
  * @return Utils error:
  *     ERROR_NULL_POINTER        - pointer to string or integer is NULL
  *     ERROR_CONVERSION_FAIL     - conversion is not possible.
- *                                 ASCII string is too long
+ *                                 ASCII string is too long, empty, has
+ *                                 not a digit or value is out of range
  *     ERROR_SUCCESS             - conversion executed without errors
  *     ERROR_FAIL                - general error‬
  */
 UTILS_ERROR UTILS_AsciiString2Int(char* string, int32_t* integer)
 {
-	if(string == NULL)
+	if(string == NULL || integer == NULL)
 		return ERROR_NULL_POINTER;
 
 	uint32_t size;
@@ -301,49 +541,20 @@ UTILS_ERROR UTILS_AsciiString2Int(char* string, int32_t* integer)
 	{
 		return ERROR_FAIL;
 	}
-	if(size == 1)
-	{
-		return UTILS_AsciiDigit2Byte(string[0],(uint8_t*)integer);
-	}
 	if(size > UTILS_INT_MAX_DIGITS + 1) //digits + and (possible) sign of negative
 		return ERROR_CONVERSION_FAIL;
 
-	uint8_t isNegative;
-	uint32_t multipler;
-	uint8_t noDigit;
-	uint8_t i;
-	if(string[0] == '-')
-	{
-		isNegative = 1;
-		noDigit = size - 1;
-		i = 1;
-	}
-	else
-	{
-		isNegative = 0;
-		noDigit = size;
-		i = 0;
-	}
-	multipler = pow(10,noDigit-1);
-
-	int32_t value = 0;
-	while(i<size)
+	uint8_t isNegative = (string[0] == '-');
+	uint32_t noDigit = size - isNegative;
+	uint64_t value;
+	if(noDigit == 0 ||
+	   !utilsParseDecimalDigits(&string[isNegative], noDigit, &value) ||
+	   value > (uint64_t)UTILS_INT_MAX_VALUE + isNegative)
 	{
-		uint8_t digit;
-		UTILS_ERROR error = UTILS_AsciiDigit2Byte(string[i],&digit);
-		if(error == ERROR_SUCCESS)
-		{
-			value += multipler * digit;
-			multipler /= 10;
-		}
-		else
-			return error;
-		i++;
+		return ERROR_CONVERSION_FAIL;
 	}
 
-	if(isNegative) value *= (-1);
-	*integer = value;
-
+	*integer = isNegative ? (int32_t)(0u - (uint32_t)value) : (int32_t)value;
 	return ERROR_SUCCESS;
 }
 
@@ -353,7 +564,7 @@ UTILS_ERROR UTILS_AsciiString2Int(char* string, int32_t* integer)
  * The 'string' must have allocated memory for a number with a minimum 'length'
  * equal to the number of digits in the 'integer' value plus the character sign
  * (if a value of 'integer' is negative). If the size of number is unknown
- * that is safe to use UTILS_INT_MAX_DIGITS to allocate 'string' array.
+ * that is safe to allocate 11 characters for the 'string' array.
  * All empty bytes will be set as NULL.
  *
  * @param[in]    integer:    integer value to be converted to ASCII string
@@ -365,7 +576,6 @@ UTILS_ERROR UTILS_AsciiString2Int(char* string, int32_t* integer)
  *     ERROR_CONVERSION_FAIL     - conversion is not possible.
  *                                 Length of string is too small.
  *     ERROR_SUCCESS             - conversion executed without errors
- *     ERROR_FAIL                - general error
  */
 UTILS_ERROR UTILS_Int2AsciiString(int32_t integer, char* string, uint8_t length)
 {
@@ -373,94 +583,136 @@ UTILS_ERROR UTILS_Int2AsciiString(int32_t integer, char* string, uint8_t length)
 	{
 		return ERROR_NULL_POINTER;
 	}
-	uint8_t numberOfdigits;
-	if(UTILS_GetNumberOfDigit(integer,&numberOfdigits) != ERROR_SUCCESS)
-	{
-		return ERROR_FAIL;
-	}
-	if(numberOfdigits > length)
+	uint32_t magnitude = (integer < 0) ? 0u - (uint32_t)integer :
+	                                     (uint32_t)integer;
+	uint8_t charCounter = utilsGetNumberOfDecimalDigits(magnitude) +
+	                      (integer < 0);
+	if(charCounter > length)
 	{
 		return ERROR_CONVERSION_FAIL;
 	}
-
-	uint32_t divider = pow(10,numberOfdigits-1);
-	uint8_t charCounter;
-	if(integer<0)
+	if(integer < 0)
 	{
 		string[0] = '-';
-		charCounter=1;
-		integer = abs(integer);
-		numberOfdigits++;
 	}
-	else
+	utilsWriteDecimalDigits(magnitude, &string[charCounter]);
+	for(uint8_t fill = charCounter; fill < length; fill++)
 	{
-		charCounter =0;
-	}
-
- 	while(charCounter<numberOfdigits)
-	{
-		uint8_t digit =  (integer / divider) % 10;
-		char asciiDigit;
-		if(UTILS_Byte2AsciiDigit(digit,&asciiDigit) == ERROR_SUCCESS)
-		{
-			string[charCounter] = asciiDigit;
-			divider/=10;
-		}
-		else
-		{
-			return ERROR_FAIL;
-		}
-		charCounter++;
-	}
-	if(charCounter < length)
-	{
-		for(uint8_t fill = charCounter;fill<length; fill++){
-			string[fill] = 0x00;
-		}
+		string[fill] = 0x00;
 	}
 	return ERROR_SUCCESS;
 }
 
 /**
- * @brief    Get the physical byting form of the floating point variable
+ * @brief    Convert 64-bit integer value to ASCII character string
+ *
+ * The 'string' must have allocated memory for a number with a minimum 'length'
+ * equal to the number of digits in the 'integer' value plus the character sign
+ * (if a value of 'integer' is negative). If the size of number is unknown
+ * that is safe to allocate 20 characters for the 'string' array.
+ * All empty bytes will be set as NULL.
  *
- * @param[in]    fp:         floating point variable
- * @param[out]   integer:    physical format of float stored in memory
+ * @param[in]    integer:    integer value to be converted to ASCII string
+ * @param[out]   string:     ASCII string of integer value
+ * @param[in]    length:     length of string (before conversion)
  *
  * @return Utils error:
- *     ERROR_NULL_POINTER        - pointer to integer is NULL
+ *     ERROR_NULL_POINTER        - pointer to string is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible.
+ *                                 Length of string is too small.
  *     ERROR_SUCCESS             - conversion executed without errors
  */
-UTILS_ERROR UTILS_Float2Uint(float fp, uint32_t* integer)
+UTILS_ERROR UTILS_Int2AsciiString64(int64_t integer, char* string,
+                                    uint8_t length)
 {
-	if(integer == NULL)
+	if(string == NULL)
 	{
 		return ERROR_NULL_POINTER;
 	}
-	ConversionUnion.fp = fp;
-	*integer = ConversionUnion.integer;
+	uint64_t magnitude = (integer < 0) ? 0u - (uint64_t)integer :
+	                                     (uint64_t)integer;
+	uint8_t charCounter = utilsGetNumberOfDecimalDigits64(magnitude) +
+	                      (integer < 0);
+	if(charCounter > length)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	if(integer < 0)
+	{
+		string[0] = '-';
+	}
+	utilsWriteDecimalDigits64(magnitude, &string[charCounter]);
+	for(uint8_t fill = charCounter; fill < length; fill++)
+	{
+		string[fill] = 0x00;
+	}
 	return ERROR_SUCCESS;
 }
 
 /**
- * @brief    Transform binary form to floating precision
+ * @brief    Convert array of integer values to ASCII character string
+ *
+ * Values are written one after another and split by 'separator' (there is no
+ * separator after the last value). Each value takes exactly the number of its
+ * digits plus the character sign, so the whole 'string' can be allocated as
+ * 'count' * (UTILS_INT_MAX_DIGITS + 2). The terminating NULL is written when
+ * there is space left, but it is not counted in 'written'.
  *
- * @param[in]    integer:    binary format
- * @param[out]   fp:         floating precision value
+ * @param[in]    integers:    array of integer values to be converted
+ * @param[in]    count:       number of values in 'integers' array
+ * @param[in]    separator:   character put between two values
+ * @param[out]   string:      ASCII string of integer values
+ * @param[in]    length:      length of string (before conversion)
+ * @param[out]   written:     number of characters written to string
  *
  * @return Utils error:
- *     ERROR_NULL_POINTER        - pointer to floating precision
- *                                  variable is NULL
+ *     ERROR_NULL_POINTER        - pointer to integers, string or written
+ *                                 is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible.
+ *                                 Length of string is too small. 'written'
+ *                                 holds characters of values converted so far
  *     ERROR_SUCCESS             - conversion executed without errors
  */
-UTILS_ERROR UTILS_Uint2Float(uint32_t integer, float* fp)
+UTILS_ERROR UTILS_Int32ArrayToAscii(const int32_t* integers, uint32_t count,
+                                    char separator, char* string,
+                                    uint32_t length, uint32_t* written)
 {
-	if(fp == NULL)
+	if(integers == NULL || string == NULL || written == NULL)
 	{
 		return ERROR_NULL_POINTER;
 	}
-	ConversionUnion.integer = integer;
-	*fp = ConversionUnion.fp;
+	uint32_t charCounter = 0;
+	*written = 0;
+
+	for(uint32_t index = 0; index < count; index++)
+	{
+		int32_t integer = integers[index];
+		uint32_t magnitude = (integer < 0) ? 0u - (uint32_t)integer :
+		                                     (uint32_t)integer;
+		uint32_t size = utilsGetNumberOfDecimalDigits(magnitude) + (integer < 0);
+		uint32_t needed = size + (index + 1 < count);
+
+		if(needed > length - charCounter)
+		{
+			*written = charCounter;
+			return ERROR_CONVERSION_FAIL;
+		}
+		if(integer < 0)
+		{
+			string[charCounter] = '-';
+		}
+		charCounter += size;
+		utilsWriteDecimalDigits(magnitude, &string[charCounter]);
+		if(index + 1 < count)
+		{
+			string[charCounter++] = separator;
+		}
+	}
+	if(charCounter < length)
+	{
+		string[charCounter] = 0x00;
+	}
+	*written = charCounter;
 	return ERROR_SUCCESS;
 }
 
@@ -469,15 +721,17 @@ UTILS_ERROR UTILS_Uint2Float(uint32_t integer, float* fp)
  *
  * Hexadecimal string can has "0x" and "x" on the beginning. However, all string
  * must consist only hex characters just like: 0,1,2,3,4,5,6,7,8,9,A,B,C,D,E,F
- * and also: a,b,c,d,e,f.
+ * and also: a,b,c,d,e,f. There must be at least one digit and no more than
+ * 8 significant digits (leading zeros are not counted).
  *
  * @param[in]    hex:        hexadecimal string
  * @param[out]   integer:    conversion result
  *
  * @return Utils error:
- *     ERROR_NULL_POINTER        - pointer to hex is NULL
+ *     ERROR_NULL_POINTER        - pointer to hex or integer is NULL
  *     ERROR_CONVERSION_FAIL     - conversion is not possible.
- *                                 In hex string is not allowed character
+ *                                 In hex string is not allowed character,
+ *                                 there is no digit or value is too big
  *     ERROR_SUCCESS             - conversion executed without errors
  */
 UTILS_ERROR UTILS_Hex2Uint(char* hex, uint32_t* integer)
@@ -486,45 +740,38 @@ UTILS_ERROR UTILS_Hex2Uint(char* hex, uint32_t* integer)
 	{
 		return ERROR_NULL_POINTER;
 	}
-
-	uint8_t digitCtr=0, digitOffset = 0;
-
-	if (hex[0] == 'x' || hex[0] == 'X')
-	{
-		digitOffset = 1;
-	}
-	if (hex[0] == '0' && (hex[1] == 'x' || hex[1] == 'X'))
-	{
-		digitOffset = 2;
-	}
-	char* ptr = &hex[digitOffset];
-	while(ptr++ != NULL)
-	{
-		if(*ptr != 0)break;
-		if(isHexDigit(ptr) == 0)
-		{
-			return ERROR_CONVERSION_FAIL;
-		}
-	}
-	while(digitCtr+digitOffset < UTILS_HEX_MAX_DIGITS+digitOffset)
+	uint64_t value;
+	if(parseHex(hex, UTILS_HEX_MAX_DIGITS, &value) != ERROR_SUCCESS)
 	{
-		if(isHexDigit(&hex[digitCtr+digitOffset]) == 0)
-		{
-			break;
-		}
-		digitCtr++;
+		return ERROR_CONVERSION_FAIL;
 	}
+	*integer = (uint32_t)value;
+	return ERROR_SUCCESS;
+}
 
-	uint32_t range = 1;
-	uint32_t value = 0;
-	for(int i = digitCtr+digitOffset-1; i>=digitOffset; i--)
+/**
+ * @brief    Convert hexadecimal string to 64-bit unsigned integer
+ *
+ * The rules are the same as for UTILS_Hex2Uint(), but the string can have
+ * up to 16 significant digits.
+ *
+ * @param[in]    hex:        hexadecimal string
+ * @param[out]   integer:    conversion result
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to hex or integer is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible.
+ *                                 In hex string is not allowed character,
+ *                                 there is no digit or value is too big
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_Hex2Uint64(char* hex, uint64_t* integer)
+{
+	if(hex == NULL || integer == NULL)
 	{
-		value += (UTILS_HEX2BYTE(hex[i])) * range;
-		range *= 16;
+		return ERROR_NULL_POINTER;
 	}
-	*integer = value;
-	return ERROR_SUCCESS;
-
+	return parseHex(hex, UTILS_HEX64_MAX_DIGITS, integer);
 }
 
 /**
@@ -552,41 +799,32 @@ UTILS_ERROR UTILS_Uint2Hex(uint32_t integer, char* hex, uint8_t length)
 	{
 		return ERROR_NULL_POINTER;
 	}
-	uint8_t hexLength = getNumberOfHexDigits(integer);
-	if(hexLength + 2 > length)
-	{
-		return ERROR_CONVERSION_FAIL;
-	}
-	hex[0] = '0';
-	hex[1] = 'x';
+	return writeHex(integer, getNumberOfHexDigits(integer), hex, length);
+}
 
-	const uint8_t charOffset = 2;
-	uint32_t mask  = 0xF0000000;
-	uint32_t shift = 28;
-	uint32_t digitCtr = 0;
-	uint8_t isConvStart = 0;
-	for(int nibble = 0; nibble < 8 ; nibble++)
-	{
-		uint32_t hexPart = ((mask&integer)>>shift);
-		if(hexPart != 0 || isConvStart)
-		{
-			isConvStart = 1;
-			hex[charOffset+digitCtr] = UTILS_INT2HEX(hexPart);
-			digitCtr++;
-		}
-		mask>>=4;
-		shift-=4;
-	}
-	if(integer == 0)
-	{
-		hex[2] = '0';
-		digitCtr++;
-	}
-	for(uint8_t rest = digitCtr+charOffset; rest<length; rest++)
+/**
+ * @brief    Convert 64-bit integer to hexadecimal string
+ *
+ * The rules are the same as for UTILS_Uint2Hex(). If value of integer is not
+ * known, allocate size of 'hex' as 16 digits + 2('0x') characters.
+ *
+ * @param[in]    integer:    integer value to be converted to hexadecimal string
+ * @param[out]   hex:        hexadecimal string
+ * @param[in]    length:     length of hex string (before conversion)
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to hex is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible.
+ *                                 length of hex is too short.
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_Uint2Hex64(uint64_t integer, char* hex, uint8_t length)
+{
+	if(hex == NULL)
 	{
-		hex[rest] = 0x00;
+		return ERROR_NULL_POINTER;
 	}
-	return ERROR_SUCCESS;
+	return writeHex(integer, getNumberOfHexDigits64(integer), hex, length);
 }
 
 /**
@@ -638,8 +876,10 @@ UTILS_ERROR UTILS_Float2Hex(float fp, char* hex, uint8_t length)
  *
  * Length of 'ascii' array should be adequate to size of floating point 'fp'.
  * This means that this function returns an error if the size of the integer
- * "fp" does not fit in the array. Otherwise, the "ascii" array will be filled
- * with decimal digits to the end or set the rest of the cell to 0.
+ * "fp" does not fit in the array. The decimal digits are the shortest ones
+ * which give back the same 'fp' (see UTILS_Float2AsciiShortest()) and they
+ * are cut when the array is too short. Otherwise, the "ascii" array will
+ * be filled with decimal digits to the end or set the rest of the cell to 0.
  *
  * @param[in]    fp:        floating point value
  * @param[out]   ascii:     pointer to ascii array
@@ -658,94 +898,47 @@ UTILS_ERROR UTILS_Float2AsciiString(float fp, char* string, uint8_t length)
 	{
 		return ERROR_NULL_POINTER;
 	}
-	uint8_t charOffset = 0;
+	char shortest[UTILS_FLOAT_STRING_MAX_SIZE];
+	uint32_t size;
+	uint32_t intSize = 0;
 	UTILS_ERROR error;
-	uint32_t binForm;
-
-	error = UTILS_Float2Uint(fp,&binForm);
-	if(error != ERROR_SUCCESS)
-	{
-		return ERROR_FAIL;
-	}
-
-	uint32_t signBin = UTILS_FLOAT_GET_SIGN(binForm);
-	uint32_t expBin = UTILS_FLOAT_GET_EXPONENT(binForm);
-	uint32_t manBin = UTILS_FLOAT_GET_FRACTION(binForm);
-
-	int32_t exponent = pow(2,expBin - UTILS_FLOAT_EXPONENT_BIAS);
-	float mantissa = calculateMantissa(manBin);
-	uint32_t integer = exponent * mantissa;
 
-	/*Calculate number of digits of integer part*/
-	uint8_t intSize;
-	error = UTILS_GetNumberOfDigit(integer,&intSize);
+	error = UTILS_Float2AsciiShortest(fp, UTILS_FLOAT_FIXED, shortest,
+	                                  sizeof(shortest));
 	if(error != ERROR_SUCCESS)
 	{
 		return ERROR_FAIL;
 	}
-	if(intSize + charOffset >= length)
-	{
-		return ERROR_CONVERSION_FAIL;
-	}
-	if(signBin)
-	{
-		string[0]='-';
-		charOffset++;
-	}
-	error = UTILS_Int2AsciiString(integer,&string[charOffset],length);
+	error = UTILS_GetSizeOfAsciiString(shortest, &size);
 	if(error != ERROR_SUCCESS)
 	{
 		return ERROR_FAIL;
 	}
-	charOffset += intSize;
-	if(charOffset < length)
+	/* Sign and integer part must fit, decimals are cut to the length */
+	while(intSize < size && shortest[intSize] != '.')
 	{
-		if(charOffset == length - 1)
-		{
-			string[charOffset] = 0x00;
-			return ERROR_SUCCESS;
-		}
-		string[charOffset++] = '.';
+		intSize++;
 	}
-	else
+	if(intSize >= length)
 	{
 		return ERROR_CONVERSION_FAIL;
 	}
-
-	uint32_t accurancy;
-	if(charOffset + UTILS_FLOAT_MAX_ACCURACY < length)
+	if(size > (uint32_t)length - 1)
 	{
-		accurancy = UTILS_FLOAT_MAX_ACCURACY;
+		size = length - 1;
 	}
-	else
+	if(size == intSize + 1)
 	{
-		accurancy = length - charOffset;
+		size = intSize;
 	}
-	/* Calculate decimal digits*/
-	if(fp<0.0)fp*=(-1);
-	float decimals = (fp - integer)*pow(10,accurancy);
-	uint32_t accurancyCpy = accurancy;
-	uint32_t range = pow(10,accurancyCpy)/10;
-	/* if zeros on the beginning*/
-	while(decimals < range)
-	{
-		string[charOffset++] = '0';
-		range = range / 10;
-		if(charOffset == length - 1)
-		{
-			string[charOffset] = 0x00;
-			return ERROR_SUCCESS;
-		}
-	}
-	error = UTILS_Int2AsciiString((uint32_t)decimals,&string[charOffset],length);
-	if(error != ERROR_SUCCESS)
+	uint8_t charOffset;
+	for(charOffset = 0; charOffset < size; charOffset++)
 	{
-		return ERROR_FAIL;;
+		string[charOffset] = shortest[charOffset];
 	}
-	charOffset += accurancy;
 	for(uint8_t fill = charOffset; fill < length; fill++)
 	{
-		string[fill++] = 0x00;
+		string[fill] = 0x00;
 	}
 	return ERROR_SUCCESS;
 }
@@ -0,0 +1,784 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ * @copyrights Copyrights 2019 Stanislaw Pietrzak. All rights reserved.
+ * @file utils_base64.c
+ * @author Stanislaw Pietrzak
+ * @email integralzerox@gmail.com
+ * @date 16 October 2026
+ * @brief Base64 codec (RFC 4648) of byte buffers
+ *
+ * Standard alphabet is written with '=' padding, URL-safe alphabet without
+ * it. Decoding is strict: only characters of the selected alphabet, padding
+ * only at the end of the last quantum and unused bits of the last quantum
+ * equal to 0, so every byte buffer has exactly one accepted encoding.
+ * The x86 build adds SSSE3 and AVX2 kernels (selected at run time) for the
+ * full quanta, the portable code handles the rest and every other platform.
+ *
+ * @see https://github.com/Dev4Embedded/
+ */
+
+#include "stddef.h"
+#include "utils.h"
+#include "utils_cpu.h"
+
+#define BASE64_PADDING      '='
+#define BASE64_INVALID      0xFF
+
+typedef struct
+{
+	char characters[65];
+	/* Value of every ASCII character or BASE64_INVALID */
+	uint8_t values[128];
+	/* Vector encoder: offset from value to character per class of value */
+	int8_t shifts[16];
+	/* Vector decoder: character is valid when low[c & 0x0F] & high[c >> 4]
+	 * is 0, its value is c + roll[c >> 4] or c + roll[1] for 'last' */
+	int8_t low[16];
+	int8_t high[16];
+	int8_t roll[16];
+	char last;
+}Base64Alphabet;
+
+/* Shift of value class: 'a'..'z', '0'..'9' (10 classes), 62, 63, 'A'..'Z' */
+#define BASE64_SHIFTS(c62, c63) \
+	{ 'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, \
+	  '0' - 52, '0' - 52, '0' - 52, '0' - 52, (c62) - 62, (c63) - 63, 'A', 0, 0 }
+
+static const Base64Alphabet base64Alphabets[] =
+{
+	[UTILS_BASE64_STANDARD] =
+	{
+		.characters = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/",
+		.values = {
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0xFF, 0xFF, 0xFF, 0x3F,
+			0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+			0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+			0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		},
+		.shifts = BASE64_SHIFTS('+', '/'),
+		.low = { 0x0B, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+		         0x03, 0x03, 0x07, 0x15, 0x17, 0x17, 0x17, 0x15 },
+		.high = { 0x01, 0x01, 0x02, 0x04, 0x08, 0x10, 0x08, 0x10,
+		          0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01 },
+		.roll = { 0, 63 - '/', 62 - '+', 52 - '0', -'A', -'A', 26 - 'a', 26 - 'a' },
+		.last = '/',
+	},
+	[UTILS_BASE64_URL] =
+	{
+		.characters = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_",
+		.values = {
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0xFF, 0xFF,
+			0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+			0xFF, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+			0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F,
+			0xFF, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+			0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		},
+		.shifts = BASE64_SHIFTS('-', '_'),
+		.low = { 0x0B, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+		         0x03, 0x03, 0x07, 0x37, 0x37, 0x35, 0x37, 0x27 },
+		.high = { 0x01, 0x01, 0x02, 0x04, 0x08, 0x10, 0x08, 0x20,
+		          0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01 },
+		.roll = { 0, 63 - '_', 62 - '-', 52 - '0', -'A', -'A', 26 - 'a', 26 - 'a' },
+		.last = '_',
+	},
+};
+
+static void encodeQuantum(const uint8_t* bytes, const char* characters,
+                          char* base64)
+{
+	uint32_t triple = ((uint32_t)bytes[0] << 16) | ((uint32_t)bytes[1] << 8) |
+	                  bytes[2];
+	base64[0] = characters[triple >> 18];
+	base64[1] = characters[(triple >> 12) & 0x3F];
+	base64[2] = characters[(triple >> 6) & 0x3F];
+	base64[3] = characters[triple & 0x3F];
+}
+
+/* Encode all full quanta, return number of consumed bytes */
+static uint32_t encodeScalar(const uint8_t* bytes, uint32_t size,
+                             const char* characters, char* base64)
+{
+	uint32_t byte = 0;
+	for(; byte + 3 <= size; byte += 3)
+	{
+		encodeQuantum(&bytes[byte], characters, &base64[byte / 3 * 4]);
+	}
+	return byte;
+}
+
+/* Decode full quanta, return number of consumed characters. It stops
+ * before a quantum with a character out of the alphabet (e.g. padding)
+ * or when 'bytes' has no room for the next three bytes */
+static uint32_t decodeScalar(const char* base64, uint32_t length,
+                             const uint8_t* values, uint8_t* bytes,
+                             uint32_t size)
+{
+	uint32_t chr = 0;
+	uint32_t byte = 0;
+	for(; chr + 4 <= length && byte + 3 <= size; chr += 4, byte += 3)
+	{
+		uint32_t ascii = (uint8_t)(base64[chr] | base64[chr + 1] |
+		                           base64[chr + 2] | base64[chr + 3]);
+		uint32_t first = values[base64[chr] & 0x7F];
+		uint32_t second = values[base64[chr + 1] & 0x7F];
+		uint32_t third = values[base64[chr + 2] & 0x7F];
+		uint32_t fourth = values[base64[chr + 3] & 0x7F];
+		/* Not ASCII or not in the alphabet */
+		if((ascii | first | second | third | fourth) & 0x80)
+		{
+			break;
+		}
+		uint32_t triple = (first << 18) | (second << 12) | (third << 6) | fourth;
+		bytes[byte] = (uint8_t)(triple >> 16);
+		bytes[byte + 1] = (uint8_t)(triple >> 8);
+		bytes[byte + 2] = (uint8_t)triple;
+	}
+	return chr;
+}
+
+#if UTILS_X86
+/* Four 6-bit values of every 3 bytes, each in own byte. The shuffle gives
+ * [b1 b0 b2 b1] per 32-bit lane, the multiplications move the fields */
+UTILS_TARGET("ssse3")
+static __m128i splitSsse3(__m128i input)
+{
+	input = _mm_shuffle_epi8(input, _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4,
+	                                              7, 6, 8, 7, 10, 9, 11, 10));
+	__m128i high = _mm_mulhi_epu16(_mm_and_si128(input, _mm_set1_epi32(0x0FC0FC00)),
+	                               _mm_set1_epi32(0x04000040));
+	__m128i low = _mm_mullo_epi16(_mm_and_si128(input, _mm_set1_epi32(0x003F03F0)),
+	                              _mm_set1_epi32(0x01000010));
+	return _mm_or_si128(high, low);
+}
+
+/* Value to character: class 13 for 0..25, 0 for 26..51, 1..12 above */
+UTILS_TARGET("ssse3")
+static __m128i valuesToCharactersSsse3(__m128i values, __m128i shifts)
+{
+	__m128i classes = _mm_subs_epu8(values, _mm_set1_epi8(51));
+	__m128i upper = _mm_cmplt_epi8(values, _mm_set1_epi8(26));
+	classes = _mm_or_si128(classes, _mm_and_si128(upper, _mm_set1_epi8(13)));
+	return _mm_add_epi8(values, _mm_shuffle_epi8(shifts, classes));
+}
+
+UTILS_TARGET("ssse3")
+static uint32_t encodeSsse3(const uint8_t* bytes, uint32_t size,
+                            const Base64Alphabet* alphabet, char* base64)
+{
+	const __m128i shifts = _mm_loadu_si128((const __m128i*)alphabet->shifts);
+	uint32_t byte = 0;
+	/* 16 bytes are loaded, 12 are used */
+	for(; byte + 16 <= size; byte += 12)
+	{
+		__m128i input = _mm_loadu_si128((const __m128i*)&bytes[byte]);
+		_mm_storeu_si128((__m128i*)&base64[byte / 3 * 4],
+		                 valuesToCharactersSsse3(splitSsse3(input), shifts));
+	}
+	return byte;
+}
+
+/* Characters to values, returns 0 if any character is not in alphabet */
+UTILS_TARGET("ssse3")
+static int charactersToValuesSsse3(__m128i* input, const Base64Alphabet* alphabet)
+{
+	const __m128i nibble = _mm_set1_epi8(0x0F);
+	__m128i high = _mm_and_si128(_mm_srli_epi32(*input, 4), nibble);
+	__m128i low = _mm_and_si128(*input, nibble);
+	__m128i invalid = _mm_and_si128(
+	                      _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)alphabet->low), low),
+	                      _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)alphabet->high), high));
+	if(_mm_movemask_epi8(_mm_cmpeq_epi8(invalid, _mm_setzero_si128())) != 0xFFFF)
+	{
+		return 0;
+	}
+	__m128i last = _mm_cmpeq_epi8(*input, _mm_set1_epi8(alphabet->last));
+	__m128i classes = _mm_or_si128(_mm_andnot_si128(last, high),
+	                               _mm_and_si128(last, _mm_set1_epi8(1)));
+	*input = _mm_add_epi8(*input, _mm_shuffle_epi8(
+	                          _mm_loadu_si128((const __m128i*)alphabet->roll), classes));
+	return 1;
+}
+
+/* Four 6-bit values to 3 bytes in every 32-bit lane, first 12 bytes used */
+UTILS_TARGET("ssse3")
+static __m128i mergeSsse3(__m128i values)
+{
+	values = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+	values = _mm_madd_epi16(values, _mm_set1_epi32(0x00011000));
+	return _mm_shuffle_epi8(values, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9,
+	                                              8, 14, 13, 12, -1, -1, -1, -1));
+}
+
+UTILS_TARGET("ssse3")
+static uint32_t decodeSsse3(const char* base64, uint32_t length,
+                            const Base64Alphabet* alphabet, uint8_t* bytes,
+                            uint32_t size)
+{
+	uint32_t chr = 0;
+	uint32_t byte = 0;
+	/* 16 bytes are stored, 12 are used */
+	for(; chr + 16 <= length && byte + 16 <= size; chr += 16, byte += 12)
+	{
+		__m128i input = _mm_loadu_si128((const __m128i*)&base64[chr]);
+		if(!charactersToValuesSsse3(&input, alphabet))
+		{
+			break;
+		}
+		_mm_storeu_si128((__m128i*)&bytes[byte], mergeSsse3(input));
+	}
+	return chr;
+}
+
+UTILS_TARGET("avx2")
+static uint32_t encodeAvx2(const uint8_t* bytes, uint32_t size,
+                           const Base64Alphabet* alphabet, char* base64)
+{
+	const __m256i spread = _mm256_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4,
+	                                        7, 6, 8, 7, 10, 9, 11, 10,
+	                                        1, 0, 2, 1, 4, 3, 5, 4,
+	                                        7, 6, 8, 7, 10, 9, 11, 10);
+	/* 12 bytes to the low part of every 128-bit lane */
+	const __m256i lanes = _mm256_setr_epi32(0, 1, 2, 0, 3, 4, 5, 0);
+	const __m256i shifts = _mm256_broadcastsi128_si256(
+	                           _mm_loadu_si128((const __m128i*)alphabet->shifts));
+	uint32_t byte = 0;
+	/* 32 bytes are loaded, 24 are used */
+	for(; byte + 32 <= size; byte += 24)
+	{
+		__m256i input = _mm256_loadu_si256((const __m256i*)&bytes[byte]);
+		input = _mm256_shuffle_epi8(_mm256_permutevar8x32_epi32(input, lanes), spread);
+		__m256i high = _mm256_mulhi_epu16(
+		                   _mm256_and_si256(input, _mm256_set1_epi32(0x0FC0FC00)),
+		                   _mm256_set1_epi32(0x04000040));
+		__m256i low = _mm256_mullo_epi16(
+		                  _mm256_and_si256(input, _mm256_set1_epi32(0x003F03F0)),
+		                  _mm256_set1_epi32(0x01000010));
+		__m256i values = _mm256_or_si256(high, low);
+		__m256i classes = _mm256_subs_epu8(values, _mm256_set1_epi8(51));
+		__m256i upper = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), values);
+		classes = _mm256_or_si256(classes,
+		                          _mm256_and_si256(upper, _mm256_set1_epi8(13)));
+		values = _mm256_add_epi8(values, _mm256_shuffle_epi8(shifts, classes));
+		_mm256_storeu_si256((__m256i*)&base64[byte / 3 * 4], values);
+	}
+	return byte;
+}
+
+UTILS_TARGET("avx2")
+static uint32_t decodeAvx2(const char* base64, uint32_t length,
+                           const Base64Alphabet* alphabet, uint8_t* bytes,
+                           uint32_t size)
+{
+	const __m256i nibble = _mm256_set1_epi8(0x0F);
+	const __m256i low = _mm256_broadcastsi128_si256(
+	                        _mm_loadu_si128((const __m128i*)alphabet->low));
+	const __m256i high = _mm256_broadcastsi128_si256(
+	                         _mm_loadu_si128((const __m128i*)alphabet->high));
+	const __m256i roll = _mm256_broadcastsi128_si256(
+	                         _mm_loadu_si128((const __m128i*)alphabet->roll));
+	const __m256i last = _mm256_set1_epi8(alphabet->last);
+	const __m256i gather = _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9,
+	                                        8, 14, 13, 12, -1, -1, -1, -1,
+	                                        2, 1, 0, 6, 5, 4, 10, 9,
+	                                        8, 14, 13, 12, -1, -1, -1, -1);
+	const __m256i lanes = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7);
+	uint32_t chr = 0;
+	uint32_t byte = 0;
+	/* 32 bytes are stored, 24 are used */
+	for(; chr + 32 <= length && byte + 32 <= size; chr += 32, byte += 24)
+	{
+		__m256i input = _mm256_loadu_si256((const __m256i*)&base64[chr]);
+		__m256i highNibbles = _mm256_and_si256(_mm256_srli_epi32(input, 4), nibble);
+		__m256i lowNibbles = _mm256_and_si256(input, nibble);
+		if(!_mm256_testz_si256(_mm256_shuffle_epi8(low, lowNibbles),
+		                       _mm256_shuffle_epi8(high, highNibbles)))
+		{
+			break;
+		}
+		__m256i classes = _mm256_blendv_epi8(highNibbles, _mm256_set1_epi8(1),
+		                                     _mm256_cmpeq_epi8(input, last));
+		__m256i values = _mm256_add_epi8(input, _mm256_shuffle_epi8(roll, classes));
+		values = _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+		values = _mm256_madd_epi16(values, _mm256_set1_epi32(0x00011000));
+		values = _mm256_shuffle_epi8(values, gather);
+		_mm256_storeu_si256((__m256i*)&bytes[byte],
+		                    _mm256_permutevar8x32_epi32(values, lanes));
+	}
+	return chr;
+}
+#endif
+
+/* Encode all full quanta with the best kernel, return consumed bytes */
+static uint32_t encodeBlocks(const uint8_t* bytes, uint32_t size,
+                             const Base64Alphabet* alphabet, char* base64)
+{
+	uint32_t done = 0;
+#if UTILS_X86
+	if(UTILS_CPU_HAS("avx2"))
+	{
+		done = encodeAvx2(bytes, size, alphabet, base64);
+	}
+	if(UTILS_CPU_HAS("ssse3"))
+	{
+		done += encodeSsse3(&bytes[done], size - done, alphabet,
+		                    &base64[done / 3 * 4]);
+	}
+#endif
+	return done + encodeScalar(&bytes[done], size - done,
+	                           alphabet->characters, &base64[done / 3 * 4]);
+}
+
+/* Decode full quanta with the best kernel, return consumed characters */
+static uint32_t decodeBlocks(const char* base64, uint32_t length,
+                             const Base64Alphabet* alphabet, uint8_t* bytes,
+                             uint32_t size)
+{
+	uint32_t done = 0;
+#if UTILS_X86
+	if(UTILS_CPU_HAS("avx2"))
+	{
+		done = decodeAvx2(base64, length, alphabet, bytes, size);
+	}
+	if(UTILS_CPU_HAS("ssse3"))
+	{
+		done += decodeSsse3(&base64[done], length - done, alphabet,
+		                    &bytes[done / 4 * 3], size - done / 4 * 3);
+	}
+#endif
+	return done + decodeScalar(&base64[done], length - done, alphabet->values,
+	                           &bytes[done / 4 * 3], size - done / 4 * 3);
+}
+
+/* Write 'count' - 1 bytes of the last (padded or short) quantum */
+static UTILS_ERROR decodeLastQuantum(const UTILS_BASE64_STREAM* stream,
+                                     uint8_t* bytes, uint32_t size,
+                                     uint32_t* written)
+{
+	const uint8_t* values = stream->pending;
+	if(stream->count < 2 || *written + stream->count - 1 > size)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	/* Unused bits must be 0 */
+	if((stream->count == 2 && (values[1] & 0x0F)) ||
+	   (stream->count == 3 && (values[2] & 0x03)))
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	bytes[(*written)++] = (uint8_t)((values[0] << 2) | (values[1] >> 4));
+	if(stream->count == 3)
+	{
+		bytes[(*written)++] = (uint8_t)((values[1] << 4) | (values[2] >> 2));
+	}
+	return ERROR_SUCCESS;
+}
+
+/* Decode one character of a quantum which is not decoded in blocks */
+static UTILS_ERROR decodeCharacter(UTILS_BASE64_STREAM* stream, char character,
+                                   uint8_t* bytes, uint32_t size,
+                                   uint32_t* written)
+{
+	const Base64Alphabet* alphabet = &base64Alphabets[stream->alphabet];
+	if(stream->finished)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	if(character == BASE64_PADDING)
+	{
+		/* Padding is allowed only on the third and fourth position */
+		if(stream->count < 2)
+		{
+			return ERROR_CONVERSION_FAIL;
+		}
+		stream->padding++;
+		if(stream->count + stream->padding < 4)
+		{
+			return ERROR_SUCCESS;
+		}
+		stream->finished = 1;
+		return decodeLastQuantum(stream, bytes, size, written);
+	}
+	uint8_t value = alphabet->values[character & 0x7F];
+	if((character & 0x80) || value == BASE64_INVALID || stream->padding)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	stream->pending[stream->count++] = value;
+	if(stream->count < 4)
+	{
+		return ERROR_SUCCESS;
+	}
+	if(*written + 3 > size)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	const uint8_t* values = stream->pending;
+	bytes[(*written)++] = (uint8_t)((values[0] << 2) | (values[1] >> 4));
+	bytes[(*written)++] = (uint8_t)((values[1] << 4) | (values[2] >> 2));
+	bytes[(*written)++] = (uint8_t)((values[2] << 6) | values[3]);
+	stream->count = 0;
+	return ERROR_SUCCESS;
+}
+
+/**
+ * @brief    Prepare state of streaming Base64 encoder or decoder
+ *
+ * One stream is used either for encoding or for decoding. After the final
+ * call (or an error) it must be prepared again before next use.
+ *
+ * @param[out]   stream:    state of the stream
+ * @param[in]    alphabet:  standard or URL-safe alphabet
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to stream is NULL
+ *     ERROR_CONVERSION_FAIL     - alphabet is wrong
+ *     ERROR_SUCCESS             - function executed without errors
+ */
+UTILS_ERROR UTILS_Base64Init(UTILS_BASE64_STREAM* stream,
+                             UTILS_BASE64_ALPHABET alphabet)
+{
+	if(stream == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	if(alphabet > UTILS_BASE64_URL)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	stream->count = 0;
+	stream->padding = 0;
+	stream->finished = 0;
+	stream->alphabet = (uint8_t)alphabet;
+	return ERROR_SUCCESS;
+}
+
+/**
+ * @brief    Encode next part of byte stream to Base64 characters
+ *
+ * Only full quanta (3 bytes to 4 characters) are written, up to 2 bytes are
+ * kept in the stream for the next call or UTILS_Base64EncodeFinal(). No
+ * NULL is written. 'length' must be at least (kept + size) / 3 * 4.
+ *
+ * @param[in,out] stream:   state of the stream
+ * @param[in]    bytes:     next part of the buffer to encode
+ * @param[in]    size:      number of bytes in this part
+ * @param[out]   base64:    Base64 characters
+ * @param[in]    length:    length of base64 buffer
+ * @param[out]   written:   number of characters written to base64
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to any argument is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible.
+ *                                 length of base64 is too short
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_Base64EncodeUpdate(UTILS_BASE64_STREAM* stream,
+                                     const uint8_t* bytes, uint32_t size,
+                                     char* base64, uint32_t length,
+                                     uint32_t* written)
+{
+	if(stream == NULL || bytes == NULL || base64 == NULL || written == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	*written = 0;
+	if(((uint64_t)stream->count + size) / 3 * 4 > length)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	const Base64Alphabet* alphabet = &base64Alphabets[stream->alphabet];
+	uint32_t byte = 0;
+	if(stream->count)
+	{
+		while(stream->count < 3 && byte < size)
+		{
+			stream->pending[stream->count++] = bytes[byte++];
+		}
+		if(stream->count < 3)
+		{
+			return ERROR_SUCCESS;
+		}
+		encodeQuantum(stream->pending, alphabet->characters, base64);
+		stream->count = 0;
+		*written = 4;
+	}
+	uint32_t done = encodeBlocks(&bytes[byte], size - byte, alphabet,
+	                             &base64[*written]);
+	byte += done;
+	*written += done / 3 * 4;
+	while(byte < size)
+	{
+		stream->pending[stream->count++] = bytes[byte++];
+	}
+	return ERROR_SUCCESS;
+}
+
+/**
+ * @brief    Encode bytes kept in the stream and finish the encoding
+ *
+ * Standard alphabet writes 0 or 4 characters (with '=' padding), URL-safe
+ * alphabet 0, 2 or 3 characters (without padding). No NULL is written.
+ *
+ * @param[in,out] stream:   state of the stream
+ * @param[out]   base64:    Base64 characters
+ * @param[in]    length:    length of base64 buffer
+ * @param[out]   written:   number of characters written to base64
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to any argument is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible.
+ *                                 length of base64 is too short
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_Base64EncodeFinal(UTILS_BASE64_STREAM* stream,
+                                    char* base64, uint32_t length,
+                                    uint32_t* written)
+{
+	if(stream == NULL || base64 == NULL || written == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	*written = 0;
+	if(stream->count == 0)
+	{
+		return ERROR_SUCCESS;
+	}
+	uint32_t characters = (stream->alphabet == UTILS_BASE64_STANDARD) ?
+	                      4 : stream->count + 1u;
+	if(characters > length)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	char quantum[4];
+	uint8_t last[3] = { stream->pending[0], 0, 0 };
+	if(stream->count == 2)
+	{
+		last[1] = stream->pending[1];
+	}
+	encodeQuantum(last, base64Alphabets[stream->alphabet].characters, quantum);
+	for(uint32_t chr = 0; chr < characters; chr++)
+	{
+		base64[chr] = (chr <= stream->count) ? quantum[chr] : BASE64_PADDING;
+	}
+	stream->count = 0;
+	*written = characters;
+	return ERROR_SUCCESS;
+}
+
+/**
+ * @brief    Decode next part of Base64 character stream to bytes
+ *
+ * Only full quanta are written, characters of not finished quantum are kept
+ * in the stream. Decoding is strict: any character out of the alphabet
+ * (white space too), misplaced padding or data after padding is an error.
+ * On error 'written' bytes are valid and the stream must be prepared again.
+ *
+ * @param[in,out] stream:   state of the stream
+ * @param[in]    base64:    next part of the Base64 characters
+ * @param[in]    length:    number of characters in this part
+ * @param[out]   bytes:     conversion result
+ * @param[in]    size:      size of bytes buffer
+ * @param[out]   written:   number of bytes written to bytes buffer
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to any argument is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible. Character is
+ *                                 not allowed or bytes buffer is too small
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_Base64DecodeUpdate(UTILS_BASE64_STREAM* stream,
+                                     const char* base64, uint32_t length,
+                                     uint8_t* bytes, uint32_t size,
+                                     uint32_t* written)
+{
+	if(stream == NULL || base64 == NULL || bytes == NULL || written == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	*written = 0;
+	uint32_t chr = 0;
+	UTILS_ERROR error;
+	for(; chr < length && (stream->count || stream->padding); chr++)
+	{
+		error = decodeCharacter(stream, base64[chr], bytes, size, written);
+		if(error)
+		{
+			return error;
+		}
+	}
+	if(!stream->finished)
+	{
+		uint32_t done = decodeBlocks(&base64[chr], length - chr,
+		                             &base64Alphabets[stream->alphabet],
+		                             &bytes[*written], size - *written);
+		chr += done;
+		*written += done / 4 * 3;
+	}
+	for(; chr < length; chr++)
+	{
+		error = decodeCharacter(stream, base64[chr], bytes, size, written);
+		if(error)
+		{
+			return error;
+		}
+	}
+	return ERROR_SUCCESS;
+}
+
+/**
+ * @brief    Finish decoding of Base64 character stream
+ *
+ * Standard alphabet requires padded input, so nothing is left to decode.
+ * URL-safe alphabet accepts input without padding, then the last 2 or 3
+ * characters kept in the stream give 1 or 2 bytes.
+ *
+ * @param[in,out] stream:   state of the stream
+ * @param[out]   bytes:     conversion result
+ * @param[in]    size:      size of bytes buffer
+ * @param[out]   written:   number of bytes written to bytes buffer
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to any argument is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible. Input is cut,
+ *                                 padding is missing or bytes buffer is
+ *                                 too small
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_Base64DecodeFinal(UTILS_BASE64_STREAM* stream,
+                                    uint8_t* bytes, uint32_t size,
+                                    uint32_t* written)
+{
+	if(stream == NULL || bytes == NULL || written == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	*written = 0;
+	if(stream->finished || (stream->count == 0 && stream->padding == 0))
+	{
+		return ERROR_SUCCESS;
+	}
+	if(stream->padding || stream->alphabet != UTILS_BASE64_URL)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	stream->finished = 1;
+	return decodeLastQuantum(stream, bytes, size, written);
+}
+
+/**
+ * @brief    Convert byte buffer to Base64 ASCII string
+ *
+ * 'length' of 'base64' must be at least UTILS_BASE64_ENCODED_SIZE(size)
+ * for standard alphabet (padded), URL-safe alphabet needs (size * 4 + 2) / 3
+ * characters. The terminating NULL is written when there is space left.
+ *
+ * @param[in]    bytes:     buffer to convert
+ * @param[in]    size:      number of bytes in buffer
+ * @param[in]    alphabet:  standard or URL-safe alphabet
+ * @param[out]   base64:    Base64 string
+ * @param[in]    length:    length of base64 string (before conversion)
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to bytes or base64 is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible. length of
+ *                                 base64 is too short or alphabet is wrong
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_BytesToBase64(const uint8_t* bytes, uint32_t size,
+                                UTILS_BASE64_ALPHABET alphabet,
+                                char* base64, uint32_t length)
+{
+	UTILS_BASE64_STREAM stream;
+	uint32_t body, tail;
+	if(bytes == NULL || base64 == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	UTILS_ERROR error = UTILS_Base64Init(&stream, alphabet);
+	if(error)
+	{
+		return error;
+	}
+	uint64_t characters = (alphabet == UTILS_BASE64_STANDARD) ?
+	                      UTILS_BASE64_ENCODED_SIZE((uint64_t)size) :
+	                      ((uint64_t)size * 4 + 2) / 3;
+	if(characters > length)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	UTILS_Base64EncodeUpdate(&stream, bytes, size, base64, length, &body);
+	UTILS_Base64EncodeFinal(&stream, &base64[body], length - body, &tail);
+	if(body + tail < length)
+	{
+		base64[body + tail] = 0x00;
+	}
+	return ERROR_SUCCESS;
+}
+
+/**
+ * @brief    Convert Base64 ASCII string to byte buffer
+ *
+ * Decoding is strict, see UTILS_Base64DecodeUpdate(). Standard alphabet
+ * requires padding, URL-safe alphabet accepts input with or without it.
+ * UTILS_BASE64_DECODED_SIZE(length) is always enough for 'size'.
+ *
+ * @param[in]    base64:    Base64 string
+ * @param[in]    length:    number of characters to convert
+ * @param[in]    alphabet:  standard or URL-safe alphabet
+ * @param[out]   bytes:     conversion result
+ * @param[in]    size:      size of bytes buffer
+ * @param[out]   written:   number of bytes written to bytes buffer
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to any argument is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible. bytes buffer
+ *                                 is too small, alphabet is wrong or
+ *                                 base64 string is not valid
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_Base64ToBytes(const char* base64, uint32_t length,
+                                UTILS_BASE64_ALPHABET alphabet,
+                                uint8_t* bytes, uint32_t size,
+                                uint32_t* written)
+{
+	UTILS_BASE64_STREAM stream;
+	uint32_t tail;
+	if(base64 == NULL || bytes == NULL || written == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	*written = 0;
+	UTILS_ERROR error = UTILS_Base64Init(&stream, alphabet);
+	if(error == ERROR_SUCCESS)
+	{
+		error = UTILS_Base64DecodeUpdate(&stream, base64, length,
+		                                 bytes, size, written);
+	}
+	if(error == ERROR_SUCCESS)
+	{
+		error = UTILS_Base64DecodeFinal(&stream, &bytes[*written],
+		                                size - *written, &tail);
+		*written += tail;
+	}
+	return error;
+}
@@ -0,0 +1,454 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ * @copyrights Copyrights 2019 Stanislaw Pietrzak. All rights reserved.
+ * @file utils_bin.c
+ * @author Stanislaw Pietrzak
+ * @email integralzerox@gmail.com
+ * @date 16 October 2026
+ * @brief Binary and octal strings of 32-bit integers
+ *
+ * The strings follow the hexadecimal ones: "0b" or "0o" prefix and the
+ * significant digits. Eight digits are expanded in one step: a multiply and
+ * mask spreads 8 bits to 8 bytes, shifts and masks spread 24 bits to eight
+ * octal digits. Binary arrays use an AVX2 shuffle for whole 32-bit values
+ * when the CPU has it.
+ *
+ * @see https://github.com/Dev4Embedded/
+ */
+
+#include "stddef.h"
+#include "utils.h"
+#include "utils_private.h"
+#include "utils_cpu.h"
+
+#define UTILS_SIZE_OF_BIN_PREFIX    2
+#define UTILS_BIN_MAX_DIGITS        32
+#define UTILS_OCT_MAX_DIGITS        11
+
+#define UTILS_WORD_ASCII_ZEROS      0x3030303030303030ull
+
+/* Store 'word' from the lowest byte, independent of host byte order
+ * (compilers merge it to a single store on little endian) */
+static void storeWord(uint64_t word, char* string)
+{
+	string[0] = (char)word;
+	string[1] = (char)(word >> 8);
+	string[2] = (char)(word >> 16);
+	string[3] = (char)(word >> 24);
+	string[4] = (char)(word >> 32);
+	string[5] = (char)(word >> 40);
+	string[6] = (char)(word >> 48);
+	string[7] = (char)(word >> 56);
+}
+
+/* Eight binary digits of 'byte', the most significant bit in the lowest byte:
+ * the copies of 'byte' keep one bit each, which is moved to bit 7 by the
+ * addition (no carry leaves a byte) */
+static uint64_t binaryDigits(uint8_t byte)
+{
+	uint64_t bits = (byte * 0x0101010101010101ull) & 0x0102040810204080ull;
+	bits = ((bits + 0x7F7F7F7F7F7F7F7Full) & 0x8080808080808080ull) >> 7;
+	return bits + UTILS_WORD_ASCII_ZEROS;
+}
+
+/* Eight octal digits of 24 bits, the least significant one in the lowest
+ * byte: halves of 12, quarters of 6 and eighths of 3 bits are spread */
+static uint64_t octalDigits(uint32_t bits)
+{
+	uint64_t digits = (bits & 0xFFFu) | ((uint64_t)((bits >> 12) & 0xFFFu) << 32);
+	digits = (digits & 0x0000003F0000003Full) |
+	         ((digits & 0x00000FC000000FC0ull) << 10);
+	digits = (digits & 0x0007000700070007ull) |
+	         ((digits & 0x0038003800380038ull) << 5);
+	return digits + UTILS_WORD_ASCII_ZEROS;
+}
+
+/* All 32 binary digits of 'integer' */
+static void writeBinary(uint32_t integer, char* string)
+{
+	storeWord(binaryDigits((uint8_t)(integer >> 24)), &string[0]);
+	storeWord(binaryDigits((uint8_t)(integer >> 16)), &string[8]);
+	storeWord(binaryDigits((uint8_t)(integer >> 8)), &string[16]);
+	storeWord(binaryDigits((uint8_t)integer), &string[24]);
+}
+
+/* All 11 octal digits of 'integer' */
+static void writeOctal(uint32_t integer, char* string)
+{
+	uint64_t low = octalDigits(integer & 0xFFFFFFu);
+	string[3] = (char)(low >> 56);
+	string[4] = (char)(low >> 48);
+	string[5] = (char)(low >> 40);
+	string[6] = (char)(low >> 32);
+	string[7] = (char)(low >> 24);
+	string[8] = (char)(low >> 16);
+	string[9] = (char)(low >> 8);
+	string[10] = (char)low;
+	string[2] = (char)('0' + ((integer >> 24) & 0x7));
+	string[1] = (char)('0' + ((integer >> 27) & 0x7));
+	string[0] = (char)('0' + (integer >> 30));
+}
+
+/* Prefix and the last 'digits' of 'all' digits, rest is set as NULL */
+static UTILS_ERROR writeSignificant(const char* all, uint8_t total,
+                                    uint8_t digits, char prefix,
+                                    char* string, uint8_t length)
+{
+	uint8_t charCounter = digits + UTILS_SIZE_OF_BIN_PREFIX;
+	if(charCounter > length)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	string[0] = '0';
+	string[1] = prefix;
+	for(uint8_t digit = 0; digit < digits; digit++)
+	{
+		string[UTILS_SIZE_OF_BIN_PREFIX + digit] = all[total - digits + digit];
+	}
+	for(uint8_t fill = charCounter; fill < length; fill++)
+	{
+		string[fill] = 0x00;
+	}
+	return ERROR_SUCCESS;
+}
+
+/* Optional "0<prefix>" or "<prefix>", at least one digit and no more than
+ * 'maxDigits' significant digits of 'bits' each */
+static UTILS_ERROR parseDigits(const char* string, char prefix, uint8_t bits,
+                               uint8_t maxDigits, uint64_t* integer)
+{
+	if((string[0] | 0x20) == prefix)
+	{
+		string += 1;
+	}
+	else if(string[0] == '0' && (string[1] | 0x20) == prefix)
+	{
+		string += UTILS_SIZE_OF_BIN_PREFIX;
+	}
+	if(*string == 0x00)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	while(*string == '0')
+	{
+		string++;
+	}
+	uint64_t value = 0;
+	for(uint8_t digitCtr = 0; *string != 0x00; digitCtr++, string++)
+	{
+		uint8_t digit = (uint8_t)(*string - '0');
+		if(digitCtr == maxDigits || digit >> bits)
+		{
+			return ERROR_CONVERSION_FAIL;
+		}
+		value = (value << bits) | digit;
+	}
+	*integer = value;
+	return ERROR_SUCCESS;
+}
+
+#if UTILS_X86
+/* 32 binary digits of every value: each byte goes to its 8 positions,
+ * a compare with the bit of the position gives -1 for '1' */
+UTILS_TARGET("avx2")
+static uint32_t uint32ToBinAvx2(const uint32_t* integers, uint32_t count,
+                                char separator, char* string)
+{
+	const __m256i spread = _mm256_setr_epi8(3, 3, 3, 3, 3, 3, 3, 3,
+	                                        2, 2, 2, 2, 2, 2, 2, 2,
+	                                        1, 1, 1, 1, 1, 1, 1, 1,
+	                                        0, 0, 0, 0, 0, 0, 0, 0);
+	const __m256i bits = _mm256_set1_epi64x((int64_t)0x0102040810204080ull);
+	const __m256i zeros = _mm256_set1_epi8('0');
+	uint32_t integer = 0;
+	for(; integer < count; integer++)
+	{
+		char* value = &string[integer * (UTILS_BIN_MAX_DIGITS + 3)];
+		__m256i bytes = _mm256_set1_epi32((int32_t)integers[integer]);
+		bytes = _mm256_and_si256(_mm256_shuffle_epi8(bytes, spread), bits);
+		value[0] = '0';
+		value[1] = 'b';
+		_mm256_storeu_si256((__m256i*)&value[UTILS_SIZE_OF_BIN_PREFIX],
+		                    _mm256_sub_epi8(zeros, _mm256_cmpeq_epi8(bytes, bits)));
+		if(integer + 1 < count)
+		{
+			value[UTILS_SIZE_OF_BIN_PREFIX + UTILS_BIN_MAX_DIGITS] = separator;
+		}
+	}
+	return integer;
+}
+#endif
+
+/* Check of length for 'count' values of 'width' characters with separators */
+static UTILS_ERROR checkArrayLength(uint32_t count, uint32_t width,
+                                    uint32_t length, uint32_t* total)
+{
+	uint64_t characters = count ? (uint64_t)count * (width + 1) - 1 : 0;
+	if(characters > length)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	*total = (uint32_t)characters;
+	return ERROR_SUCCESS;
+}
+
+/**
+ * @brief    Convert integer to binary string
+ *
+ * The string has "0b" prefix and the significant digits of 'integer' (one
+ * digit for 0) and the rest of the 'bin' is set as NULL, just like
+ * UTILS_Uint2Hex(). If value of integer is not known, allocate size of
+ * 'bin' as 32 digits + 2('0b') characters.
+ *
+ * @param[in]    integer:    integer value to be converted to binary string
+ * @param[out]   bin:        binary string
+ * @param[in]    length:     length of bin string (before conversion)
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to bin is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible.
+ *                                 length of bin is too short.
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_Uint2Bin(uint32_t integer, char* bin, uint8_t length)
+{
+	char all[UTILS_BIN_MAX_DIGITS];
+	if(bin == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	uint8_t digits = (uint8_t)(32 - utilsCountLeadingZeros32(integer | 1));
+	writeBinary(integer, all);
+	return writeSignificant(all, UTILS_BIN_MAX_DIGITS, digits, 'b', bin, length);
+}
+
+/**
+ * @brief    Convert binary string to unsigned integer
+ *
+ * Binary string can has "0b" and "b" on the beginning, then only '0' and
+ * '1' characters to the terminating NULL. There must be at least one digit
+ * and no more than 32 significant digits (leading zeros are not counted).
+ *
+ * @param[in]    bin:        binary string
+ * @param[out]   integer:    conversion result
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to bin or integer is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible.
+ *                                 In bin string is not allowed character,
+ *                                 there is no digit or value is too big
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_Bin2Uint(const char* bin, uint32_t* integer)
+{
+	if(bin == NULL || integer == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	uint64_t value;
+	if(parseDigits(bin, 'b', 1, UTILS_BIN_MAX_DIGITS, &value) != ERROR_SUCCESS)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	*integer = (uint32_t)value;
+	return ERROR_SUCCESS;
+}
+
+/**
+ * @brief    Convert integer to octal string
+ *
+ * The string has "0o" prefix and the significant digits of 'integer' (one
+ * digit for 0) and the rest of the 'oct' is set as NULL, just like
+ * UTILS_Uint2Hex(). If value of integer is not known, allocate size of
+ * 'oct' as 11 digits + 2('0o') characters.
+ *
+ * @param[in]    integer:    integer value to be converted to octal string
+ * @param[out]   oct:        octal string
+ * @param[in]    length:     length of oct string (before conversion)
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to oct is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible.
+ *                                 length of oct is too short.
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_Uint2Oct(uint32_t integer, char* oct, uint8_t length)
+{
+	char all[UTILS_OCT_MAX_DIGITS];
+	if(oct == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	uint32_t bitLength = 32 - utilsCountLeadingZeros32(integer | 1);
+	uint8_t digits = (uint8_t)((bitLength + 2) / 3);
+	writeOctal(integer, all);
+	return writeSignificant(all, UTILS_OCT_MAX_DIGITS, digits, 'o', oct, length);
+}
+
+/**
+ * @brief    Convert octal string to unsigned integer
+ *
+ * Octal string can has "0o" and "o" on the beginning, then only '0'..'7'
+ * characters to the terminating NULL. There must be at least one digit and
+ * the value must fit in 32 bits (leading zeros are not counted).
+ *
+ * @param[in]    oct:        octal string
+ * @param[out]   integer:    conversion result
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to oct or integer is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible.
+ *                                 In oct string is not allowed character,
+ *                                 there is no digit or value is too big
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_Oct2Uint(const char* oct, uint32_t* integer)
+{
+	if(oct == NULL || integer == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	uint64_t value;
+	if(parseDigits(oct, 'o', 3, UTILS_OCT_MAX_DIGITS, &value) != ERROR_SUCCESS ||
+	   value > UINT32_MAX)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	*integer = (uint32_t)value;
+	return ERROR_SUCCESS;
+}
+
+/**
+ * @brief    Convert array of integers to binary strings of fixed width
+ *
+ * Every value is written as "0b" and all 32 digits (with leading zeros), so
+ * the columns of register dumps are aligned, and values are split by
+ * 'separator'. The whole 'string' takes 'count' * 35 - 1 characters. The
+ * terminating NULL is written when there is space left, but it is not
+ * counted in 'written'.
+ *
+ * @param[in]    integers:    array of integer values to be converted
+ * @param[in]    count:       number of values in 'integers' array
+ * @param[in]    separator:   character put between two values
+ * @param[out]   string:      binary strings of the values
+ * @param[in]    length:      length of string (before conversion)
+ * @param[out]   written:     number of characters written to string
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to integers, string or written
+ *                                 is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible.
+ *                                 Length of string is too small
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_Uint32ArrayToBin(const uint32_t* integers, uint32_t count,
+                                   char separator, char* string,
+                                   uint32_t length, uint32_t* written)
+{
+	const uint32_t width = UTILS_SIZE_OF_BIN_PREFIX + UTILS_BIN_MAX_DIGITS;
+	uint32_t total;
+	if(integers == NULL || string == NULL || written == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	*written = 0;
+	if(checkArrayLength(count, width, length, &total) != ERROR_SUCCESS)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	uint32_t done = 0;
+#if UTILS_X86
+	/* The last 32-byte store may not fit in the end of the string */
+	if(UTILS_CPU_HAS("avx2") && count > 1)
+	{
+		done = uint32ToBinAvx2(integers, count - 1, separator, string);
+		string[done * (width + 1) - 1] = separator;
+	}
+#endif
+	for(uint32_t integer = done; integer < count; integer++)
+	{
+		char* value = &string[integer * (width + 1)];
+		value[0] = '0';
+		value[1] = 'b';
+		writeBinary(integers[integer], &value[UTILS_SIZE_OF_BIN_PREFIX]);
+		if(integer + 1 < count)
+		{
+			value[width] = separator;
+		}
+	}
+	if(total < length)
+	{
+		string[total] = 0x00;
+	}
+	*written = total;
+	return ERROR_SUCCESS;
+}
+
+/**
+ * @brief    Convert array of integers to octal strings of fixed width
+ *
+ * Every value is written as "0o" and all 11 digits (with leading zeros) and
+ * values are split by 'separator'. The whole 'string' takes 'count' * 14 - 1
+ * characters. The terminating NULL is written when there is space left, but
+ * it is not counted in 'written'.
+ *
+ * @param[in]    integers:    array of integer values to be converted
+ * @param[in]    count:       number of values in 'integers' array
+ * @param[in]    separator:   character put between two values
+ * @param[out]   string:      octal strings of the values
+ * @param[in]    length:      length of string (before conversion)
+ * @param[out]   written:     number of characters written to string
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to integers, string or written
+ *                                 is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible.
+ *                                 Length of string is too small
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_Uint32ArrayToOct(const uint32_t* integers, uint32_t count,
+                                   char separator, char* string,
+                                   uint32_t length, uint32_t* written)
+{
+	const uint32_t width = UTILS_SIZE_OF_BIN_PREFIX + UTILS_OCT_MAX_DIGITS;
+	uint32_t total;
+	if(integers == NULL || string == NULL || written == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	*written = 0;
+	if(checkArrayLength(count, width, length, &total) != ERROR_SUCCESS)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	for(uint32_t integer = 0; integer < count; integer++)
+	{
+		char* value = &string[integer * (width + 1)];
+		value[0] = '0';
+		value[1] = 'o';
+		writeOctal(integers[integer], &value[UTILS_SIZE_OF_BIN_PREFIX]);
+		if(integer + 1 < count)
+		{
+			value[width] = separator;
+		}
+	}
+	if(total < length)
+	{
+		string[total] = 0x00;
+	}
+	*written = total;
+	return ERROR_SUCCESS;
+}
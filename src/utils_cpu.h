@@ -0,0 +1,40 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ * @copyrights Copyrights 2019 Stanislaw Pietrzak. All rights reserved.
+ * @file utils_cpu.h
+ * @author Stanislaw Pietrzak
+ * @email integralzerox@gmail.com
+ * @date 16 October 2026
+ * @brief Private CPU feature detection of the library
+ *
+ * Vector kernels are compiled with a per-function target attribute and are
+ * selected at run time, so the library still runs on every CPU of the
+ * architecture it was built for. On other compilers and architectures only
+ * the portable implementations are built.
+ */
+#ifndef SRC_UTILS_CPU_H_
+#define SRC_UTILS_CPU_H_
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define UTILS_X86                   1
+#include "immintrin.h"
+#define UTILS_TARGET(isa)           __attribute__((target(isa)))
+#define UTILS_CPU_HAS(feature)      __builtin_cpu_supports(feature)
+#else
+#define UTILS_X86                   0
+#endif
+
+#endif /* SRC_UTILS_CPU_H_ */
@@ -0,0 +1,456 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ * @copyrights Copyrights 2019 Stanislaw Pietrzak. All rights reserved.
+ * @file utils_crc.c
+ * @author Stanislaw Pietrzak
+ * @email integralzerox@gmail.com
+ * @date 16 October 2026
+ * @brief CRC engines of 8, 16 and 32-bit models
+ *
+ * Every model is computed in a 32-bit register. Models with MSB first bit
+ * order keep the CRC in the top bits and shift left, reflected (LSB first)
+ * models keep it in the low bits and shift right. So a CRC-8 is a CRC-32
+ * with the polynomial multiplied by x^24, and one implementation of every
+ * engine serves all widths.
+ *
+ * The bitwise engine has no table, the nibble engine uses 16 entries
+ * (64 bytes) and slicing-by-8 uses 8 tables of 256 entries (8 KB) to take
+ * eight bytes per step. On x86 with PCLMULQDQ the CLMUL engine folds
+ * 64 bytes per step with carry-less multiplications by x^n mod P. The bytes
+ * of MSB first models are bit reversed with pshufb, so the same reflected
+ * folding serves both bit orders. The folded 16 bytes are reduced with the
+ * slicing-by-8 table, so no Barrett constants are needed.
+ *
+ * Engines above the profile of the library (UTILS_CRC_IMPL) are not built:
+ * TINY has only the bitwise engine, BALANCED also the nibble one. They are
+ * replaced with the fastest engine of the profile, so the same calls work
+ * in every product.
+ *
+ * @see https://github.com/Dev4Embedded/
+ */
+
+#include "stddef.h"
+#include "utils.h"
+#include "utils_cpu.h"
+
+#define CRC_TABLE_ENTRIES       256
+#define CRC_FOLD_BLOCK          64
+
+#if UTILS_CRC_IMPL == UTILS_IMPL_LOOP
+#define CRC_ENGINE_MAX          UTILS_CRC_BITWISE
+#elif UTILS_CRC_IMPL == UTILS_IMPL_NIBBLE
+#define CRC_ENGINE_MAX          UTILS_CRC_NIBBLE
+#else
+#define CRC_ENGINE_MAX          UTILS_CRC_CLMUL
+#endif
+
+static uint32_t reverse32(uint32_t value)
+{
+	value = ((value >> 1) & 0x55555555u) | ((value & 0x55555555u) << 1);
+	value = ((value >> 2) & 0x33333333u) | ((value & 0x33333333u) << 2);
+	value = ((value >> 4) & 0x0F0F0F0Fu) | ((value & 0x0F0F0F0Fu) << 4);
+	value = ((value >> 8) & 0x00FF00FFu) | ((value & 0x00FF00FFu) << 8);
+	return (value >> 16) | (value << 16);
+}
+
+/* Register after 'bits' bits of 'value', without any data */
+static uint32_t shiftBits(const UTILS_CRC* crc, uint32_t value, uint32_t bits)
+{
+	for(; bits > 0; bits--)
+	{
+		if(crc->reflected)
+		{
+			value = (value >> 1) ^ ((0u - (value & 1)) & crc->polynomial);
+		}
+		else
+		{
+			value = (value << 1) ^ ((0u - (value >> 31)) & crc->polynomial);
+		}
+	}
+	return value;
+}
+
+static uint32_t updateBitwise(const UTILS_CRC* crc, uint32_t value,
+                              const uint8_t* bytes, uint32_t size)
+{
+	for(uint32_t pos = 0; pos < size; pos++)
+	{
+		value ^= crc->reflected ? bytes[pos] : (uint32_t)bytes[pos] << 24;
+		value = shiftBits(crc, value, 8);
+	}
+	return value;
+}
+
+#if UTILS_CRC_IMPL != UTILS_IMPL_LOOP
+static uint32_t updateNibble(const UTILS_CRC* crc, uint32_t value,
+                             const uint8_t* bytes, uint32_t size)
+{
+	const uint32_t* table = crc->table;
+	if(crc->reflected)
+	{
+		for(uint32_t pos = 0; pos < size; pos++)
+		{
+			value ^= bytes[pos];
+			value = (value >> 4) ^ table[value & 0xF];
+			value = (value >> 4) ^ table[value & 0xF];
+		}
+	}
+	else
+	{
+		for(uint32_t pos = 0; pos < size; pos++)
+		{
+			value ^= (uint32_t)bytes[pos] << 24;
+			value = (value << 4) ^ table[value >> 28];
+			value = (value << 4) ^ table[value >> 28];
+		}
+	}
+	return value;
+}
+#endif
+
+#if UTILS_CRC_IMPL == UTILS_IMPL_TABLE
+static uint32_t loadLittleEndian32(const uint8_t* bytes)
+{
+	return (uint32_t)bytes[0] | (uint32_t)bytes[1] << 8 |
+	       (uint32_t)bytes[2] << 16 | (uint32_t)bytes[3] << 24;
+}
+
+static uint32_t loadBigEndian32(const uint8_t* bytes)
+{
+	return (uint32_t)bytes[0] << 24 | (uint32_t)bytes[1] << 16 |
+	       (uint32_t)bytes[2] << 8 | (uint32_t)bytes[3];
+}
+
+static uint32_t updateSlicing8(const UTILS_CRC* crc, uint32_t value,
+                               const uint8_t* bytes, uint32_t size)
+{
+	const uint32_t (*table)[CRC_TABLE_ENTRIES] =
+	    (const uint32_t (*)[CRC_TABLE_ENTRIES])crc->table;
+	uint32_t pos = 0;
+	if(crc->reflected)
+	{
+		for(; size - pos >= 8; pos += 8)
+		{
+			uint32_t low = loadLittleEndian32(&bytes[pos]) ^ value;
+			uint32_t high = loadLittleEndian32(&bytes[pos + 4]);
+			value = table[7][low & 0xFF] ^ table[6][(low >> 8) & 0xFF] ^
+			        table[5][(low >> 16) & 0xFF] ^ table[4][low >> 24] ^
+			        table[3][high & 0xFF] ^ table[2][(high >> 8) & 0xFF] ^
+			        table[1][(high >> 16) & 0xFF] ^ table[0][high >> 24];
+		}
+		for(; pos < size; pos++)
+		{
+			value = (value >> 8) ^ table[0][(value ^ bytes[pos]) & 0xFF];
+		}
+	}
+	else
+	{
+		for(; size - pos >= 8; pos += 8)
+		{
+			uint32_t high = loadBigEndian32(&bytes[pos]) ^ value;
+			uint32_t low = loadBigEndian32(&bytes[pos + 4]);
+			value = table[7][high >> 24] ^ table[6][(high >> 16) & 0xFF] ^
+			        table[5][(high >> 8) & 0xFF] ^ table[4][high & 0xFF] ^
+			        table[3][low >> 24] ^ table[2][(low >> 16) & 0xFF] ^
+			        table[1][(low >> 8) & 0xFF] ^ table[0][low & 0xFF];
+		}
+		for(; pos < size; pos++)
+		{
+			value = (value << 8) ^ table[0][(value >> 24) ^ bytes[pos]];
+		}
+	}
+	return value;
+}
+
+#if UTILS_X86
+/* Bits of every byte in reverse order, MSB first bytes to reflected ones */
+UTILS_TARGET("pclmul,ssse3")
+static __m128i reverseBits(__m128i bytes)
+{
+	const __m128i reversedLow = _mm_setr_epi8(0x00, 0x08, 0x04, 0x0C, 0x02, 0x0A,
+	                                          0x06, 0x0E, 0x01, 0x09, 0x05, 0x0D,
+	                                          0x03, 0x0B, 0x07, 0x0F);
+	const __m128i reversedHigh = _mm_slli_epi16(reversedLow, 4);
+	const __m128i nibble = _mm_set1_epi8(0x0F);
+	__m128i low = _mm_and_si128(bytes, nibble);
+	__m128i high = _mm_and_si128(_mm_srli_epi16(bytes, 4), nibble);
+	return _mm_or_si128(_mm_shuffle_epi8(reversedHigh, low),
+	                    _mm_shuffle_epi8(reversedLow, high));
+}
+
+UTILS_TARGET("pclmul,ssse3")
+static __m128i loadBlock(const UTILS_CRC* crc, const uint8_t* bytes)
+{
+	__m128i block = _mm_loadu_si128((const __m128i*)bytes);
+	return crc->reflected ? block : reverseBits(block);
+}
+
+/* X * x^D mod P: the low half is multiplied by x^(D+63), the high half
+ * by x^(D-1), the extra x comes from the reflected product */
+UTILS_TARGET("pclmul,ssse3")
+static __m128i fold(__m128i value, __m128i constants)
+{
+	return _mm_xor_si128(_mm_clmulepi64_si128(value, constants, 0x00),
+	                     _mm_clmulepi64_si128(value, constants, 0x11));
+}
+
+/* 'size' is a multiple of 16 and at least CRC_FOLD_BLOCK */
+UTILS_TARGET("pclmul,ssse3")
+static uint32_t updateClmul(const UTILS_CRC* crc, uint32_t value,
+                            const uint8_t* bytes, uint32_t size)
+{
+	const __m128i k512 = _mm_loadu_si128((const __m128i*)&crc->fold[0]);
+	const __m128i k384 = _mm_loadu_si128((const __m128i*)&crc->fold[2]);
+	const __m128i k256 = _mm_loadu_si128((const __m128i*)&crc->fold[4]);
+	const __m128i k128 = _mm_loadu_si128((const __m128i*)&crc->fold[6]);
+	uint32_t start = crc->reflected ? value : reverse32(value);
+	__m128i x0 = _mm_xor_si128(loadBlock(crc, bytes),
+	                           _mm_cvtsi32_si128((int32_t)start));
+	__m128i x1 = loadBlock(crc, bytes + 16);
+	__m128i x2 = loadBlock(crc, bytes + 32);
+	__m128i x3 = loadBlock(crc, bytes + 48);
+	bytes += CRC_FOLD_BLOCK;
+	size -= CRC_FOLD_BLOCK;
+	for(; size >= CRC_FOLD_BLOCK; size -= CRC_FOLD_BLOCK, bytes += CRC_FOLD_BLOCK)
+	{
+		x0 = _mm_xor_si128(fold(x0, k512), loadBlock(crc, bytes));
+		x1 = _mm_xor_si128(fold(x1, k512), loadBlock(crc, bytes + 16));
+		x2 = _mm_xor_si128(fold(x2, k512), loadBlock(crc, bytes + 32));
+		x3 = _mm_xor_si128(fold(x3, k512), loadBlock(crc, bytes + 48));
+	}
+	__m128i x = _mm_xor_si128(_mm_xor_si128(fold(x0, k384), fold(x1, k256)),
+	                          _mm_xor_si128(fold(x2, k128), x3));
+	for(; size >= 16; size -= 16, bytes += 16)
+	{
+		x = _mm_xor_si128(fold(x, k128), loadBlock(crc, bytes));
+	}
+	/* The 16 bytes left have the same CRC as the whole input */
+	uint8_t rest[16];
+	_mm_storeu_si128((__m128i*)rest, crc->reflected ? x : reverseBits(x));
+	return updateSlicing8(crc, 0, rest, sizeof(rest));
+}
+#endif
+#endif
+
+/**
+ * @brief    Initialize CRC engine of model
+ *
+ * UTILS_CRC_BITWISE needs no table, UTILS_CRC_NIBBLE needs
+ * UTILS_CRC_NIBBLE_TABLE_SIZE entries, UTILS_CRC_SLICING8 and
+ * UTILS_CRC_CLMUL need UTILS_CRC_SLICING8_TABLE_SIZE entries. The table is
+ * computed here and only read later, so copies of the initialized engine
+ * can compute CRCs of other frames at the same time. UTILS_CRC_CLMUL uses
+ * slicing-by-8 on CPUs without PCLMULQDQ. Engines which are not built in
+ * the profile of the library (see UTILS_PROFILE_TINY) are replaced with
+ * the fastest one which is, it needs the same or smaller table.
+ *
+ * @param[out]   crc:        engine to initialize
+ * @param[in]    model:      width, polynomial, init, xorOut and bit order,
+ *                           e.g. UTILS_CRC32_MODEL
+ * @param[in]    engine:     implementation of engine
+ * @param[out]   table:      table of engine, can be NULL for bitwise one
+ * @param[in]    entries:    number of entries in table
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to crc or model is NULL, or table
+ *                                 is NULL but the engine needs it
+ *     ERROR_CONVERSION_FAIL     - width is not 8, 16 or 32, engine is wrong
+ *                                 or table is too small
+ *     ERROR_SUCCESS             - engine is ready
+ */
+UTILS_ERROR UTILS_CrcInit(UTILS_CRC* crc, const UTILS_CRC_MODEL* model,
+                          UTILS_CRC_ENGINE engine, uint32_t* table,
+                          uint32_t entries)
+{
+	if(engine > CRC_ENGINE_MAX && engine <= UTILS_CRC_CLMUL)
+	{
+		engine = CRC_ENGINE_MAX;
+	}
+	if(crc == NULL || model == NULL ||
+	   (table == NULL && engine != UTILS_CRC_BITWISE))
+	{
+		return ERROR_NULL_POINTER;
+	}
+	uint32_t required;
+	switch(engine)
+	{
+	case UTILS_CRC_BITWISE:  required = 0;                             break;
+	case UTILS_CRC_NIBBLE:   required = UTILS_CRC_NIBBLE_TABLE_SIZE;   break;
+	case UTILS_CRC_SLICING8:
+	case UTILS_CRC_CLMUL:    required = UTILS_CRC_SLICING8_TABLE_SIZE; break;
+	default:                 return ERROR_CONVERSION_FAIL;
+	}
+	if((model->width != 8 && model->width != 16 && model->width != 32) ||
+	   entries < required)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	uint32_t shift = 32u - model->width;
+	uint32_t mask = 0xFFFFFFFFu >> shift;
+	crc->polynomial = (model->polynomial & mask) << shift;
+	crc->init = (model->init & mask) << shift;
+	crc->xorOut = model->xorOut & mask;
+	crc->width = model->width;
+	crc->reflected = model->reflected ? 1 : 0;
+	crc->engine = (uint8_t)engine;
+	crc->table = table;
+	if(crc->reflected)
+	{
+		crc->polynomial = reverse32(crc->polynomial);
+		crc->init = reverse32(crc->init);
+	}
+
+#if UTILS_CRC_IMPL != UTILS_IMPL_LOOP
+	if(engine == UTILS_CRC_NIBBLE)
+	{
+		for(uint32_t nibble = 0; nibble < 16; nibble++)
+		{
+			table[nibble] = shiftBits(crc, crc->reflected ? nibble : nibble << 28, 4);
+		}
+	}
+#endif
+#if UTILS_CRC_IMPL == UTILS_IMPL_TABLE
+	if(engine == UTILS_CRC_SLICING8 || engine == UTILS_CRC_CLMUL)
+	{
+		for(uint32_t byte = 0; byte < CRC_TABLE_ENTRIES; byte++)
+		{
+			table[byte] = shiftBits(crc, crc->reflected ? byte : byte << 24, 8);
+		}
+		for(uint32_t slice = 1; slice < 8; slice++)
+		{
+			for(uint32_t byte = 0; byte < CRC_TABLE_ENTRIES; byte++)
+			{
+				uint32_t previous = table[(slice - 1) * CRC_TABLE_ENTRIES + byte];
+				table[slice * CRC_TABLE_ENTRIES + byte] = crc->reflected ?
+				    (previous >> 8) ^ table[previous & 0xFF] :
+				    (previous << 8) ^ table[previous >> 24];
+			}
+		}
+	}
+
+	/* x^n mod P of the MSB first polynomial, reflected into the high half
+	 * of 64-bit lane: x^575, x^511, x^447, x^383, x^319, x^255, x^191, x^127 */
+	UTILS_CRC normal = *crc;
+	normal.reflected = 0;
+	normal.polynomial = crc->reflected ? reverse32(crc->polynomial) :
+	                                     crc->polynomial;
+	uint32_t power = shiftBits(&normal, 1, 127);
+	for(uint32_t constant = 8; constant > 0; constant--)
+	{
+		crc->fold[constant - 1] = (uint64_t)reverse32(power) << 32;
+		power = shiftBits(&normal, power, 64);
+	}
+#endif
+	crc->value = crc->init;
+	return ERROR_SUCCESS;
+}
+
+/**
+ * @brief    Start CRC of next frame
+ *
+ * @param[in,out] crc:       initialized engine
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to crc is NULL
+ *     ERROR_SUCCESS             - register is set to init value of model
+ */
+UTILS_ERROR UTILS_CrcReset(UTILS_CRC* crc)
+{
+	if(crc == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	crc->value = crc->init;
+	return ERROR_SUCCESS;
+}
+
+/**
+ * @brief    Add bytes of frame to CRC
+ *
+ * A frame can be given in parts of any size as it is received, the result
+ * is the same as for the whole frame at once.
+ *
+ * @param[in,out] crc:       initialized engine
+ * @param[in]    bytes:      next bytes of frame
+ * @param[in]    size:       number of bytes
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to crc or bytes is NULL
+ *     ERROR_SUCCESS             - bytes are added
+ */
+UTILS_ERROR UTILS_CrcUpdate(UTILS_CRC* crc, const uint8_t* bytes, uint32_t size)
+{
+	if(crc == NULL || bytes == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	uint32_t value = crc->value;
+	switch(crc->engine)
+	{
+#if UTILS_CRC_IMPL != UTILS_IMPL_LOOP
+	case UTILS_CRC_NIBBLE:
+		value = updateNibble(crc, value, bytes, size);
+		break;
+#endif
+#if UTILS_CRC_IMPL == UTILS_IMPL_TABLE
+	case UTILS_CRC_CLMUL:
+#if UTILS_X86
+		if(size >= CRC_FOLD_BLOCK && UTILS_CPU_HAS("pclmul") &&
+		   UTILS_CPU_HAS("ssse3"))
+		{
+			uint32_t folded = size & ~15u;
+			value = updateClmul(crc, value, bytes, folded);
+			bytes += folded;
+			size -= folded;
+		}
+#endif
+		/* fall through */
+	case UTILS_CRC_SLICING8:
+		value = updateSlicing8(crc, value, bytes, size);
+		break;
+#endif
+	default:
+		value = updateBitwise(crc, value, bytes, size);
+		break;
+	}
+	crc->value = value;
+	return ERROR_SUCCESS;
+}
+
+/**
+ * @brief    Get CRC of bytes added since init or reset
+ *
+ * The register is not changed, so more bytes can be added later.
+ *
+ * @param[in]    crc:        initialized engine
+ * @param[out]   value:      CRC of model width, reflected and xored with
+ *                           xorOut as defined by the model
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to crc or value is NULL
+ *     ERROR_SUCCESS             - CRC is returned
+ */
+UTILS_ERROR UTILS_CrcFinal(const UTILS_CRC* crc, uint32_t* value)
+{
+	if(crc == NULL || value == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	uint32_t result = crc->reflected ? crc->value :
+	                                   crc->value >> (32u - crc->width);
+	*value = result ^ crc->xorOut;
+	return ERROR_SUCCESS;
+}
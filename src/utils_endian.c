@@ -0,0 +1,447 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ * @copyrights Copyrights 2019 Stanislaw Pietrzak. All rights reserved.
+ * @file utils_endian.c
+ * @author Stanislaw Pietrzak
+ * @email integralzerox@gmail.com
+ * @date 16 October 2026
+ * @brief Byte order conversion of 16, 32 and 64-bit arrays
+ *
+ * Values in the byte order of the host are copied as they are. Otherwise
+ * bytes of every value are reversed: by SSSE3 or AVX2 byte shuffle on x86
+ * (selected at run time) and by the compiler byte swap builtin for the tail
+ * and on other platforms.
+ *
+ * @see https://github.com/Dev4Embedded/
+ */
+
+#include "stddef.h"
+#include "string.h"
+#include "utils.h"
+#include "utils_cpu.h"
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define UTILS_HOST_BYTE_ORDER   UTILS_BIG_ENDIAN
+#else
+#define UTILS_HOST_BYTE_ORDER   UTILS_LITTLE_ENDIAN
+#endif
+
+/* Byte indexes of pshufb which reverse every 2, 4 or 8 bytes of a lane */
+static const uint8_t swapShuffle16[16] = {1, 0, 3, 2, 5, 4, 7, 6,
+                                          9, 8, 11, 10, 13, 12, 15, 14};
+static const uint8_t swapShuffle32[16] = {3, 2, 1, 0, 7, 6, 5, 4,
+                                          11, 10, 9, 8, 15, 14, 13, 12};
+static const uint8_t swapShuffle64[16] = {7, 6, 5, 4, 3, 2, 1, 0,
+                                          15, 14, 13, 12, 11, 10, 9, 8};
+
+static uint16_t swap16(uint16_t value)
+{
+#if defined(__GNUC__)
+	return __builtin_bswap16(value);
+#else
+	return (uint16_t)((value >> 8) | (value << 8));
+#endif
+}
+
+static uint32_t swap32(uint32_t value)
+{
+#if defined(__GNUC__)
+	return __builtin_bswap32(value);
+#else
+	return ((uint32_t)swap16((uint16_t)value) << 16) |
+	       swap16((uint16_t)(value >> 16));
+#endif
+}
+
+static uint64_t swap64(uint64_t value)
+{
+#if defined(__GNUC__)
+	return __builtin_bswap64(value);
+#else
+	return ((uint64_t)swap32((uint32_t)value) << 32) |
+	       swap32((uint32_t)(value >> 32));
+#endif
+}
+
+/* Values are loaded and stored by memcpy, so buffers may be unaligned */
+static void swapBytesScalar(const uint8_t* source, uint8_t* destination,
+                            size_t size, uint8_t width)
+{
+	for(size_t byte = 0; byte < size; byte += width)
+	{
+		if(width == sizeof(uint16_t))
+		{
+			uint16_t value;
+			memcpy(&value, &source[byte], sizeof(value));
+			value = swap16(value);
+			memcpy(&destination[byte], &value, sizeof(value));
+		}
+		else if(width == sizeof(uint32_t))
+		{
+			uint32_t value;
+			memcpy(&value, &source[byte], sizeof(value));
+			value = swap32(value);
+			memcpy(&destination[byte], &value, sizeof(value));
+		}
+		else
+		{
+			uint64_t value;
+			memcpy(&value, &source[byte], sizeof(value));
+			value = swap64(value);
+			memcpy(&destination[byte], &value, sizeof(value));
+		}
+	}
+}
+
+#if UTILS_X86
+/* Every block is loaded before it is stored, so 'source' can be equal
+ * to 'destination'. Return number of swapped bytes. */
+UTILS_TARGET("ssse3")
+static size_t swapBytesSsse3(const uint8_t* source, uint8_t* destination,
+                             size_t size, const uint8_t* shuffle)
+{
+	const __m128i mask = _mm_loadu_si128((const __m128i*)shuffle);
+	size_t byte = 0;
+	for(; byte + 16 <= size; byte += 16)
+	{
+		__m128i block = _mm_loadu_si128((const __m128i*)&source[byte]);
+		_mm_storeu_si128((__m128i*)&destination[byte],
+		                 _mm_shuffle_epi8(block, mask));
+	}
+	return byte;
+}
+
+UTILS_TARGET("avx2")
+static size_t swapBytesAvx2(const uint8_t* source, uint8_t* destination,
+                            size_t size, const uint8_t* shuffle)
+{
+	const __m256i mask = _mm256_broadcastsi128_si256(
+	                         _mm_loadu_si128((const __m128i*)shuffle));
+	size_t byte = 0;
+	for(; byte + 64 <= size; byte += 64)
+	{
+		__m256i first = _mm256_loadu_si256((const __m256i*)&source[byte]);
+		__m256i second = _mm256_loadu_si256((const __m256i*)&source[byte + 32]);
+		_mm256_storeu_si256((__m256i*)&destination[byte],
+		                    _mm256_shuffle_epi8(first, mask));
+		_mm256_storeu_si256((__m256i*)&destination[byte + 32],
+		                    _mm256_shuffle_epi8(second, mask));
+	}
+	for(; byte + 32 <= size; byte += 32)
+	{
+		__m256i block = _mm256_loadu_si256((const __m256i*)&source[byte]);
+		_mm256_storeu_si256((__m256i*)&destination[byte],
+		                    _mm256_shuffle_epi8(block, mask));
+	}
+	return byte;
+}
+#endif
+
+static void swapBytes(const uint8_t* source, uint8_t* destination,
+                      size_t size, uint8_t width)
+{
+	size_t done = 0;
+#if UTILS_X86
+	const uint8_t* shuffle = (width == sizeof(uint16_t)) ? swapShuffle16 :
+	                         (width == sizeof(uint32_t)) ? swapShuffle32 :
+	                                                       swapShuffle64;
+	if(UTILS_CPU_HAS("avx2"))
+	{
+		done = swapBytesAvx2(source, destination, size, shuffle);
+	}
+	if(UTILS_CPU_HAS("ssse3"))
+	{
+		done += swapBytesSsse3(&source[done], &destination[done],
+		                       size - done, shuffle);
+	}
+#else
+	(void)swapShuffle16;
+	(void)swapShuffle32;
+	(void)swapShuffle64;
+#endif
+	swapBytesScalar(&source[done], &destination[done], size - done, width);
+}
+
+/* Copy 'size' bytes of values with 'width' from host order to 'order' */
+static void convertByteOrder(const void* source, void* destination,
+                             size_t size, uint8_t width,
+                             UTILS_BYTE_ORDER order)
+{
+	if(order != UTILS_HOST_BYTE_ORDER)
+	{
+		swapBytes(source, destination, size, width);
+	}
+	else if(source != destination)
+	{
+		memmove(destination, source, size);
+	}
+}
+
+static UTILS_ERROR valuesToBytes(const void* values, uint32_t count,
+                                 uint8_t width, UTILS_BYTE_ORDER order,
+                                 uint8_t* bytes, uint32_t size)
+{
+	if(values == NULL || bytes == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	if(order > UTILS_BIG_ENDIAN || count > size / width)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	convertByteOrder(values, bytes, (size_t)count * width, width, order);
+	return ERROR_SUCCESS;
+}
+
+static UTILS_ERROR bytesToValues(const uint8_t* bytes, uint32_t size,
+                                 uint8_t width, UTILS_BYTE_ORDER order,
+                                 void* values, uint32_t count)
+{
+	if(bytes == NULL || values == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	if(order > UTILS_BIG_ENDIAN || size % width || size / width > count)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	convertByteOrder(bytes, values, size, width, order);
+	return ERROR_SUCCESS;
+}
+
+/**
+ * @brief    Convert array of 16-bit values to bytes in selected byte order
+ *
+ * Every value takes two bytes, so 'size' of 'bytes' must be at least two
+ * times 'count'. The 'bytes' buffer can be the same memory as 'values'
+ * (in-place conversion), but the buffers must not partially overlap.
+ *
+ * @param[in]    values:    array of values
+ * @param[in]    count:     number of values
+ * @param[in]    order:     byte order of the result
+ * @param[out]   bytes:     conversion result
+ * @param[in]    size:      size of bytes buffer
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to values or bytes is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible.
+ *                                 bytes buffer is too small or order is wrong
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_Uint16ArrayToBytes(const uint16_t* values, uint32_t count,
+                                     UTILS_BYTE_ORDER order,
+                                     uint8_t* bytes, uint32_t size)
+{
+	return valuesToBytes(values, count, sizeof(uint16_t), order, bytes, size);
+}
+
+/**
+ * @brief    Convert array of 32-bit values to bytes in selected byte order
+ *
+ * Every value takes four bytes, so 'size' of 'bytes' must be at least four
+ * times 'count'. The 'bytes' buffer can be the same memory as 'values'
+ * (in-place conversion), but the buffers must not partially overlap.
+ *
+ * @param[in]    values:    array of values
+ * @param[in]    count:     number of values
+ * @param[in]    order:     byte order of the result
+ * @param[out]   bytes:     conversion result
+ * @param[in]    size:      size of bytes buffer
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to values or bytes is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible.
+ *                                 bytes buffer is too small or order is wrong
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_Uint32ArrayToBytes(const uint32_t* values, uint32_t count,
+                                     UTILS_BYTE_ORDER order,
+                                     uint8_t* bytes, uint32_t size)
+{
+	return valuesToBytes(values, count, sizeof(uint32_t), order, bytes, size);
+}
+
+/**
+ * @brief    Convert array of 64-bit values to bytes in selected byte order
+ *
+ * Every value takes eight bytes, so 'size' of 'bytes' must be at least eight
+ * times 'count'. The 'bytes' buffer can be the same memory as 'values'
+ * (in-place conversion), but the buffers must not partially overlap.
+ *
+ * @param[in]    values:    array of values
+ * @param[in]    count:     number of values
+ * @param[in]    order:     byte order of the result
+ * @param[out]   bytes:     conversion result
+ * @param[in]    size:      size of bytes buffer
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to values or bytes is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible.
+ *                                 bytes buffer is too small or order is wrong
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_Uint64ArrayToBytes(const uint64_t* values, uint32_t count,
+                                     UTILS_BYTE_ORDER order,
+                                     uint8_t* bytes, uint32_t size)
+{
+	return valuesToBytes(values, count, sizeof(uint64_t), order, bytes, size);
+}
+
+/**
+ * @brief    Convert bytes in selected byte order to array of 16-bit values
+ *
+ * All 'size' bytes are converted, so 'size' must be even and 'count' of
+ * 'values' must be at least half of 'size'. The 'values' array can be the
+ * same memory as 'bytes', but the buffers must not partially overlap.
+ *
+ * @param[in]    bytes:     buffer of values in 'order'
+ * @param[in]    size:      number of bytes to convert
+ * @param[in]    order:     byte order of the bytes buffer
+ * @param[out]   values:    conversion result
+ * @param[in]    count:     number of values in values array
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to bytes or values is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible. Size is not
+ *                                 a multiple of value, values array is too
+ *                                 small or order is wrong
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_BytesToUint16Array(const uint8_t* bytes, uint32_t size,
+                                     UTILS_BYTE_ORDER order,
+                                     uint16_t* values, uint32_t count)
+{
+	return bytesToValues(bytes, size, sizeof(uint16_t), order, values, count);
+}
+
+/**
+ * @brief    Convert bytes in selected byte order to array of 32-bit values
+ *
+ * All 'size' bytes are converted, so 'size' must be a multiple of four and
+ * 'count' of 'values' must be at least quarter of 'size'. The 'values' array
+ * can be the same memory as 'bytes', but the buffers must not partially
+ * overlap.
+ *
+ * @param[in]    bytes:     buffer of values in 'order'
+ * @param[in]    size:      number of bytes to convert
+ * @param[in]    order:     byte order of the bytes buffer
+ * @param[out]   values:    conversion result
+ * @param[in]    count:     number of values in values array
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to bytes or values is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible. Size is not
+ *                                 a multiple of value, values array is too
+ *                                 small or order is wrong
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_BytesToUint32Array(const uint8_t* bytes, uint32_t size,
+                                     UTILS_BYTE_ORDER order,
+                                     uint32_t* values, uint32_t count)
+{
+	return bytesToValues(bytes, size, sizeof(uint32_t), order, values, count);
+}
+
+/**
+ * @brief    Convert bytes in selected byte order to array of 64-bit values
+ *
+ * All 'size' bytes are converted, so 'size' must be a multiple of eight and
+ * 'count' of 'values' must be at least one eighth of 'size'. The 'values'
+ * array can be the same memory as 'bytes', but the buffers must not
+ * partially overlap.
+ *
+ * @param[in]    bytes:     buffer of values in 'order'
+ * @param[in]    size:      number of bytes to convert
+ * @param[in]    order:     byte order of the bytes buffer
+ * @param[out]   values:    conversion result
+ * @param[in]    count:     number of values in values array
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to bytes or values is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible. Size is not
+ *                                 a multiple of value, values array is too
+ *                                 small or order is wrong
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_BytesToUint64Array(const uint8_t* bytes, uint32_t size,
+                                     UTILS_BYTE_ORDER order,
+                                     uint64_t* values, uint32_t count)
+{
+	return bytesToValues(bytes, size, sizeof(uint64_t), order, values, count);
+}
+
+/**
+ * @brief    Reverse byte order of every value in 16-bit array (in place)
+ *
+ * @param[in,out]    values:    array of values
+ * @param[in]        count:     number of values
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to values is NULL
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_SwapBytes16(uint16_t* values, uint32_t count)
+{
+	if(values == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	swapBytes((const uint8_t*)values, (uint8_t*)values,
+	          (size_t)count * sizeof(uint16_t), sizeof(uint16_t));
+	return ERROR_SUCCESS;
+}
+
+/**
+ * @brief    Reverse byte order of every value in 32-bit array (in place)
+ *
+ * @param[in,out]    values:    array of values
+ * @param[in]        count:     number of values
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to values is NULL
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_SwapBytes32(uint32_t* values, uint32_t count)
+{
+	if(values == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	swapBytes((const uint8_t*)values, (uint8_t*)values,
+	          (size_t)count * sizeof(uint32_t), sizeof(uint32_t));
+	return ERROR_SUCCESS;
+}
+
+/**
+ * @brief    Reverse byte order of every value in 64-bit array (in place)
+ *
+ * @param[in,out]    values:    array of values
+ * @param[in]        count:     number of values
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to values is NULL
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_SwapBytes64(uint64_t* values, uint32_t count)
+{
+	if(values == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	swapBytes((const uint8_t*)values, (uint8_t*)values,
+	          (size_t)count * sizeof(uint64_t), sizeof(uint64_t));
+	return ERROR_SUCCESS;
+}
@@ -0,0 +1,327 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ * @copyrights Copyrights 2019 Stanislaw Pietrzak. All rights reserved.
+ * @file utils_fixed.c
+ * @author Stanislaw Pietrzak
+ * @email integralzerox@gmail.com
+ * @date 16 October 2026
+ * @brief Decimal conversions of fixed-point (Q format) values
+ *
+ * Only integer arithmetic is used, so the conversions are cheap on cores
+ * without FPU. Both directions are exact and round to nearest with ties to
+ * even: the formatter generates fraction digits by multiplication by 10,
+ * the parser doubles the decimal fraction (in base 10^9 limbs) once per
+ * fraction bit, so neither of them needs a division.
+ *
+ * @see https://github.com/Dev4Embedded/
+ */
+
+#include "stddef.h"
+#include "utils.h"
+#include "utils_private.h"
+
+#define UTILS_FIXED_IS_DIGIT(c)     ((c) >= '0' && (c) <= '9')
+#define UTILS_FIXED_WIDTH(format)   ((uint32_t)(format) >> 8)
+#define UTILS_FIXED_BITS(format)    ((uint32_t)(format) & 0xFF)
+
+/* Fraction digits kept by the parser, the rest is only checked for non 0.
+ * Any value in the middle of two Q31 steps has 32 fraction digits */
+#define UTILS_FIXED_LIMB            1000000000u
+#define UTILS_FIXED_LIMB_DIGITS     9
+#define UTILS_FIXED_LIMBS           4
+
+/* Scale of the last limb with 'n' digits to 9 digits */
+static const uint32_t limbScales[UTILS_FIXED_LIMB_DIGITS] =
+{
+	1, 100000000, 10000000, 1000000, 100000, 10000, 1000, 100, 10
+};
+
+static uint8_t isFormatValid(uint16_t format)
+{
+	uint32_t width = UTILS_FIXED_WIDTH(format);
+	return width >= 2 && width <= 32 && UTILS_FIXED_BITS(format) < width;
+}
+
+/* Round the written fraction digits (or integer part) up to nearest,
+ * ties to even, based on the rest of the fraction 'rest' of 'bits' */
+static void roundDigits(uint64_t rest, uint32_t bits, char* digits,
+                        uint8_t decimals, uint32_t* integer)
+{
+	if(bits == 0)
+	{
+		return;
+	}
+	uint64_t half = (uint64_t)1 << (bits - 1);
+	uint32_t odd = decimals ? (digits[decimals - 1] & 1) : (*integer & 1);
+	if(rest < half || (rest == half && !odd))
+	{
+		return;
+	}
+	for(uint8_t digit = decimals; digit > 0; digit--)
+	{
+		if(digits[digit - 1] != '9')
+		{
+			digits[digit - 1]++;
+			return;
+		}
+		digits[digit - 1] = '0';
+	}
+	(*integer)++;
+}
+
+/* Fixed-point string without NULL, fails only for wrong format, decimals
+ * or value. 'ascii' must have UTILS_FIXED_STRING_MAX_SIZE - 1 characters */
+UTILS_ERROR utilsFixed2Ascii(int32_t value, uint16_t format, uint8_t decimals,
+                             char* ascii, uint32_t* written)
+{
+	char fraction[UTILS_FIXED_MAX_DECIMALS];
+	if(!isFormatValid(format) || decimals > UTILS_FIXED_MAX_DECIMALS)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	uint32_t width = UTILS_FIXED_WIDTH(format);
+	uint32_t bits = UTILS_FIXED_BITS(format);
+	if(width < 32 && (value < -((int32_t)1 << (width - 1)) ||
+	                  value >= ((int32_t)1 << (width - 1))))
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+
+	uint32_t magnitude = (value < 0) ? 0u - (uint32_t)value : (uint32_t)value;
+	uint32_t integer = (uint32_t)((uint64_t)magnitude >> bits);
+	uint64_t mask = ((uint64_t)1 << bits) - 1;
+	uint64_t rest = magnitude & mask;
+	for(uint8_t digit = 0; digit < decimals; digit++)
+	{
+		rest *= 10;
+		fraction[digit] = (char)('0' + (rest >> bits));
+		rest &= mask;
+	}
+	roundDigits(rest, bits, fraction, decimals, &integer);
+
+	uint32_t sign = (value < 0) ? 1 : 0;
+	uint32_t digits = utilsGetNumberOfDecimalDigits(integer);
+	if(sign)
+	{
+		ascii[0] = '-';
+	}
+	utilsWriteDecimalDigits(integer, &ascii[sign + digits]);
+	if(decimals)
+	{
+		ascii[sign + digits] = '.';
+		for(uint8_t digit = 0; digit < decimals; digit++)
+		{
+			ascii[sign + digits + 1 + digit] = fraction[digit];
+		}
+	}
+	*written = sign + digits + (decimals ? decimals + 1u : 0);
+	return ERROR_SUCCESS;
+}
+
+/**
+ * @brief    Convert fixed-point value to decimal ASCII string
+ *
+ * The string has an optional '-' sign, the integer part and, when
+ * 'decimals' is not 0, decimal point and exactly 'decimals' fraction
+ * digits, e.g. Q15 value 0x6000 with 3 decimals is "0.750". The value is
+ * rounded to nearest with ties to even, like printf("%.*f") of the exact
+ * value. The terminating NULL is written when there is space left.
+ *
+ * @param[in]    value:     fixed-point value, sign extended to 32 bits
+ * @param[in]    format:    UTILS_Q15, UTILS_Q31, UTILS_Q16_16 or other
+ *                          UTILS_FIXED_FORMAT(width, fraction)
+ * @param[in]    decimals:  number of fraction digits, up to
+ *                          UTILS_FIXED_MAX_DECIMALS
+ * @param[out]   ascii:     pointer to ascii array
+ * @param[in]    length:    length of string (before conversion)
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to ascii is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible. length of
+ *                                 ascii is too short, format or decimals
+ *                                 is wrong or value is out of format range
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_Fixed2AsciiString(int32_t value, uint16_t format,
+                                    uint8_t decimals, char* ascii,
+                                    uint32_t length)
+{
+	char buffer[UTILS_FIXED_STRING_MAX_SIZE];
+	uint32_t total;
+	if(ascii == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	if(utilsFixed2Ascii(value, format, decimals, buffer, &total) != ERROR_SUCCESS ||
+	   total > length)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	for(uint32_t copy = 0; copy < total; copy++)
+	{
+		ascii[copy] = buffer[copy];
+	}
+	if(total < length)
+	{
+		ascii[total] = 0x00;
+	}
+	return ERROR_SUCCESS;
+}
+
+/**
+ * @brief    Convert decimal ASCII string to fixed-point value
+ *
+ * The string can start with '+' or '-' sign, then has decimal digits with
+ * an optional decimal point, like "-0.125". Conversion stops at the first
+ * character which does not belong to the number, or after 'length'
+ * characters. Any number of fraction digits is accepted and the result is
+ * rounded to nearest with ties to even.
+ *
+ * @param[in]    string:    decimal ASCII string
+ * @param[in]    length:    maximum number of characters to read
+ * @param[in]    format:    UTILS_Q15, UTILS_Q31, UTILS_Q16_16 or other
+ *                          UTILS_FIXED_FORMAT(width, fraction)
+ * @param[out]   value:     conversion result, sign extended to 32 bits
+ * @param[out]   consumed:  number of characters of the number
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to string, value or consumed
+ *                                 is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible. String does
+ *                                 not start with a number, format is wrong
+ *                                 or the number is out of format range
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_AsciiString2Fixed(const char* string, uint32_t length,
+                                    uint16_t format, int32_t* value,
+                                    uint32_t* consumed)
+{
+	uint32_t limbs[UTILS_FIXED_LIMBS] = {0};
+	if(string == NULL || value == NULL || consumed == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	*consumed = 0;
+	if(!isFormatValid(format))
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	uint32_t width = UTILS_FIXED_WIDTH(format);
+	uint32_t bits = UTILS_FIXED_BITS(format);
+	uint32_t pos = 0;
+	uint8_t negative = 0;
+	if(pos < length && (string[pos] == '-' || string[pos] == '+'))
+	{
+		negative = (string[pos] == '-');
+		pos++;
+	}
+
+	/* Integer part saturates above any 32-bit format */
+	uint32_t integer = 0;
+	uint8_t anyDigit = 0;
+	for(; pos < length && UTILS_FIXED_IS_DIGIT(string[pos]); pos++)
+	{
+		anyDigit = 1;
+		if(integer <= UINT32_MAX / 10 - 1)
+		{
+			integer = integer * 10 + (uint32_t)(string[pos] - '0');
+		}
+		else
+		{
+			integer = UINT32_MAX;
+		}
+	}
+	uint32_t used = 0;
+	uint32_t chunk = 0;
+	uint32_t chunkDigits = 0;
+	uint8_t sticky = 0;
+	if(pos < length && string[pos] == '.')
+	{
+		for(pos++; pos < length && UTILS_FIXED_IS_DIGIT(string[pos]); pos++)
+		{
+			anyDigit = 1;
+			if(used == UTILS_FIXED_LIMBS)
+			{
+				sticky |= (string[pos] != '0');
+				continue;
+			}
+			chunk = chunk * 10 + (uint32_t)(string[pos] - '0');
+			if(++chunkDigits == UTILS_FIXED_LIMB_DIGITS)
+			{
+				limbs[used++] = chunk;
+				chunk = 0;
+				chunkDigits = 0;
+			}
+		}
+	}
+	if(!anyDigit)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	/* The last limb is a full group of 9 digits too */
+	if(chunkDigits)
+	{
+		limbs[used++] = chunk * limbScales[chunkDigits];
+	}
+
+	/* Every doubling of the fraction gives the next bit as carry */
+	uint32_t fraction = 0;
+	if(used == 1)
+	{
+		/* Up to 9 digits, the common case, stay in a register */
+		uint32_t rest = limbs[0];
+		for(uint32_t bit = 0; bit < bits; bit++)
+		{
+			rest *= 2;
+			uint32_t carry = (rest >= UTILS_FIXED_LIMB);
+			rest -= carry * UTILS_FIXED_LIMB;
+			fraction = (fraction << 1) | carry;
+		}
+		limbs[0] = rest;
+	}
+	for(uint32_t bit = 0; used > 1 && bit < bits; bit++)
+	{
+		uint32_t carry = 0;
+		for(uint32_t limb = used; limb > 0; limb--)
+		{
+			uint32_t doubled = limbs[limb - 1] * 2 + carry;
+			carry = (doubled >= UTILS_FIXED_LIMB);
+			limbs[limb - 1] = doubled - (carry ? UTILS_FIXED_LIMB : 0);
+		}
+		fraction = (fraction << 1) | carry;
+	}
+	/* Rest of the fraction against one half, ties to even */
+	uint8_t above = sticky;
+	for(uint32_t limb = 1; limb < UTILS_FIXED_LIMBS; limb++)
+	{
+		above |= (limbs[limb] != 0);
+	}
+	uint64_t magnitude = ((uint64_t)integer << bits) | fraction;
+	if(limbs[0] > UTILS_FIXED_LIMB / 2 ||
+	   (limbs[0] == UTILS_FIXED_LIMB / 2 && (above || (magnitude & 1))))
+	{
+		magnitude++;
+	}
+
+	uint64_t limit = ((uint64_t)1 << (width - 1)) - (negative ? 0 : 1);
+	if(magnitude > limit)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	*value = negative ? (int32_t)(0u - (uint32_t)magnitude) : (int32_t)magnitude;
+	*consumed = pos;
+	return ERROR_SUCCESS;
+}
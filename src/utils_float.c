@@ -0,0 +1,1063 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ * @copyrights Copyrights 2019 Stanislaw Pietrzak. All rights reserved.
+ * @file utils_float.c
+ * @author Stanislaw Pietrzak
+ * @email integralzerox@gmail.com
+ * @date 16 October 2026
+ * @brief Conversions between floating point and decimal ASCII string
+ *
+ * The decimal digits are computed with the Ryu algorithm (Ulf Adams, 2018)
+ * using only integer arithmetic. The result is the shortest string of digits
+ * that reads back to the same float, and the closest one if there are more.
+ *
+ * Parsing is correctly rounded. Up to 19 significant digits are handled with
+ * the Eisel-Lemire algorithm (Daniel Lemire, 2021), which multiplies them by
+ * a 128-bit power of five. Longer inputs close to a halfway point between
+ * two floats are finished on a fixed-size decimal buffer on the stack.
+ *
+ * @see https://github.com/Dev4Embedded/
+ */
+
+#include "stddef.h"
+#include "utils.h"
+#include "utils_private.h"
+
+#define UTILS_FLOAT_POW5_INV_BITCOUNT   59
+#define UTILS_FLOAT_POW5_BITCOUNT       61
+#define UTILS_FLOAT_SMALLEST_POWER10    (-65)
+#define UTILS_FLOAT_LARGEST_POWER10     38
+#define UTILS_FLOAT_FAST_DIGITS         19
+#define UTILS_FLOAT_EXPONENT_LIMIT      100000
+#define UTILS_DECIMAL_MAX_DIGITS        128
+#define UTILS_DECIMAL_MAX_SHIFT         27
+#define UTILS_IS_DIGIT(c)               ((c) >= '0' && (c) <= '9')
+#define UTILS_TO_LOWER(c)               ((c) | 0x20)
+
+/* Decimal number 0.d[0]d[1]..d[count-1] * 10^point used by the slow path */
+typedef struct
+{
+	uint8_t digits[UTILS_DECIMAL_MAX_DIGITS];
+	int32_t count;
+	int32_t point;
+	uint8_t truncated;
+}DecimalNumber;
+
+/* floor(2^(pow5bits(q) - 1 + 59) / 5^q) + 1 */
+static const uint64_t floatPow5InvSplit[31] =
+{
+	0x0800000000000001ull, 0x0666666666666667ull, 0x051EB851EB851EB9ull,
+	0x04189374BC6A7EFAull, 0x068DB8BAC710CB2Aull, 0x053E2D6238DA3C22ull,
+	0x0431BDE82D7B634Eull, 0x06B5FCA6AF2BD216ull, 0x055E63B88C230E78ull,
+	0x044B82FA09B5A52Dull, 0x06DF37F675EF6EAEull, 0x057F5FF85E592558ull,
+	0x0465E6604B7A8447ull, 0x0709709A125DA071ull, 0x05A126E1A84AE6C1ull,
+	0x0480EBE7B9D58567ull, 0x0734ACA5F6226F0Bull, 0x05C3BD5191B525A3ull,
+	0x049C97747490EAE9ull, 0x0760F253EDB4AB0Eull, 0x05E72843249088D8ull,
+	0x04B8ED0283A6D3E0ull, 0x078E480405D7B966ull, 0x060B6CD004AC9452ull,
+	0x04D5F0A66A23A9DBull, 0x07BCB43D769F762Bull, 0x063090312BB2C4EFull,
+	0x04F3A68DBC8F03F3ull, 0x07EC3DAF94180651ull, 0x065697BFA9ACD1DAull,
+	0x051212FFBAF0A7E2ull,
+};
+
+/* floor(5^i / 2^(pow5bits(i) - 61)) */
+static const uint64_t floatPow5Split[48] =
+{
+	0x1000000000000000ull, 0x1400000000000000ull, 0x1900000000000000ull,
+	0x1F40000000000000ull, 0x1388000000000000ull, 0x186A000000000000ull,
+	0x1E84800000000000ull, 0x1312D00000000000ull, 0x17D7840000000000ull,
+	0x1DCD650000000000ull, 0x12A05F2000000000ull, 0x174876E800000000ull,
+	0x1D1A94A200000000ull, 0x12309CE540000000ull, 0x16BCC41E90000000ull,
+	0x1C6BF52634000000ull, 0x11C37937E0800000ull, 0x16345785D8A00000ull,
+	0x1BC16D674EC80000ull, 0x1158E460913D0000ull, 0x15AF1D78B58C4000ull,
+	0x1B1AE4D6E2EF5000ull, 0x10F0CF064DD59200ull, 0x152D02C7E14AF680ull,
+	0x1A784379D99DB420ull, 0x108B2A2C28029094ull, 0x14ADF4B7320334B9ull,
+	0x19D971E4FE8401E7ull, 0x1027E72F1F128130ull, 0x1431E0FAE6D7217Cull,
+	0x193E5939A08CE9DBull, 0x1F8DEF8808B02452ull, 0x13B8B5B5056E16B3ull,
+	0x18A6E32246C99C60ull, 0x1ED09BEAD87C0378ull, 0x13426172C74D822Bull,
+	0x1812F9CF7920E2B6ull, 0x1E17B84357691B64ull, 0x12CED32A16A1B11Eull,
+	0x178287F49C4A1D66ull, 0x1D6329F1C35CA4BFull, 0x125DFA371A19E6F7ull,
+	0x16F578C4E0A060B5ull, 0x1CB2D6F618C878E3ull, 0x11EFC659CF7D4B8Dull,
+	0x166BB7F0435C9E71ull, 0x1C06A5EC5433C60Dull, 0x118427B3B4A05BC8ull,
+
+};
+
+/* 5^q for q in <-65..38> normalized and truncated to 128 bits (high, low) */
+static const uint64_t pow5Table128[2 * (UTILS_FLOAT_LARGEST_POWER10 -
+                                        UTILS_FLOAT_SMALLEST_POWER10 + 1)] =
+{
+	0x86CCBB52EA94BAEAull, 0x98E947129FC2B4E9ull, /* 5^-65 */
+	0xA87FEA27A539E9A5ull, 0x3F2398D747B36224ull, /* 5^-64 */
+	0xD29FE4B18E88640Eull, 0x8EEC7F0D19A03AADull, /* 5^-63 */
+	0x83A3EEEEF9153E89ull, 0x1953CF68300424ACull, /* 5^-62 */
+	0xA48CEAAAB75A8E2Bull, 0x5FA8C3423C052DD7ull, /* 5^-61 */
+	0xCDB02555653131B6ull, 0x3792F412CB06794Dull, /* 5^-60 */
+	0x808E17555F3EBF11ull, 0xE2BBD88BBEE40BD0ull, /* 5^-59 */
+	0xA0B19D2AB70E6ED6ull, 0x5B6ACEAEAE9D0EC4ull, /* 5^-58 */
+	0xC8DE047564D20A8Bull, 0xF245825A5A445275ull, /* 5^-57 */
+	0xFB158592BE068D2Eull, 0xEED6E2F0F0D56712ull, /* 5^-56 */
+	0x9CED737BB6C4183Dull, 0x55464DD69685606Bull, /* 5^-55 */
+	0xC428D05AA4751E4Cull, 0xAA97E14C3C26B886ull, /* 5^-54 */
+	0xF53304714D9265DFull, 0xD53DD99F4B3066A8ull, /* 5^-53 */
+	0x993FE2C6D07B7FABull, 0xE546A8038EFE4029ull, /* 5^-52 */
+	0xBF8FDB78849A5F96ull, 0xDE98520472BDD033ull, /* 5^-51 */
+	0xEF73D256A5C0F77Cull, 0x963E66858F6D4440ull, /* 5^-50 */
+	0x95A8637627989AADull, 0xDDE7001379A44AA8ull, /* 5^-49 */
+	0xBB127C53B17EC159ull, 0x5560C018580D5D52ull, /* 5^-48 */
+	0xE9D71B689DDE71AFull, 0xAAB8F01E6E10B4A6ull, /* 5^-47 */
+	0x9226712162AB070Dull, 0xCAB3961304CA70E8ull, /* 5^-46 */
+	0xB6B00D69BB55C8D1ull, 0x3D607B97C5FD0D22ull, /* 5^-45 */
+	0xE45C10C42A2B3B05ull, 0x8CB89A7DB77C506Aull, /* 5^-44 */
+	0x8EB98A7A9A5B04E3ull, 0x77F3608E92ADB242ull, /* 5^-43 */
+	0xB267ED1940F1C61Cull, 0x55F038B237591ED3ull, /* 5^-42 */
+	0xDF01E85F912E37A3ull, 0x6B6C46DEC52F6688ull, /* 5^-41 */
+	0x8B61313BBABCE2C6ull, 0x2323AC4B3B3DA015ull, /* 5^-40 */
+	0xAE397D8AA96C1B77ull, 0xABEC975E0A0D081Aull, /* 5^-39 */
+	0xD9C7DCED53C72255ull, 0x96E7BD358C904A21ull, /* 5^-38 */
+	0x881CEA14545C7575ull, 0x7E50D64177DA2E54ull, /* 5^-37 */
+	0xAA242499697392D2ull, 0xDDE50BD1D5D0B9E9ull, /* 5^-36 */
+	0xD4AD2DBFC3D07787ull, 0x955E4EC64B44E864ull, /* 5^-35 */
+	0x84EC3C97DA624AB4ull, 0xBD5AF13BEF0B113Eull, /* 5^-34 */
+	0xA6274BBDD0FADD61ull, 0xECB1AD8AEACDD58Eull, /* 5^-33 */
+	0xCFB11EAD453994BAull, 0x67DE18EDA5814AF2ull, /* 5^-32 */
+	0x81CEB32C4B43FCF4ull, 0x80EACF948770CED7ull, /* 5^-31 */
+	0xA2425FF75E14FC31ull, 0xA1258379A94D028Dull, /* 5^-30 */
+	0xCAD2F7F5359A3B3Eull, 0x096EE45813A04330ull, /* 5^-29 */
+	0xFD87B5F28300CA0Dull, 0x8BCA9D6E188853FCull, /* 5^-28 */
+	0x9E74D1B791E07E48ull, 0x775EA264CF55347Eull, /* 5^-27 */
+	0xC612062576589DDAull, 0x95364AFE032A819Eull, /* 5^-26 */
+	0xF79687AED3EEC551ull, 0x3A83DDBD83F52205ull, /* 5^-25 */
+	0x9ABE14CD44753B52ull, 0xC4926A9672793543ull, /* 5^-24 */
+	0xC16D9A0095928A27ull, 0x75B7053C0F178294ull, /* 5^-23 */
+	0xF1C90080BAF72CB1ull, 0x5324C68B12DD6339ull, /* 5^-22 */
+	0x971DA05074DA7BEEull, 0xD3F6FC16EBCA5E04ull, /* 5^-21 */
+	0xBCE5086492111AEAull, 0x88F4BB1CA6BCF585ull, /* 5^-20 */
+	0xEC1E4A7DB69561A5ull, 0x2B31E9E3D06C32E6ull, /* 5^-19 */
+	0x9392EE8E921D5D07ull, 0x3AFF322E62439FD0ull, /* 5^-18 */
+	0xB877AA3236A4B449ull, 0x09BEFEB9FAD487C3ull, /* 5^-17 */
+	0xE69594BEC44DE15Bull, 0x4C2EBE687989A9B4ull, /* 5^-16 */
+	0x901D7CF73AB0ACD9ull, 0x0F9D37014BF60A11ull, /* 5^-15 */
+	0xB424DC35095CD80Full, 0x538484C19EF38C95ull, /* 5^-14 */
+	0xE12E13424BB40E13ull, 0x2865A5F206B06FBAull, /* 5^-13 */
+	0x8CBCCC096F5088CBull, 0xF93F87B7442E45D4ull, /* 5^-12 */
+	0xAFEBFF0BCB24AAFEull, 0xF78F69A51539D749ull, /* 5^-11 */
+	0xDBE6FECEBDEDD5BEull, 0xB573440E5A884D1Cull, /* 5^-10 */
+	0x89705F4136B4A597ull, 0x31680A88F8953031ull, /* 5^-9 */
+	0xABCC77118461CEFCull, 0xFDC20D2B36BA7C3Eull, /* 5^-8 */
+	0xD6BF94D5E57A42BCull, 0x3D32907604691B4Dull, /* 5^-7 */
+	0x8637BD05AF6C69B5ull, 0xA63F9A49C2C1B110ull, /* 5^-6 */
+	0xA7C5AC471B478423ull, 0x0FCF80DC33721D54ull, /* 5^-5 */
+	0xD1B71758E219652Bull, 0xD3C36113404EA4A9ull, /* 5^-4 */
+	0x83126E978D4FDF3Bull, 0x645A1CAC083126EAull, /* 5^-3 */
+	0xA3D70A3D70A3D70Aull, 0x3D70A3D70A3D70A4ull, /* 5^-2 */
+	0xCCCCCCCCCCCCCCCCull, 0xCCCCCCCCCCCCCCCDull, /* 5^-1 */
+	0x8000000000000000ull, 0x0000000000000000ull, /* 5^0 */
+	0xA000000000000000ull, 0x0000000000000000ull, /* 5^1 */
+	0xC800000000000000ull, 0x0000000000000000ull, /* 5^2 */
+	0xFA00000000000000ull, 0x0000000000000000ull, /* 5^3 */
+	0x9C40000000000000ull, 0x0000000000000000ull, /* 5^4 */
+	0xC350000000000000ull, 0x0000000000000000ull, /* 5^5 */
+	0xF424000000000000ull, 0x0000000000000000ull, /* 5^6 */
+	0x9896800000000000ull, 0x0000000000000000ull, /* 5^7 */
+	0xBEBC200000000000ull, 0x0000000000000000ull, /* 5^8 */
+	0xEE6B280000000000ull, 0x0000000000000000ull, /* 5^9 */
+	0x9502F90000000000ull, 0x0000000000000000ull, /* 5^10 */
+	0xBA43B74000000000ull, 0x0000000000000000ull, /* 5^11 */
+	0xE8D4A51000000000ull, 0x0000000000000000ull, /* 5^12 */
+	0x9184E72A00000000ull, 0x0000000000000000ull, /* 5^13 */
+	0xB5E620F480000000ull, 0x0000000000000000ull, /* 5^14 */
+	0xE35FA931A0000000ull, 0x0000000000000000ull, /* 5^15 */
+	0x8E1BC9BF04000000ull, 0x0000000000000000ull, /* 5^16 */
+	0xB1A2BC2EC5000000ull, 0x0000000000000000ull, /* 5^17 */
+	0xDE0B6B3A76400000ull, 0x0000000000000000ull, /* 5^18 */
+	0x8AC7230489E80000ull, 0x0000000000000000ull, /* 5^19 */
+	0xAD78EBC5AC620000ull, 0x0000000000000000ull, /* 5^20 */
+	0xD8D726B7177A8000ull, 0x0000000000000000ull, /* 5^21 */
+	0x878678326EAC9000ull, 0x0000000000000000ull, /* 5^22 */
+	0xA968163F0A57B400ull, 0x0000000000000000ull, /* 5^23 */
+	0xD3C21BCECCEDA100ull, 0x0000000000000000ull, /* 5^24 */
+	0x84595161401484A0ull, 0x0000000000000000ull, /* 5^25 */
+	0xA56FA5B99019A5C8ull, 0x0000000000000000ull, /* 5^26 */
+	0xCECB8F27F4200F3Aull, 0x0000000000000000ull, /* 5^27 */
+	0x813F3978F8940984ull, 0x4000000000000000ull, /* 5^28 */
+	0xA18F07D736B90BE5ull, 0x5000000000000000ull, /* 5^29 */
+	0xC9F2C9CD04674EDEull, 0xA400000000000000ull, /* 5^30 */
+	0xFC6F7C4045812296ull, 0x4D00000000000000ull, /* 5^31 */
+	0x9DC5ADA82B70B59Dull, 0xF020000000000000ull, /* 5^32 */
+	0xC5371912364CE305ull, 0x6C28000000000000ull, /* 5^33 */
+	0xF684DF56C3E01BC6ull, 0xC732000000000000ull, /* 5^34 */
+	0x9A130B963A6C115Cull, 0x3C7F400000000000ull, /* 5^35 */
+	0xC097CE7BC90715B3ull, 0x4B9F100000000000ull, /* 5^36 */
+	0xF0BDC21ABB48DB20ull, 0x1E86D40000000000ull, /* 5^37 */
+	0x96769950B50D88F4ull, 0x1314448000000000ull, /* 5^38 */
+};
+
+/* Number of bits to shift decimal number of 'point' to get it below one */
+static const uint8_t decimalPowerShifts[] = {1, 3, 6, 9, 13, 16, 19, 23, 26};
+
+/* ceil(log2(5^e)) for e > 0, 1 for e = 0 */
+static int32_t pow5bits(int32_t e)
+{
+	return (int32_t)(((uint32_t)e * 1217359) >> 19) + 1;
+}
+
+/* floor(log10(2^e)) */
+static uint32_t log10Pow2(int32_t e)
+{
+	return ((uint32_t)e * 78913) >> 18;
+}
+
+/* floor(log10(5^e)) */
+static uint32_t log10Pow5(int32_t e)
+{
+	return ((uint32_t)e * 732923) >> 20;
+}
+
+static uint32_t pow5Factor(uint32_t value)
+{
+	uint32_t count = 0;
+	while(value % 5 == 0)
+	{
+		value /= 5;
+		count++;
+	}
+	return count;
+}
+
+static int multipleOfPowerOf5(uint32_t value, uint32_t p)
+{
+	return pow5Factor(value) >= p;
+}
+
+static int multipleOfPowerOf2(uint32_t value, uint32_t p)
+{
+	return (value & ((1u << p) - 1)) == 0;
+}
+
+static uint32_t mulShift(uint32_t m, uint64_t factor, int32_t shift)
+{
+	uint64_t low = (uint64_t)m * (uint32_t)factor;
+	uint64_t high = (uint64_t)m * (uint32_t)(factor >> 32);
+	uint64_t sum = (low >> 32) + high;
+	return (uint32_t)(sum >> (shift - 32));
+}
+
+/**
+ * Shortest decimal 'mantissa' * 10^'exponent' of finite, non-zero float
+ * given by IEEE 754 fields.
+ */
+static void floatToDecimal(uint32_t ieeeFraction, uint32_t ieeeExponent,
+                           uint32_t* mantissa, int32_t* exponent)
+{
+	int32_t e2;
+	uint32_t m2;
+	if(ieeeExponent == 0)
+	{
+		e2 = 1 - UTILS_FLOAT_EXPONENT_BIAS - UTILS_FLOAT_FRACTION_BITS - 2;
+		m2 = ieeeFraction;
+	}
+	else
+	{
+		e2 = (int32_t)ieeeExponent - UTILS_FLOAT_EXPONENT_BIAS -
+		     UTILS_FLOAT_FRACTION_BITS - 2;
+		m2 = (1u << UTILS_FLOAT_FRACTION_BITS) | ieeeFraction;
+	}
+	const int acceptBounds = (m2 & 1) == 0;
+
+	/* Step 2: halfway points to the neighbours, scaled by 4 */
+	const uint32_t mv = 4 * m2;
+	const uint32_t mp = 4 * m2 + 2;
+	const uint32_t mmShift = ieeeFraction != 0 || ieeeExponent <= 1;
+	const uint32_t mm = 4 * m2 - 1 - mmShift;
+
+	/* Step 3: convert the interval to a decimal power base */
+	uint32_t vr, vp, vm;
+	int32_t e10;
+	int vmIsTrailingZeros = 0;
+	int vrIsTrailingZeros = 0;
+	uint8_t lastRemovedDigit = 0;
+	if(e2 >= 0)
+	{
+		const uint32_t q = log10Pow2(e2);
+		const int32_t k = UTILS_FLOAT_POW5_INV_BITCOUNT + pow5bits(q) - 1;
+		const int32_t i = -e2 + (int32_t)q + k;
+		e10 = (int32_t)q;
+		vr = mulShift(mv, floatPow5InvSplit[q], i);
+		vp = mulShift(mp, floatPow5InvSplit[q], i);
+		vm = mulShift(mm, floatPow5InvSplit[q], i);
+		if(q != 0 && (vp - 1) / 10 <= vm / 10)
+		{
+			const int32_t l = UTILS_FLOAT_POW5_INV_BITCOUNT + pow5bits(q - 1) - 1;
+			lastRemovedDigit = mulShift(mv, floatPow5InvSplit[q - 1],
+			                            -e2 + (int32_t)q - 1 + l) % 10;
+		}
+		if(q <= 9)
+		{
+			/* Only one of mp, mv and mm can be a multiple of 5, if any */
+			if(mv % 5 == 0)
+			{
+				vrIsTrailingZeros = multipleOfPowerOf5(mv, q);
+			}
+			else if(acceptBounds)
+			{
+				vmIsTrailingZeros = multipleOfPowerOf5(mm, q);
+			}
+			else
+			{
+				vp -= multipleOfPowerOf5(mp, q);
+			}
+		}
+	}
+	else
+	{
+		const uint32_t q = log10Pow5(-e2);
+		const int32_t i = -e2 - (int32_t)q;
+		const int32_t k = pow5bits(i) - UTILS_FLOAT_POW5_BITCOUNT;
+		int32_t j = (int32_t)q - k;
+		e10 = (int32_t)q + e2;
+		vr = mulShift(mv, floatPow5Split[i], j);
+		vp = mulShift(mp, floatPow5Split[i], j);
+		vm = mulShift(mm, floatPow5Split[i], j);
+		if(q != 0 && (vp - 1) / 10 <= vm / 10)
+		{
+			j = (int32_t)q - 1 - (pow5bits(i + 1) - UTILS_FLOAT_POW5_BITCOUNT);
+			lastRemovedDigit = mulShift(mv, floatPow5Split[i + 1], j) % 10;
+		}
+		if(q <= 1)
+		{
+			/* mv = 4 * m2 has at least two trailing zero bits */
+			vrIsTrailingZeros = 1;
+			if(acceptBounds)
+			{
+				vmIsTrailingZeros = mmShift == 1;
+			}
+			else
+			{
+				vp--;
+			}
+		}
+		else if(q < 31)
+		{
+			vrIsTrailingZeros = multipleOfPowerOf2(mv, q - 1);
+		}
+	}
+
+	/* Step 4: the shortest decimal representation within the interval */
+	int32_t removed = 0;
+	uint32_t output;
+	if(vmIsTrailingZeros || vrIsTrailingZeros)
+	{
+		while(vp / 10 > vm / 10)
+		{
+			vmIsTrailingZeros &= vm % 10 == 0;
+			vrIsTrailingZeros &= lastRemovedDigit == 0;
+			lastRemovedDigit = vr % 10;
+			vr /= 10;
+			vp /= 10;
+			vm /= 10;
+			removed++;
+		}
+		if(vmIsTrailingZeros)
+		{
+			while(vm % 10 == 0)
+			{
+				vrIsTrailingZeros &= lastRemovedDigit == 0;
+				lastRemovedDigit = vr % 10;
+				vr /= 10;
+				vp /= 10;
+				vm /= 10;
+				removed++;
+			}
+		}
+		if(vrIsTrailingZeros && lastRemovedDigit == 5 && vr % 2 == 0)
+		{
+			/* Round even if the exact value is .....50..0 */
+			lastRemovedDigit = 4;
+		}
+		output = vr + ((vr == vm && (!acceptBounds || !vmIsTrailingZeros)) ||
+		               lastRemovedDigit >= 5);
+	}
+	else
+	{
+		while(vp / 10 > vm / 10)
+		{
+			lastRemovedDigit = vr % 10;
+			vr /= 10;
+			vp /= 10;
+			vm /= 10;
+			removed++;
+		}
+		output = vr + (vr == vm || lastRemovedDigit >= 5);
+	}
+	*mantissa = output;
+	*exponent = e10 + removed;
+}
+
+static uint8_t writeScientific(uint32_t mantissa, int32_t exponent, char* string)
+{
+	uint8_t digits = utilsGetNumberOfDecimalDigits(mantissa);
+	uint8_t charCounter = 0;
+	exponent += digits - 1;
+
+	/* First digit, point and the rest of digits */
+	utilsWriteDecimalDigits(mantissa, &string[digits + 1]);
+	string[0] = string[1];
+	if(digits > 1)
+	{
+		string[1] = '.';
+		charCounter = digits + 1;
+	}
+	else
+	{
+		charCounter = 1;
+	}
+	string[charCounter++] = 'e';
+	if(exponent < 0)
+	{
+		string[charCounter++] = '-';
+		exponent = -exponent;
+	}
+	charCounter += utilsGetNumberOfDecimalDigits(exponent);
+	utilsWriteDecimalDigits(exponent, &string[charCounter]);
+	return charCounter;
+}
+
+static uint8_t writeFixed(uint32_t mantissa, int32_t exponent, char* string)
+{
+	uint8_t digits = utilsGetNumberOfDecimalDigits(mantissa);
+	int32_t point = digits + exponent;
+	uint8_t charCounter = 0;
+
+	if(exponent >= 0)
+	{
+		utilsWriteDecimalDigits(mantissa, &string[digits]);
+		for(charCounter = digits; charCounter < point; charCounter++)
+		{
+			string[charCounter] = '0';
+		}
+		string[charCounter++] = '.';
+		string[charCounter++] = '0';
+	}
+	else if(point > 0)
+	{
+		utilsWriteDecimalDigits(mantissa, &string[digits + 1]);
+		for(charCounter = 0; charCounter < point; charCounter++)
+		{
+			string[charCounter] = string[charCounter + 1];
+		}
+		string[point] = '.';
+		charCounter = digits + 1;
+	}
+	else
+	{
+		string[charCounter++] = '0';
+		string[charCounter++] = '.';
+		while(point++ < 0)
+		{
+			string[charCounter++] = '0';
+		}
+		charCounter += digits;
+		utilsWriteDecimalDigits(mantissa, &string[charCounter]);
+	}
+	return charCounter;
+}
+
+/* Shortest string of 'fp' without NULL, returns number of characters.
+ * 'string' must have UTILS_FLOAT_STRING_MAX_SIZE - 1 characters at least */
+uint8_t utilsFloat2Shortest(float fp, UTILS_FLOAT_NOTATION notation, char* string)
+{
+	uint8_t charCounter = 0;
+	uint32_t binForm;
+
+	UTILS_Float2Uint(fp, &binForm);
+	uint32_t signBin = UTILS_FLOAT_GET_SIGN(binForm);
+	uint32_t expBin = UTILS_FLOAT_GET_EXPONENT(binForm);
+	uint32_t manBin = UTILS_FLOAT_GET_FRACTION(binForm);
+
+	if(expBin == UTILS_FLOAT_EXPONENT_MAX && manBin != 0)
+	{
+		string[charCounter++] = 'n';
+		string[charCounter++] = 'a';
+		string[charCounter++] = 'n';
+	}
+	else
+	{
+		if(signBin)
+		{
+			string[charCounter++] = '-';
+		}
+		if(expBin == UTILS_FLOAT_EXPONENT_MAX)
+		{
+			string[charCounter++] = 'i';
+			string[charCounter++] = 'n';
+			string[charCounter++] = 'f';
+		}
+		else
+		{
+			uint32_t mantissa = 0;
+			int32_t exponent = 0;
+			if(expBin != 0 || manBin != 0)
+			{
+				floatToDecimal(manBin, expBin, &mantissa, &exponent);
+			}
+			if(notation == UTILS_FLOAT_SCIENTIFIC)
+			{
+				charCounter += writeScientific(mantissa, exponent,
+				                               &string[charCounter]);
+			}
+			else
+			{
+				charCounter += writeFixed(mantissa, exponent,
+				                          &string[charCounter]);
+			}
+		}
+	}
+	return charCounter;
+}
+
+/**
+ * @brief    Convert floating point variable to the shortest ASCII string
+ *
+ * The string has the minimum number of digits needed to get back the same
+ * 'fp' value, e.g. 0.1f is converted to "0.1" in fixed and to "1e-1" in
+ * scientific notation. The fixed notation always has a decimal point.
+ * Infinity is converted to "inf" and not a number to "nan". All floats
+ * fit into UTILS_FLOAT_STRING_MAX_SIZE characters with the terminating
+ * NULL, which is written when there is space left.
+ *
+ * @param[in]    fp:         floating point value
+ * @param[in]    notation:   fixed or scientific notation
+ * @param[out]   string:     pointer to ascii array
+ * @param[in]    length:     length of string (before conversion)
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to string is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible.
+ *                                 length of string is too short
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_Float2AsciiShortest(float fp, UTILS_FLOAT_NOTATION notation,
+                                      char* string, uint8_t length)
+{
+	if(string == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	char buffer[UTILS_FLOAT_STRING_MAX_SIZE];
+	uint8_t charCounter = utilsFloat2Shortest(fp, notation, buffer);
+	if(charCounter > length)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	for(uint8_t copy = 0; copy < charCounter; copy++)
+	{
+		string[copy] = buffer[copy];
+	}
+	if(charCounter < length)
+	{
+		string[charCounter] = 0x00;
+	}
+	return ERROR_SUCCESS;
+}
+
+static void multiply64(uint64_t a, uint64_t b, uint64_t* high, uint64_t* low)
+{
+#if defined(__SIZEOF_INT128__)
+	unsigned __int128 product = (unsigned __int128)a * b;
+	*high = (uint64_t)(product >> 64);
+	*low = (uint64_t)product;
+#else
+	uint64_t aLow = (uint32_t)a, aHigh = a >> 32;
+	uint64_t bLow = (uint32_t)b, bHigh = b >> 32;
+	uint64_t lowLow = aLow * bLow;
+	uint64_t highLow = aHigh * bLow;
+	uint64_t lowHigh = aLow * bHigh;
+	uint64_t middle = (lowLow >> 32) + (uint32_t)highLow + lowHigh;
+	*high = aHigh * bHigh + (highLow >> 32) + (middle >> 32);
+	*low = (middle << 32) | (uint32_t)lowLow;
+#endif
+}
+
+/**
+ * IEEE bits (without sign) of w * 10^q rounded to nearest even, w != 0.
+ * The result is exact for every w with up to 19 digits.
+ */
+static uint32_t eiselLemire(int32_t q, uint64_t w)
+{
+	if(q < UTILS_FLOAT_SMALLEST_POWER10)
+	{
+		return 0;
+	}
+	if(q > UTILS_FLOAT_LARGEST_POWER10)
+	{
+		return UTILS_FLOAT_EXPONENT_MASK;
+	}
+	const uint32_t index = 2 * (q - UTILS_FLOAT_SMALLEST_POWER10);
+	const uint64_t precisionMask = 0xFFFFFFFFFFFFFFFFull >>
+	                               (UTILS_FLOAT_FRACTION_BITS + 3);
+	const int zeros = (int)utilsCountLeadingZeros64(w);
+	uint64_t high, low;
+
+	w <<= zeros;
+	multiply64(w, pow5Table128[index], &high, &low);
+	if((high & precisionMask) == precisionMask)
+	{
+		/* Bits below the mantissa are all ones, take the low half too */
+		uint64_t secondHigh, secondLow;
+		multiply64(w, pow5Table128[index + 1], &secondHigh, &secondLow);
+		low += secondHigh;
+		if(secondHigh > low)
+		{
+			high++;
+		}
+	}
+	const int upperBit = (int)(high >> 63);
+	const int shift = upperBit + 64 - UTILS_FLOAT_FRACTION_BITS - 3;
+	uint64_t mantissa = high >> shift;
+	/* floor(log2(10^q)) + 63, plus bias */
+	int32_t power2 = (((152170 + 65536) * q) >> 16) + 63 + upperBit - zeros +
+	                 UTILS_FLOAT_EXPONENT_BIAS;
+
+	if(power2 <= 0)
+	{
+		/* Denormal, or the smallest normal after rounding */
+		if(-power2 + 1 >= 64)
+		{
+			return 0;
+		}
+		mantissa >>= -power2 + 1;
+		mantissa += mantissa & 1;
+		mantissa >>= 1;
+		power2 = (mantissa < (1ull << UTILS_FLOAT_FRACTION_BITS)) ? 0 : 1;
+		return ((uint32_t)power2 << UTILS_FLOAT_EXPONENT_POSITION) |
+		       ((uint32_t)mantissa & UTILS_FLOAT_FRACTION_MASK);
+	}
+	if(low <= 1 && q >= -17 && q <= 10 && (mantissa & 3) == 1 &&
+	   (mantissa << shift) == high)
+	{
+		/* Exactly halfway between two floats, round to even */
+		mantissa &= ~1ull;
+	}
+	mantissa += mantissa & 1;
+	mantissa >>= 1;
+	if(mantissa >= (2ull << UTILS_FLOAT_FRACTION_BITS))
+	{
+		mantissa = 1ull << UTILS_FLOAT_FRACTION_BITS;
+		power2++;
+	}
+	if(power2 >= UTILS_FLOAT_EXPONENT_MAX)
+	{
+		return UTILS_FLOAT_EXPONENT_MASK;
+	}
+	return ((uint32_t)power2 << UTILS_FLOAT_EXPONENT_POSITION) |
+	       ((uint32_t)mantissa & UTILS_FLOAT_FRACTION_MASK);
+}
+
+static void decimalTrim(DecimalNumber* decimal)
+{
+	while(decimal->count > 0 && decimal->digits[decimal->count - 1] == 0)
+	{
+		decimal->count--;
+	}
+	if(decimal->count == 0)
+	{
+		decimal->point = 0;
+	}
+}
+
+/* Multiply by 2^shift, shift <= UTILS_DECIMAL_MAX_SHIFT */
+static void decimalLeftShift(DecimalNumber* decimal, uint32_t shift)
+{
+	uint64_t carry = 0;
+	for(int32_t digit = decimal->count - 1; digit >= 0; digit--)
+	{
+		uint64_t value = ((uint64_t)decimal->digits[digit] << shift) + carry;
+		decimal->digits[digit] = value % 10;
+		carry = value / 10;
+	}
+	/* The carry becomes new leading digits */
+	int32_t extra = 0;
+	for(uint64_t rest = carry; rest != 0; rest /= 10)
+	{
+		extra++;
+	}
+	for(int32_t digit = decimal->count - 1; digit >= 0; digit--)
+	{
+		if(digit + extra < UTILS_DECIMAL_MAX_DIGITS)
+		{
+			decimal->digits[digit + extra] = decimal->digits[digit];
+		}
+		else if(decimal->digits[digit] != 0)
+		{
+			decimal->truncated = 1;
+		}
+	}
+	for(int32_t digit = extra - 1; digit >= 0; digit--)
+	{
+		decimal->digits[digit] = carry % 10;
+		carry /= 10;
+	}
+	decimal->count += extra;
+	if(decimal->count > UTILS_DECIMAL_MAX_DIGITS)
+	{
+		decimal->count = UTILS_DECIMAL_MAX_DIGITS;
+	}
+	decimal->point += extra;
+	decimalTrim(decimal);
+}
+
+/* Divide by 2^shift, shift <= UTILS_DECIMAL_MAX_SHIFT */
+static void decimalRightShift(DecimalNumber* decimal, uint32_t shift)
+{
+	const uint64_t mask = (1ull << shift) - 1;
+	int32_t read = 0;
+	int32_t write = 0;
+	uint64_t value = 0;
+
+	/* Gather leading digits until there is something to divide */
+	while((value >> shift) == 0)
+	{
+		if(read < decimal->count)
+		{
+			value = value * 10 + decimal->digits[read];
+		}
+		else if(value == 0)
+		{
+			decimal->count = 0;
+			decimal->point = 0;
+			return;
+		}
+		else
+		{
+			value *= 10;
+		}
+		read++;
+	}
+	decimal->point -= read - 1;
+	for(; read < decimal->count; read++)
+	{
+		decimal->digits[write++] = (uint8_t)(value >> shift);
+		value = (value & mask) * 10 + decimal->digits[read];
+	}
+	while(value > 0)
+	{
+		if(write < UTILS_DECIMAL_MAX_DIGITS)
+		{
+			decimal->digits[write++] = (uint8_t)(value >> shift);
+		}
+		else if((value >> shift) > 0)
+		{
+			decimal->truncated = 1;
+		}
+		value = (value & mask) * 10;
+	}
+	decimal->count = write;
+	decimalTrim(decimal);
+}
+
+static void decimalShift(DecimalNumber* decimal, int32_t shift)
+{
+	while(shift > UTILS_DECIMAL_MAX_SHIFT)
+	{
+		decimalLeftShift(decimal, UTILS_DECIMAL_MAX_SHIFT);
+		shift -= UTILS_DECIMAL_MAX_SHIFT;
+	}
+	while(shift < -UTILS_DECIMAL_MAX_SHIFT)
+	{
+		decimalRightShift(decimal, UTILS_DECIMAL_MAX_SHIFT);
+		shift += UTILS_DECIMAL_MAX_SHIFT;
+	}
+	if(shift > 0)
+	{
+		decimalLeftShift(decimal, shift);
+	}
+	else if(shift < 0)
+	{
+		decimalRightShift(decimal, -shift);
+	}
+}
+
+/* Integer part rounded half to even, the decimal must be below 2^32 */
+static uint32_t decimalRoundedInteger(const DecimalNumber* decimal)
+{
+	uint32_t value = 0;
+	int32_t digit;
+	for(digit = 0; digit < decimal->point && digit < decimal->count; digit++)
+	{
+		value = value * 10 + decimal->digits[digit];
+	}
+	for(; digit < decimal->point; digit++)
+	{
+		value *= 10;
+	}
+	int32_t next = decimal->point;
+	if(next >= 0 && next < decimal->count)
+	{
+		if(decimal->digits[next] == 5 && next + 1 == decimal->count)
+		{
+			value += decimal->truncated || (value & 1);
+		}
+		else
+		{
+			value += decimal->digits[next] >= 5;
+		}
+	}
+	return value;
+}
+
+/* IEEE bits (without sign) of decimal number with exact binary scaling */
+static uint32_t decimalToFloat(DecimalNumber* decimal)
+{
+	const int32_t bias = -UTILS_FLOAT_EXPONENT_BIAS;
+	const int32_t shifts = sizeof(decimalPowerShifts);
+	int32_t exponent = 0;
+
+	if(decimal->count == 0 || decimal->point < UTILS_FLOAT_SMALLEST_POWER10 + 19)
+	{
+		return 0;
+	}
+	if(decimal->point > UTILS_FLOAT_LARGEST_POWER10 + 1)
+	{
+		return UTILS_FLOAT_EXPONENT_MASK;
+	}
+	/* Scale by powers of two to <0.5..1) */
+	while(decimal->point > 0)
+	{
+		int32_t shift = (decimal->point >= shifts) ? UTILS_DECIMAL_MAX_SHIFT :
+		                decimalPowerShifts[decimal->point];
+		decimalShift(decimal, -shift);
+		exponent += shift;
+	}
+	while(decimal->point < 0 || (decimal->point == 0 && decimal->digits[0] < 5))
+	{
+		int32_t shift = (-decimal->point >= shifts) ? UTILS_DECIMAL_MAX_SHIFT :
+		                decimalPowerShifts[-decimal->point];
+		decimalShift(decimal, shift);
+		exponent -= shift;
+	}
+	/* Floating point mantissa is in <1..2) */
+	exponent--;
+	if(exponent < bias + 1)
+	{
+		decimalShift(decimal, exponent - bias - 1);
+		exponent = bias + 1;
+	}
+	if(exponent - bias >= UTILS_FLOAT_EXPONENT_MAX)
+	{
+		return UTILS_FLOAT_EXPONENT_MASK;
+	}
+	decimalShift(decimal, UTILS_FLOAT_FRACTION_BITS + 1);
+	uint32_t mantissa = decimalRoundedInteger(decimal);
+	if(mantissa == (2u << UTILS_FLOAT_FRACTION_BITS))
+	{
+		mantissa >>= 1;
+		exponent++;
+		if(exponent - bias >= UTILS_FLOAT_EXPONENT_MAX)
+		{
+			return UTILS_FLOAT_EXPONENT_MASK;
+		}
+	}
+	if((mantissa & (1u << UTILS_FLOAT_FRACTION_BITS)) == 0)
+	{
+		exponent = bias;
+	}
+	return ((uint32_t)(exponent - bias) << UTILS_FLOAT_EXPONENT_POSITION) |
+	       (mantissa & UTILS_FLOAT_FRACTION_MASK);
+}
+
+/* Load all mantissa digits of <begin..end) for the slow path */
+static void loadDecimal(const char* string, uint32_t begin, uint32_t end,
+                        int32_t point, DecimalNumber* decimal)
+{
+	decimal->count = 0;
+	decimal->truncated = 0;
+	for(uint32_t pos = begin; pos < end; pos++)
+	{
+		if(string[pos] == '.')
+		{
+			continue;
+		}
+		uint8_t digit = string[pos] - '0';
+		if(decimal->count == 0 && digit == 0)
+		{
+			continue;
+		}
+		if(decimal->count < UTILS_DECIMAL_MAX_DIGITS)
+		{
+			decimal->digits[decimal->count++] = digit;
+		}
+		else if(digit != 0)
+		{
+			decimal->truncated = 1;
+		}
+	}
+	decimal->point = point;
+	decimalTrim(decimal);
+}
+
+static uint32_t matchWord(const char* string, uint32_t length, const char* word)
+{
+	uint32_t pos = 0;
+	while(word[pos] != 0)
+	{
+		if(pos >= length || UTILS_TO_LOWER(string[pos]) != word[pos])
+		{
+			return 0;
+		}
+		pos++;
+	}
+	return pos;
+}
+
+/**
+ * @brief    Convert decimal ASCII string to floating point variable
+ *
+ * The string can start with '+' or '-' sign, then has decimal digits with
+ * an optional decimal point, and an optional exponent just like "-1.5e-3".
+ * "inf", "infinity" and "nan" are accepted in any letter case. Conversion
+ * stops at the first character which does not belong to the number, or
+ * after 'length' characters, so the string does not need NULL at the end.
+ * The result is correctly rounded (to nearest, ties to even) for any
+ * number of digits and it does not depend on the locale.
+ *
+ * @param[in]    string:     decimal ASCII string
+ * @param[in]    length:     maximum number of characters to read
+ * @param[out]   fp:         conversion result
+ * @param[out]   consumed:   number of characters of the number
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to string, fp or consumed is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible.
+ *                                 String does not start with a number
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_AsciiString2Float(const char* string, uint32_t length,
+                                    float* fp, uint32_t* consumed)
+{
+	if(string == NULL || fp == NULL || consumed == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	uint32_t pos = 0;
+	uint32_t sign = 0;
+	uint32_t binForm;
+	uint32_t special;
+
+	*consumed = 0;
+	if(pos < length && (string[pos] == '-' || string[pos] == '+'))
+	{
+		sign = (string[pos] == '-') ? UTILS_FLOAT_SIGN_MASK : 0;
+		pos++;
+	}
+	if((special = matchWord(&string[pos], length - pos, "nan")) != 0)
+	{
+		*consumed = pos + special;
+		UTILS_Uint2Float(sign | UTILS_FLOAT_EXPONENT_MASK | 0x00400000, fp);
+		return ERROR_SUCCESS;
+	}
+	if((special = matchWord(&string[pos], length - pos, "inf")) != 0)
+	{
+		uint32_t longForm = matchWord(&string[pos], length - pos, "infinity");
+		*consumed = pos + (longForm ? longForm : special);
+		UTILS_Uint2Float(sign | UTILS_FLOAT_EXPONENT_MASK, fp);
+		return ERROR_SUCCESS;
+	}
+
+	/* Up to 19 significant digits in w, the rest only moves the exponent */
+	const uint32_t begin = pos;
+	uint64_t w = 0;
+	int32_t digits = 0;
+	int32_t exponent = 0;
+	uint8_t anyDigit = 0;
+	uint8_t truncated = 0;
+	uint8_t fraction = 0;
+	for(; pos < length; pos++)
+	{
+		char ascii = string[pos];
+		if(ascii == '.' && !fraction)
+		{
+			fraction = 1;
+			continue;
+		}
+		if(!UTILS_IS_DIGIT(ascii))
+		{
+			break;
+		}
+		anyDigit = 1;
+		if(w == 0 && ascii == '0')
+		{
+			exponent -= fraction;
+		}
+		else if(digits < UTILS_FLOAT_FAST_DIGITS)
+		{
+			w = w * 10 + (ascii - '0');
+			digits++;
+			exponent -= fraction;
+		}
+		else
+		{
+			truncated |= (ascii != '0');
+			exponent += !fraction;
+		}
+	}
+	if(!anyDigit)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	const uint32_t end = pos;
+
+	if(pos < length && UTILS_TO_LOWER(string[pos]) == 'e')
+	{
+		uint32_t expPos = pos + 1;
+		int32_t expSign = 1;
+		int32_t expValue = 0;
+		if(expPos < length && (string[expPos] == '-' || string[expPos] == '+'))
+		{
+			expSign = (string[expPos] == '-') ? -1 : 1;
+			expPos++;
+		}
+		if(expPos < length && UTILS_IS_DIGIT(string[expPos]))
+		{
+			for(; expPos < length && UTILS_IS_DIGIT(string[expPos]); expPos++)
+			{
+				if(expValue < UTILS_FLOAT_EXPONENT_LIMIT)
+				{
+					expValue = expValue * 10 + (string[expPos] - '0');
+				}
+			}
+			exponent += expSign * expValue;
+			pos = expPos;
+		}
+	}
+	*consumed = pos;
+
+	if(w == 0)
+	{
+		binForm = 0;
+	}
+	else
+	{
+		binForm = eiselLemire(exponent, w);
+		if(truncated && binForm != eiselLemire(exponent, w + 1))
+		{
+			/* The dropped digits decide, use all of them */
+			DecimalNumber decimal;
+			loadDecimal(string, begin, end, exponent + digits, &decimal);
+			binForm = decimalToFloat(&decimal);
+		}
+	}
+	UTILS_Uint2Float(sign | binForm, fp);
+	return ERROR_SUCCESS;
+}
@@ -0,0 +1,594 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ * @copyrights Copyrights 2019 Stanislaw Pietrzak. All rights reserved.
+ * @file utils_format.c
+ * @author Stanislaw Pietrzak
+ * @email integralzerox@gmail.com
+ * @date 16 October 2026
+ * @brief Heap-free subset of printf formatting
+ *
+ * A log line should not need snprintf, which brings the whole stdio
+ * formatting engine with locales, wide characters and double arithmetic.
+ * Here the format is parsed in one pass: literal text is copied in runs and
+ * every conversion specification is decoded with a few compares and sent to
+ * the decimal, hex and float kernels of the library. Text goes through the
+ * writer, so nothing is padded with NULL and nothing is allocated.
+ *
+ * %f prints the argument rounded to float, the type of every other float
+ * function of the library. The digits are exact for that float, rounded
+ * half to even, with integer arithmetic only.
+ *
+ * @see https://github.com/Dev4Embedded/
+ */
+
+#include "stdarg.h"
+#include "stddef.h"
+#include "string.h"
+#include "utils.h"
+#include "utils_private.h"
+
+#define FORMAT_FLAG_LEFT        0x01
+#define FORMAT_FLAG_ZERO        0x02
+#define FORMAT_FLAG_PLUS        0x04
+#define FORMAT_FLAG_SPACE       0x08
+#define FORMAT_FLAG_ALTERNATE   0x10
+
+#define FORMAT_SIZE_INT         0
+#define FORMAT_SIZE_LONG        1
+#define FORMAT_SIZE_LONG_LONG   2
+
+#define FORMAT_NO_PRECISION     (-1)
+#define FORMAT_FLOAT_PRECISION  6
+/* Larger numbers of characters do not fit in any buffer of the library */
+#define FORMAT_MAX_WIDTH        0xFFFF
+
+/* Float integer part (up to 39 digits), '.' and fraction, or 64-bit integer */
+#define FORMAT_DIGITS_SIZE      (40 + 1 + UTILS_FORMAT_MAX_PRECISION)
+
+typedef struct
+{
+	uint8_t flags;
+	uint8_t size;
+	uint32_t width;
+	int32_t precision;
+}FormatSpec;
+
+static UTILS_ERROR appendLiteral(UTILS_WRITER* writer, const char* text,
+                                 uint32_t count)
+{
+	char* output = utilsWriterReserve(writer, count);
+	if(output == NULL)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	memcpy(output, text, count);
+	writer->cursor += count;
+	return ERROR_SUCCESS;
+}
+
+/* Field of 'width': spaces, prefix (sign or "0x"), zeros and body.
+ * Left justified fields get the spaces after the body */
+static UTILS_ERROR appendField(UTILS_WRITER* writer, const FormatSpec* spec,
+                               const char* prefix, uint32_t prefixSize,
+                               uint32_t zeros, const char* body,
+                               uint32_t bodySize)
+{
+	uint32_t size = prefixSize + zeros + bodySize;
+	uint32_t spaces = (spec->width > size) ? spec->width - size : 0;
+	if(spaces && (spec->flags & (FORMAT_FLAG_ZERO | FORMAT_FLAG_LEFT)) ==
+	             FORMAT_FLAG_ZERO)
+	{
+		zeros += spaces;
+		size += spaces;
+		spaces = 0;
+	}
+	char* output = utilsWriterReserve(writer, (uint64_t)size + spaces);
+	if(output == NULL)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	if(!(spec->flags & FORMAT_FLAG_LEFT))
+	{
+		memset(output, ' ', spaces);
+		output += spaces;
+	}
+	memcpy(output, prefix, prefixSize);
+	output += prefixSize;
+	memset(output, '0', zeros);
+	output += zeros;
+	memcpy(output, body, bodySize);
+	output += bodySize;
+	if(spec->flags & FORMAT_FLAG_LEFT)
+	{
+		memset(output, ' ', spaces);
+	}
+	writer->cursor += size + spaces;
+	return ERROR_SUCCESS;
+}
+
+/* Sign character of non negative value selected by '+' and ' ' flags */
+static uint32_t getPositiveSign(const FormatSpec* spec, char* sign)
+{
+	if(spec->flags & (FORMAT_FLAG_PLUS | FORMAT_FLAG_SPACE))
+	{
+		sign[0] = (spec->flags & FORMAT_FLAG_PLUS) ? '+' : ' ';
+		return 1;
+	}
+	return 0;
+}
+
+/* Precision is the minimum number of digits, and it turns off the '0' flag.
+ * Zero with precision 0 has no digits at all */
+static UTILS_ERROR appendInteger(UTILS_WRITER* writer, FormatSpec* spec,
+                                 uint64_t magnitude, uint8_t negative)
+{
+	char digits[FORMAT_DIGITS_SIZE];
+	char sign[1];
+	uint32_t signSize;
+	uint32_t count = utilsGetNumberOfDecimalDigits64(magnitude);
+	uint32_t zeros = 0;
+	if(negative)
+	{
+		sign[0] = '-';
+		signSize = 1;
+	}
+	else
+	{
+		signSize = getPositiveSign(spec, sign);
+	}
+	if(spec->precision != FORMAT_NO_PRECISION)
+	{
+		spec->flags &= ~FORMAT_FLAG_ZERO;
+		if(spec->precision == 0 && magnitude == 0)
+		{
+			count = 0;
+		}
+		else if((uint32_t)spec->precision > count)
+		{
+			zeros = (uint32_t)spec->precision - count;
+		}
+	}
+	utilsWriteDecimalDigits64(magnitude, &digits[sizeof(digits)]);
+	return appendField(writer, spec, sign, signSize, zeros,
+	                   &digits[sizeof(digits) - count], count);
+}
+
+static UTILS_ERROR appendHex(UTILS_WRITER* writer, FormatSpec* spec,
+                             uint64_t integer, char letterA)
+{
+	char digits[FORMAT_DIGITS_SIZE];
+	char prefix[2] = {'0', (char)(letterA + 'x' - 'a')};
+	uint32_t count = (67 - utilsCountLeadingZeros64(integer | 1)) / 4;
+	uint32_t prefixSize = 0;
+	uint32_t zeros = 0;
+	if((spec->flags & FORMAT_FLAG_ALTERNATE) && integer != 0)
+	{
+		prefixSize = sizeof(prefix);
+	}
+	if(spec->precision != FORMAT_NO_PRECISION)
+	{
+		spec->flags &= ~FORMAT_FLAG_ZERO;
+		if(spec->precision == 0 && integer == 0)
+		{
+			count = 0;
+		}
+		else if((uint32_t)spec->precision > count)
+		{
+			zeros = (uint32_t)spec->precision - count;
+		}
+	}
+	utilsWriteHexDigits(integer, (uint8_t)count, &digits[sizeof(digits)],
+	                    letterA);
+	return appendField(writer, spec, prefix, prefixSize, zeros,
+	                   &digits[sizeof(digits) - count], count);
+}
+
+/* 'words' (the lowest one first) are divided by 10^9 in place,
+ * the remainder is returned */
+static uint32_t divideWords(uint32_t* words, uint32_t count)
+{
+	uint64_t remainder = 0;
+	for(uint32_t word = count; word > 0; word--)
+	{
+		uint64_t dividend = (remainder << 32) | words[word - 1];
+		words[word - 1] = (uint32_t)(dividend / 1000000000u);
+		remainder = dividend % 1000000000u;
+	}
+	return (uint32_t)remainder;
+}
+
+/* Digits of 'mantissa' * 2^'shift' up to 2^128, ending just before 'end' */
+static uint32_t writeLargeInteger(uint32_t mantissa, uint32_t shift, char* end)
+{
+	uint32_t words[4] = {0};
+	uint64_t low = (uint64_t)mantissa << (shift % 32);
+	words[shift / 32] = (uint32_t)low;
+	if(shift / 32 < 3)
+	{
+		words[shift / 32 + 1] = (uint32_t)(low >> 32);
+	}
+	char* begin = end;
+	uint32_t chunk = divideWords(words, 4);
+	while(words[0] | words[1] | words[2] | words[3])
+	{
+		/* Full group of nine digits with leading zeros */
+		begin -= 9;
+		memset(begin, '0', 9);
+		utilsWriteDecimalDigits(chunk, begin + 9);
+		chunk = divideWords(words, 4);
+	}
+	uint32_t count = utilsGetNumberOfDecimalDigits(chunk);
+	utilsWriteDecimalDigits(chunk, begin);
+	return (uint32_t)(end - begin) + count;
+}
+
+/* Float is 'mantissa' * 2^'exponent'. The value scaled by 10^precision is
+ * rounded half to even with shifts, which is exact as 2^24 * 10^12 < 2^64 */
+static UTILS_ERROR appendFloat(UTILS_WRITER* writer, FormatSpec* spec,
+                               double value)
+{
+	char digits[FORMAT_DIGITS_SIZE];
+	char sign[1];
+	uint32_t signSize;
+	uint32_t bits;
+	float fp = (float)value;
+	memcpy(&bits, &fp, sizeof(bits));
+	uint32_t exponent = UTILS_FLOAT_GET_EXPONENT(bits);
+	uint32_t mantissa = UTILS_FLOAT_GET_FRACTION(bits);
+	uint32_t precision = (spec->precision == FORMAT_NO_PRECISION) ?
+	                     FORMAT_FLOAT_PRECISION : (uint32_t)spec->precision;
+	if(precision > UTILS_FORMAT_MAX_PRECISION)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	if(UTILS_FLOAT_GET_SIGN(bits))
+	{
+		sign[0] = '-';
+		signSize = 1;
+	}
+	else
+	{
+		signSize = getPositiveSign(spec, sign);
+	}
+	if(exponent == UTILS_FLOAT_EXPONENT_MAX)
+	{
+		spec->flags &= ~FORMAT_FLAG_ZERO;
+		return appendField(writer, spec, sign, signSize, 0,
+		                   mantissa ? "nan" : "inf", 3);
+	}
+	int32_t shift;
+	if(exponent == 0)
+	{
+		shift = 1 - UTILS_FLOAT_EXPONENT_BIAS - UTILS_FLOAT_FRACTION_BITS;
+	}
+	else
+	{
+		mantissa |= 1u << UTILS_FLOAT_FRACTION_BITS;
+		shift = (int32_t)exponent - UTILS_FLOAT_EXPONENT_BIAS -
+		        UTILS_FLOAT_FRACTION_BITS;
+	}
+
+	char* end = &digits[sizeof(digits)];
+	uint32_t count = precision + (precision || (spec->flags & FORMAT_FLAG_ALTERNATE));
+	char* point = end - count;
+	memset(point, '0', count);
+	if(count)
+	{
+		point[0] = '.';
+	}
+	if(shift >= 0)
+	{
+		/* Integer value, the fraction is zero */
+		count += writeLargeInteger(mantissa, (uint32_t)shift, point);
+	}
+	else
+	{
+		uint64_t power = 1;
+		for(uint32_t digit = 0; digit < precision; digit++)
+		{
+			power *= 10;
+		}
+		uint64_t scaled = (uint64_t)mantissa * power;
+		uint32_t rightShift = (uint32_t)-shift;
+		uint64_t rounded = 0;
+		if(rightShift <= 64)
+		{
+			uint64_t half = 1ull << (rightShift - 1);
+			uint64_t remainder = scaled & (half | (half - 1));
+			rounded = (rightShift < 64) ? scaled >> rightShift : 0;
+			if(remainder > half || (remainder == half && (rounded & 1)))
+			{
+				rounded++;
+			}
+		}
+		uint64_t integer = rounded / power;
+		uint64_t fraction = rounded % power;
+		if(precision)
+		{
+			/* Leading zeros of fraction are already there */
+			utilsWriteDecimalDigits64(fraction, end);
+		}
+		utilsWriteDecimalDigits64(integer, point);
+		count += utilsGetNumberOfDecimalDigits64(integer);
+	}
+	return appendField(writer, spec, sign, signSize, 0, end - count, count);
+}
+
+/* Flags, width, precision and length of specification after '%' */
+static const char* parseSpec(const char* format, FormatSpec* spec,
+                             va_list* args)
+{
+	spec->flags = 0;
+	spec->size = FORMAT_SIZE_INT;
+	spec->width = 0;
+	spec->precision = FORMAT_NO_PRECISION;
+	for(;; format++)
+	{
+		if(*format == '-')      spec->flags |= FORMAT_FLAG_LEFT;
+		else if(*format == '0') spec->flags |= FORMAT_FLAG_ZERO;
+		else if(*format == '+') spec->flags |= FORMAT_FLAG_PLUS;
+		else if(*format == ' ') spec->flags |= FORMAT_FLAG_SPACE;
+		else if(*format == '#') spec->flags |= FORMAT_FLAG_ALTERNATE;
+		else break;
+	}
+	if(*format == '*')
+	{
+		int width = va_arg(*args, int);
+		if(width < 0)
+		{
+			spec->flags |= FORMAT_FLAG_LEFT;
+			width = (width < -FORMAT_MAX_WIDTH) ? FORMAT_MAX_WIDTH : -width;
+		}
+		spec->width = (width > FORMAT_MAX_WIDTH) ? FORMAT_MAX_WIDTH :
+		                                           (uint32_t)width;
+		format++;
+	}
+	for(; *format >= '0' && *format <= '9'; format++)
+	{
+		spec->width = spec->width * 10 + (uint32_t)(*format - '0');
+		if(spec->width > FORMAT_MAX_WIDTH)
+		{
+			spec->width = FORMAT_MAX_WIDTH;
+		}
+	}
+	if(*format == '.')
+	{
+		format++;
+		spec->precision = 0;
+		if(*format == '*')
+		{
+			int precision = va_arg(*args, int);
+			spec->precision = (precision < 0) ? FORMAT_NO_PRECISION :
+			                  (precision > FORMAT_MAX_WIDTH) ?
+			                  FORMAT_MAX_WIDTH : precision;
+			format++;
+		}
+		for(; *format >= '0' && *format <= '9'; format++)
+		{
+			spec->precision = spec->precision * 10 + (*format - '0');
+			if(spec->precision > FORMAT_MAX_WIDTH)
+			{
+				spec->precision = FORMAT_MAX_WIDTH;
+			}
+		}
+	}
+	if(*format == 'l')
+	{
+		format++;
+		spec->size = FORMAT_SIZE_LONG;
+		if(*format == 'l')
+		{
+			format++;
+			spec->size = FORMAT_SIZE_LONG_LONG;
+		}
+	}
+	return format;
+}
+
+static int64_t getSigned(const FormatSpec* spec, va_list* args)
+{
+	if(spec->size == FORMAT_SIZE_LONG_LONG) return va_arg(*args, long long);
+	if(spec->size == FORMAT_SIZE_LONG)      return va_arg(*args, long);
+	return va_arg(*args, int);
+}
+
+static uint64_t getUnsigned(const FormatSpec* spec, va_list* args)
+{
+	if(spec->size == FORMAT_SIZE_LONG_LONG) return va_arg(*args, unsigned long long);
+	if(spec->size == FORMAT_SIZE_LONG)      return va_arg(*args, unsigned long);
+	return va_arg(*args, unsigned int);
+}
+
+static UTILS_ERROR formatToWriter(UTILS_WRITER* writer, const char* format,
+                                  va_list* args)
+{
+	UTILS_ERROR error = ERROR_SUCCESS;
+	FormatSpec spec;
+	while(*format != 0x00 && error == ERROR_SUCCESS)
+	{
+		const char* literal = format;
+		while(*format != '%' && *format != 0x00)
+		{
+			format++;
+		}
+		if(format != literal)
+		{
+			error = appendLiteral(writer, literal, (uint32_t)(format - literal));
+			continue;
+		}
+		format = parseSpec(format + 1, &spec, args);
+		switch(*format++)
+		{
+		case 'd':
+		case 'i':
+		{
+			int64_t integer = getSigned(&spec, args);
+			uint64_t magnitude = (integer < 0) ? 0u - (uint64_t)integer :
+			                                     (uint64_t)integer;
+			error = appendInteger(writer, &spec, magnitude, integer < 0);
+			break;
+		}
+		case 'u':
+			/* '+' and ' ' flags are only for signed conversions */
+			spec.flags &= (uint8_t)~(FORMAT_FLAG_PLUS | FORMAT_FLAG_SPACE);
+			error = appendInteger(writer, &spec, getUnsigned(&spec, args), 0);
+			break;
+		case 'x':
+			error = appendHex(writer, &spec, getUnsigned(&spec, args), 'a');
+			break;
+		case 'X':
+			error = appendHex(writer, &spec, getUnsigned(&spec, args), 'A');
+			break;
+		case 'f':
+			error = appendFloat(writer, &spec, va_arg(*args, double));
+			break;
+		case 's':
+		{
+			const char* string = va_arg(*args, const char*);
+			if(string == NULL)
+			{
+				return ERROR_NULL_POINTER;
+			}
+			/* Precision limits the characters, they are not read after it */
+			uint32_t length = 0;
+			while(string[length] != 0x00 &&
+			      (spec.precision == FORMAT_NO_PRECISION ||
+			       length < (uint32_t)spec.precision))
+			{
+				length++;
+			}
+			spec.flags &= ~FORMAT_FLAG_ZERO;
+			error = appendField(writer, &spec, "", 0, 0, string, length);
+			break;
+		}
+		case 'c':
+		{
+			char character = (char)va_arg(*args, int);
+			spec.flags &= ~FORMAT_FLAG_ZERO;
+			error = appendField(writer, &spec, "", 0, 0, &character, 1);
+			break;
+		}
+		case '%':
+			error = appendLiteral(writer, "%", 1);
+			break;
+		default:
+			return ERROR_CONVERSION_FAIL;
+		}
+	}
+	return error;
+}
+
+/**
+ * @brief    Format text to buffer with va_list of arguments
+ *
+ * See UTILS_Format().
+ *
+ * @param[out]   buffer:     buffer for text with NULL
+ * @param[in]    length:     size of buffer
+ * @param[in]    format:     format string
+ * @param[in]    args:       arguments of conversions
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to buffer, format or string
+ *                                 argument of %s is NULL
+ *     ERROR_CONVERSION_FAIL     - text does not fit and it is cut or format
+ *                                 is not supported
+ *     ERROR_SUCCESS             - text is complete
+ */
+UTILS_ERROR UTILS_FormatV(char* buffer, uint32_t length, const char* format,
+                          va_list args)
+{
+	UTILS_WRITER writer;
+	if(buffer == NULL || format == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	if(length == 0)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	/* Place for NULL is kept, so the text is terminated also when cut */
+	UTILS_WriterInit(&writer, buffer, length - 1);
+	va_list copy;
+	va_copy(copy, args);
+	UTILS_ERROR error = formatToWriter(&writer, format, &copy);
+	va_end(copy);
+	buffer[writer.cursor] = 0x00;
+	return error;
+}
+
+/**
+ * @brief    Format text to buffer, subset of snprintf
+ *
+ * Conversions %d %i %u %x %X %f %s %c and %% are supported with flags
+ * '-', '0', '+', ' ' and '#', width and precision (also given as '*'
+ * arguments), and 'l' or 'll' length of integers. %f prints the argument
+ * rounded to float with at most UTILS_FORMAT_MAX_PRECISION decimals. The
+ * text is always terminated with NULL. When a conversion does not fit, the
+ * text ends before it.
+ *
+ * @param[out]   buffer:     buffer for text with NULL
+ * @param[in]    length:     size of buffer
+ * @param[in]    format:     format string
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to buffer, format or string
+ *                                 argument of %s is NULL
+ *     ERROR_CONVERSION_FAIL     - text does not fit and it is cut or format
+ *                                 is not supported
+ *     ERROR_SUCCESS             - text is complete
+ */
+UTILS_ERROR UTILS_Format(char* buffer, uint32_t length, const char* format, ...)
+{
+	va_list args;
+	va_start(args, format);
+	UTILS_ERROR error = UTILS_FormatV(buffer, length, format, args);
+	va_end(args);
+	return error;
+}
+
+/**
+ * @brief    Append formatted text to writer
+ *
+ * The format is the same as of UTILS_Format(), but the text continues at the
+ * cursor of writer and it is not terminated.
+ *
+ * @param[in,out] writer:    writer of characters
+ * @param[in]    format:     format string
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to writer, format or string
+ *                                 argument of %s is NULL
+ *     ERROR_CONVERSION_FAIL     - text does not fit, writer has overflowed
+ *                                 before or format is not supported
+ *     ERROR_SUCCESS             - text is appended
+ */
+UTILS_ERROR UTILS_WriterAppendFormat(UTILS_WRITER* writer, const char* format, ...)
+{
+	if(writer == NULL || format == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	if(writer->overflow)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	va_list args;
+	va_start(args, format);
+	UTILS_ERROR error = formatToWriter(writer, format, &args);
+	va_end(args);
+	return error;
+}
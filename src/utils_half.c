@@ -0,0 +1,374 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ * @copyrights Copyrights 2019 Stanislaw Pietrzak. All rights reserved.
+ * @file utils_half.c
+ * @author Stanislaw Pietrzak
+ * @email integralzerox@gmail.com
+ * @date 16 October 2026
+ * @brief Conversions of float arrays to 16-bit floats and back
+ *
+ * IEEE half precision (fp16) has 5 exponent and 10 fraction bits, so it
+ * keeps about three decimal digits up to 65504. bfloat16 is the top half of
+ * float: the same range with 7 fraction bits. Floats are rounded to nearest
+ * even, values above the range become infinity and values below the
+ * smallest fp16 denormal become zero. NaNs stay NaNs with the quiet bit set
+ * and the top bits of the payload, as F16C instructions convert them.
+ *
+ * On x86 fp16 is converted by F16C eight values per instruction and
+ * bfloat16 with AVX2 integer rounding of eight values per step. Other CPUs
+ * use the bit manipulation of one value.
+ *
+ * @see https://github.com/Dev4Embedded/
+ */
+
+#include "stddef.h"
+#include "string.h"
+#include "utils.h"
+#include "utils_private.h"
+#include "utils_cpu.h"
+
+#define HALF_SIGN_MASK              0x8000
+#define HALF_EXPONENT_MASK          0x7C00
+#define HALF_FRACTION_MASK          0x03FF
+#define HALF_FRACTION_BITS          10
+#define HALF_EXPONENT_BIAS          15
+#define HALF_QUIET_NAN              0x0200
+/* Shift of float fraction to half and bfloat16 fraction */
+#define HALF_FRACTION_SHIFT         (UTILS_FLOAT_FRACTION_BITS - HALF_FRACTION_BITS)
+#define BFLOAT16_SHIFT              16
+#define BFLOAT16_QUIET_NAN          0x0040
+/* Float bits of 65520, the first value rounded to infinity */
+#define HALF_OVERFLOW               0x477FF000
+/* Float bits of 2^-14, the smallest normal half */
+#define HALF_NORMAL_MIN             0x38800000
+/* Biased float exponent of 2^-25, below it values round to zero */
+#define HALF_DENORMAL_EXPONENT_MIN  102
+
+static uint32_t floatBits(float value)
+{
+	uint32_t bits;
+	memcpy(&bits, &value, sizeof(bits));
+	return bits;
+}
+
+static float bitsFloat(uint32_t bits)
+{
+	float value;
+	memcpy(&value, &bits, sizeof(value));
+	return value;
+}
+
+static uint16_t floatToHalf(uint32_t bits)
+{
+	uint32_t sign = (bits >> 16) & HALF_SIGN_MASK;
+	uint32_t magnitude = bits & ~UTILS_FLOAT_SIGN_MASK;
+	if(magnitude > UTILS_FLOAT_EXPONENT_MASK)
+	{
+		return (uint16_t)(sign | HALF_EXPONENT_MASK | HALF_QUIET_NAN |
+		                  ((magnitude & UTILS_FLOAT_FRACTION_MASK) >> HALF_FRACTION_SHIFT));
+	}
+	if(magnitude >= HALF_OVERFLOW)
+	{
+		return (uint16_t)(sign | HALF_EXPONENT_MASK);
+	}
+	if(magnitude >= HALF_NORMAL_MIN)
+	{
+		/* Rebias exponent and round to nearest even, carry of the fraction
+		 * goes to the exponent */
+		magnitude -= (uint32_t)(UTILS_FLOAT_EXPONENT_BIAS - HALF_EXPONENT_BIAS)
+		             << UTILS_FLOAT_EXPONENT_POSITION;
+		magnitude += (1u << (HALF_FRACTION_SHIFT - 1)) - 1 +
+		             ((magnitude >> HALF_FRACTION_SHIFT) & 1);
+		return (uint16_t)(sign | (magnitude >> HALF_FRACTION_SHIFT));
+	}
+	uint32_t exponent = magnitude >> UTILS_FLOAT_EXPONENT_POSITION;
+	if(exponent < HALF_DENORMAL_EXPONENT_MIN)
+	{
+		return (uint16_t)sign;
+	}
+	/* Denormal half is the fraction in units of 2^-24 */
+	uint32_t fraction = (magnitude & UTILS_FLOAT_FRACTION_MASK) |
+	                    (1u << UTILS_FLOAT_FRACTION_BITS);
+	uint32_t shift = UTILS_FLOAT_EXPONENT_BIAS - 1 - exponent;
+	uint32_t half = fraction >> shift;
+	uint32_t rest = fraction & ((1u << shift) - 1);
+	uint32_t tie = 1u << (shift - 1);
+	if(rest > tie || (rest == tie && (half & 1)))
+	{
+		half++;
+	}
+	return (uint16_t)(sign | half);
+}
+
+static uint32_t halfToFloat(uint16_t half)
+{
+	uint32_t sign = (uint32_t)(half & HALF_SIGN_MASK) << 16;
+	uint32_t exponent = (half & HALF_EXPONENT_MASK) >> HALF_FRACTION_BITS;
+	uint32_t fraction = half & HALF_FRACTION_MASK;
+	if(exponent == HALF_EXPONENT_MASK >> HALF_FRACTION_BITS)
+	{
+		if(fraction != 0)
+		{
+			fraction |= HALF_QUIET_NAN;
+		}
+		return sign | UTILS_FLOAT_EXPONENT_MASK | (fraction << HALF_FRACTION_SHIFT);
+	}
+	if(exponent == 0)
+	{
+		if(fraction == 0)
+		{
+			return sign;
+		}
+		/* Denormal is normal float, its top bit becomes the implicit one */
+		uint32_t top = 31 - utilsCountLeadingZeros32(fraction);
+		fraction = (fraction << (UTILS_FLOAT_FRACTION_BITS - top)) &
+		           UTILS_FLOAT_FRACTION_MASK;
+		return sign | ((top + UTILS_FLOAT_EXPONENT_BIAS - HALF_EXPONENT_BIAS -
+		                HALF_FRACTION_BITS + 1) << UTILS_FLOAT_EXPONENT_POSITION) |
+		       fraction;
+	}
+	return sign | ((exponent + UTILS_FLOAT_EXPONENT_BIAS - HALF_EXPONENT_BIAS)
+	               << UTILS_FLOAT_EXPONENT_POSITION) | (fraction << HALF_FRACTION_SHIFT);
+}
+
+static uint16_t floatToBfloat16(uint32_t bits)
+{
+	if((bits & ~UTILS_FLOAT_SIGN_MASK) > UTILS_FLOAT_EXPONENT_MASK)
+	{
+		return (uint16_t)((bits >> BFLOAT16_SHIFT) | BFLOAT16_QUIET_NAN);
+	}
+	/* Carry of the fraction goes to the exponent, the largest values
+	 * round to infinity */
+	bits += (1u << (BFLOAT16_SHIFT - 1)) - 1 + ((bits >> BFLOAT16_SHIFT) & 1);
+	return (uint16_t)(bits >> BFLOAT16_SHIFT);
+}
+
+#if UTILS_X86
+UTILS_TARGET("avx,f16c")
+static uint32_t floatArrayToHalfF16c(const float* values, uint32_t count,
+                                     uint16_t* halves)
+{
+	uint32_t index = 0;
+	for(; count - index >= 8; index += 8)
+	{
+		__m128i converted = _mm256_cvtps_ph(_mm256_loadu_ps(&values[index]),
+		                                    _MM_FROUND_TO_NEAREST_INT);
+		_mm_storeu_si128((__m128i*)&halves[index], converted);
+	}
+	return index;
+}
+
+UTILS_TARGET("avx,f16c")
+static uint32_t halfToFloatArrayF16c(const uint16_t* halves, uint32_t count,
+                                     float* values)
+{
+	uint32_t index = 0;
+	for(; count - index >= 8; index += 8)
+	{
+		__m128i loaded = _mm_loadu_si128((const __m128i*)&halves[index]);
+		_mm256_storeu_ps(&values[index], _mm256_cvtph_ps(loaded));
+	}
+	return index;
+}
+
+/* Eight floats rounded to bfloat16 in the low halves of 32-bit lanes */
+UTILS_TARGET("avx2")
+static __m256i roundBfloat16Avx2(const float* values)
+{
+	const __m256i magnitudeMask = _mm256_set1_epi32((int32_t)~UTILS_FLOAT_SIGN_MASK);
+	const __m256i infinity = _mm256_set1_epi32(UTILS_FLOAT_EXPONENT_MASK);
+	__m256i bits = _mm256_loadu_si256((const __m256i*)values);
+	__m256i isNan = _mm256_cmpgt_epi32(_mm256_and_si256(bits, magnitudeMask), infinity);
+	__m256i odd = _mm256_and_si256(_mm256_srli_epi32(bits, BFLOAT16_SHIFT),
+	                               _mm256_set1_epi32(1));
+	__m256i rounded = _mm256_add_epi32(_mm256_add_epi32(bits, odd),
+	                                   _mm256_set1_epi32((1 << (BFLOAT16_SHIFT - 1)) - 1));
+	__m256i nan = _mm256_or_si256(bits, _mm256_set1_epi32(BFLOAT16_QUIET_NAN << BFLOAT16_SHIFT));
+	return _mm256_srli_epi32(_mm256_blendv_epi8(rounded, nan, isNan), BFLOAT16_SHIFT);
+}
+
+UTILS_TARGET("avx2")
+static uint32_t floatArrayToBfloat16Avx2(const float* values, uint32_t count,
+                                         uint16_t* bfloats)
+{
+	uint32_t index = 0;
+	for(; count - index >= 16; index += 16)
+	{
+		/* Packing works in 128-bit lanes, so the quarters are reordered */
+		__m256i packed = _mm256_packus_epi32(roundBfloat16Avx2(&values[index]),
+		                                     roundBfloat16Avx2(&values[index + 8]));
+		_mm256_storeu_si256((__m256i*)&bfloats[index],
+		                    _mm256_permute4x64_epi64(packed, 0xD8));
+	}
+	return index;
+}
+
+UTILS_TARGET("avx2")
+static uint32_t bfloat16ToFloatArrayAvx2(const uint16_t* bfloats, uint32_t count,
+                                         float* values)
+{
+	uint32_t index = 0;
+	for(; count - index >= 8; index += 8)
+	{
+		__m256i loaded = _mm256_cvtepu16_epi32(_mm_loadu_si128((const __m128i*)&bfloats[index]));
+		_mm256_storeu_si256((__m256i*)&values[index],
+		                    _mm256_slli_epi32(loaded, BFLOAT16_SHIFT));
+	}
+	return index;
+}
+#endif
+
+/**
+ * @brief    Convert array of floats to IEEE half precision floats
+ *
+ * Values are rounded to nearest even. Magnitudes from 65520 up become
+ * infinity, magnitudes below 2^-14 are rounded in denormal steps of 2^-24
+ * and magnitudes up to 2^-25 become zero.
+ *
+ * @param[in]    values:     array of floats
+ * @param[in]    count:      number of values
+ * @param[out]   halves:     array of 'count' halves, it must not overlap
+ *                           values
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to values or halves is NULL
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_FloatArrayToHalf(const float* values, uint32_t count,
+                                   uint16_t* halves)
+{
+	if(values == NULL || halves == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	uint32_t index = 0;
+#if UTILS_X86
+	if(UTILS_CPU_HAS("f16c") && UTILS_CPU_HAS("avx"))
+	{
+		index = floatArrayToHalfF16c(values, count, halves);
+	}
+#endif
+	for(; index < count; index++)
+	{
+		halves[index] = floatToHalf(floatBits(values[index]));
+	}
+	return ERROR_SUCCESS;
+}
+
+/**
+ * @brief    Convert array of IEEE half precision floats to floats
+ *
+ * Every half has exact float value.
+ *
+ * @param[in]    halves:     array of halves
+ * @param[in]    count:      number of values
+ * @param[out]   values:     array of 'count' floats, it must not overlap
+ *                           halves
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to halves or values is NULL
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_HalfToFloatArray(const uint16_t* halves, uint32_t count,
+                                   float* values)
+{
+	if(halves == NULL || values == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	uint32_t index = 0;
+#if UTILS_X86
+	if(UTILS_CPU_HAS("f16c") && UTILS_CPU_HAS("avx"))
+	{
+		index = halfToFloatArrayF16c(halves, count, values);
+	}
+#endif
+	for(; index < count; index++)
+	{
+		values[index] = bitsFloat(halfToFloat(halves[index]));
+	}
+	return ERROR_SUCCESS;
+}
+
+/**
+ * @brief    Convert array of floats to bfloat16
+ *
+ * Values are rounded to nearest even, the largest floats become infinity.
+ *
+ * @param[in]    values:     array of floats
+ * @param[in]    count:      number of values
+ * @param[out]   bfloats:    array of 'count' bfloat16 values, it must not
+ *                           overlap values
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to values or bfloats is NULL
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_FloatArrayToBfloat16(const float* values, uint32_t count,
+                                       uint16_t* bfloats)
+{
+	if(values == NULL || bfloats == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	uint32_t index = 0;
+#if UTILS_X86
+	if(UTILS_CPU_HAS("avx2"))
+	{
+		index = floatArrayToBfloat16Avx2(values, count, bfloats);
+	}
+#endif
+	for(; index < count; index++)
+	{
+		bfloats[index] = floatToBfloat16(floatBits(values[index]));
+	}
+	return ERROR_SUCCESS;
+}
+
+/**
+ * @brief    Convert array of bfloat16 values to floats
+ *
+ * Every bfloat16 is the top half of float, so the conversion is exact.
+ *
+ * @param[in]    bfloats:    array of bfloat16 values
+ * @param[in]    count:      number of values
+ * @param[out]   values:     array of 'count' floats, it must not overlap
+ *                           bfloats
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to bfloats or values is NULL
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_Bfloat16ToFloatArray(const uint16_t* bfloats, uint32_t count,
+                                       float* values)
+{
+	if(bfloats == NULL || values == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	uint32_t index = 0;
+#if UTILS_X86
+	if(UTILS_CPU_HAS("avx2"))
+	{
+		index = bfloat16ToFloatArrayAvx2(bfloats, count, values);
+	}
+#endif
+	for(; index < count; index++)
+	{
+		values[index] = bitsFloat((uint32_t)bfloats[index] << BFLOAT16_SHIFT);
+	}
+	return ERROR_SUCCESS;
+}
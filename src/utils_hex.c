@@ -0,0 +1,604 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ * @copyrights Copyrights 2019 Stanislaw Pietrzak. All rights reserved.
+ * @file utils_hex.c
+ * @author Stanislaw Pietrzak
+ * @email integralzerox@gmail.com
+ * @date 16 October 2026
+ * @brief Hexadecimal codec and hex dump of byte buffers
+ *
+ * Every byte is written as two upper case hexadecimal characters without
+ * any prefix. The x86 build adds SSE2 and AVX2 kernels, which are selected
+ * at run time. The portable loop handles the tail of the buffer and every
+ * other platform. The hex dump writes whole lines at once, the hex pairs
+ * of 16 bytes are spread to their columns with SSSE3 shuffles.
+ *
+ * @see https://github.com/Dev4Embedded/
+ */
+
+#include "stddef.h"
+#include "utils.h"
+#include "utils_private.h"
+#include "utils_cpu.h"
+
+/* Vector kernels use the nibble table, the TINY profile has only loops */
+#define HEX_VECTOR      (UTILS_X86 && UTILS_HEX_IMPL != UTILS_IMPL_LOOP)
+
+static void bytesToHexScalar(const uint8_t* bytes, uint32_t size, char* hex)
+{
+	for(uint32_t byte = 0; byte < size; byte++)
+	{
+		utilsWriteHexByte(bytes[byte], &hex[2 * byte]);
+	}
+}
+
+/* Return number of converted bytes, or 'size' + 1 if a character is wrong */
+static uint32_t hexToBytesScalar(const char* hex, uint32_t size, uint8_t* bytes)
+{
+	for(uint32_t byte = 0; byte < size; byte++)
+	{
+		uint8_t high = utilsHexNibbleValue(hex[2 * byte]);
+		uint8_t low = utilsHexNibbleValue(hex[2 * byte + 1]);
+		if((high | low) == 0xFF)
+		{
+			return size + 1;
+		}
+		bytes[byte] = (uint8_t)((high << 4) | low);
+	}
+	return size;
+}
+
+#if HEX_VECTOR && defined(__SSE2__)
+/* Nibble to character: '0' + n, plus 7 more for 'A'..'F' */
+static __m128i nibblesToHexSse2(__m128i nibbles)
+{
+	__m128i letters = _mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9));
+	__m128i ascii = _mm_add_epi8(nibbles, _mm_set1_epi8('0'));
+	return _mm_add_epi8(ascii, _mm_and_si128(letters, _mm_set1_epi8(7)));
+}
+
+static uint32_t bytesToHexSse2(const uint8_t* bytes, uint32_t size, char* hex)
+{
+	const __m128i mask = _mm_set1_epi8(0x0F);
+	uint32_t byte = 0;
+	for(; byte + 16 <= size; byte += 16)
+	{
+		__m128i input = _mm_loadu_si128((const __m128i*)&bytes[byte]);
+		__m128i high = _mm_and_si128(_mm_srli_epi16(input, 4), mask);
+		__m128i low = _mm_and_si128(input, mask);
+		high = nibblesToHexSse2(high);
+		low = nibblesToHexSse2(low);
+		_mm_storeu_si128((__m128i*)&hex[2 * byte],
+		                 _mm_unpacklo_epi8(high, low));
+		_mm_storeu_si128((__m128i*)&hex[2 * byte + 16],
+		                 _mm_unpackhi_epi8(high, low));
+	}
+	return byte;
+}
+
+/* Character to nibble with range validation, 'valid' gets 0xFF per good byte */
+static __m128i hexToNibblesSse2(__m128i ascii, __m128i* valid)
+{
+	__m128i digit = _mm_sub_epi8(ascii, _mm_set1_epi8('0'));
+	__m128i letter = _mm_sub_epi8(_mm_or_si128(ascii, _mm_set1_epi8(0x20)),
+	                              _mm_set1_epi8('a'));
+	__m128i isDigit = _mm_and_si128(_mm_cmpgt_epi8(digit, _mm_set1_epi8(-1)),
+	                                _mm_cmplt_epi8(digit, _mm_set1_epi8(10)));
+	__m128i isLetter = _mm_and_si128(_mm_cmpgt_epi8(letter, _mm_set1_epi8(-1)),
+	                                 _mm_cmplt_epi8(letter, _mm_set1_epi8(6)));
+	*valid = _mm_or_si128(isDigit, isLetter);
+	letter = _mm_add_epi8(letter, _mm_set1_epi8(10));
+	return _mm_or_si128(_mm_and_si128(isDigit, digit),
+	                    _mm_andnot_si128(isDigit, letter));
+}
+
+/* Pairs of nibbles (high first) in 16-bit lanes to one byte per lane */
+static __m128i packNibblesSse2(__m128i nibbles)
+{
+	__m128i high = _mm_slli_epi16(_mm_and_si128(nibbles, _mm_set1_epi16(0xFF)), 4);
+	__m128i low = _mm_srli_epi16(nibbles, 8);
+	return _mm_or_si128(high, low);
+}
+
+static uint32_t hexToBytesSse2(const char* hex, uint32_t size, uint8_t* bytes)
+{
+	uint32_t byte = 0;
+	for(; byte + 16 <= size; byte += 16)
+	{
+		__m128i valid0, valid1;
+		__m128i first = _mm_loadu_si128((const __m128i*)&hex[2 * byte]);
+		__m128i second = _mm_loadu_si128((const __m128i*)&hex[2 * byte + 16]);
+		first = hexToNibblesSse2(first, &valid0);
+		second = hexToNibblesSse2(second, &valid1);
+		if(_mm_movemask_epi8(_mm_and_si128(valid0, valid1)) != 0xFFFF)
+		{
+			return size + 1;
+		}
+		_mm_storeu_si128((__m128i*)&bytes[byte],
+		                 _mm_packus_epi16(packNibblesSse2(first),
+		                                  packNibblesSse2(second)));
+	}
+	return byte;
+}
+#endif
+
+#if HEX_VECTOR
+UTILS_TARGET("avx2")
+static uint32_t bytesToHexAvx2(const uint8_t* bytes, uint32_t size, char* hex)
+{
+	const __m256i table = _mm256_broadcastsi128_si256(
+	                          _mm_loadu_si128((const __m128i*)utilsHexNibbles));
+	const __m256i mask = _mm256_set1_epi8(0x0F);
+	uint32_t byte = 0;
+	for(; byte + 32 <= size; byte += 32)
+	{
+		__m256i input = _mm256_loadu_si256((const __m256i*)&bytes[byte]);
+		__m256i high = _mm256_and_si256(_mm256_srli_epi16(input, 4), mask);
+		__m256i low = _mm256_and_si256(input, mask);
+		high = _mm256_shuffle_epi8(table, high);
+		low = _mm256_shuffle_epi8(table, low);
+		__m256i first = _mm256_unpacklo_epi8(high, low);
+		__m256i second = _mm256_unpackhi_epi8(high, low);
+		_mm256_storeu_si256((__m256i*)&hex[2 * byte],
+		                    _mm256_permute2x128_si256(first, second, 0x20));
+		_mm256_storeu_si256((__m256i*)&hex[2 * byte + 32],
+		                    _mm256_permute2x128_si256(first, second, 0x31));
+	}
+	return byte;
+}
+
+UTILS_TARGET("avx2")
+static __m256i hexToNibblesAvx2(__m256i ascii, __m256i* valid)
+{
+	__m256i digit = _mm256_sub_epi8(ascii, _mm256_set1_epi8('0'));
+	__m256i letter = _mm256_sub_epi8(
+	                     _mm256_or_si256(ascii, _mm256_set1_epi8(0x20)),
+	                     _mm256_set1_epi8('a'));
+	/* Unsigned range check: x <= limit <=> min(x, limit) == x */
+	__m256i isDigit = _mm256_cmpeq_epi8(
+	                      _mm256_min_epu8(digit, _mm256_set1_epi8(9)), digit);
+	__m256i isLetter = _mm256_cmpeq_epi8(
+	                       _mm256_min_epu8(letter, _mm256_set1_epi8(5)), letter);
+	*valid = _mm256_or_si256(isDigit, isLetter);
+	letter = _mm256_add_epi8(letter, _mm256_set1_epi8(10));
+	return _mm256_blendv_epi8(letter, digit, isDigit);
+}
+
+UTILS_TARGET("avx2")
+static uint32_t hexToBytesAvx2(const char* hex, uint32_t size, uint8_t* bytes)
+{
+	const __m256i weights = _mm256_set1_epi16(0x0110);
+	uint32_t byte = 0;
+	for(; byte + 32 <= size; byte += 32)
+	{
+		__m256i valid0, valid1;
+		__m256i first = _mm256_loadu_si256((const __m256i*)&hex[2 * byte]);
+		__m256i second = _mm256_loadu_si256((const __m256i*)&hex[2 * byte + 32]);
+		first = hexToNibblesAvx2(first, &valid0);
+		second = hexToNibblesAvx2(second, &valid1);
+		if(_mm256_movemask_epi8(_mm256_and_si256(valid0, valid1)) != -1)
+		{
+			return size + 1;
+		}
+		/* high * 16 + low in every 16-bit lane */
+		first = _mm256_maddubs_epi16(first, weights);
+		second = _mm256_maddubs_epi16(second, weights);
+		__m256i packed = _mm256_packus_epi16(first, second);
+		_mm256_storeu_si256((__m256i*)&bytes[byte],
+		                    _mm256_permute4x64_epi64(packed, 0xD8));
+	}
+	return byte;
+}
+#endif
+
+/**
+ * @brief    Convert byte buffer to hexadecimal ASCII string
+ *
+ * Every byte is converted to two upper case hexadecimal characters, without
+ * "0x" prefix, so 'length' of 'hex' must be at least two times 'size'.
+ * The terminating NULL is written when there is space left.
+ *
+ * @param[in]    bytes:     buffer to convert
+ * @param[in]    size:      number of bytes in buffer
+ * @param[out]   hex:       hexadecimal string
+ * @param[in]    length:    length of hex string (before conversion)
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to bytes or hex is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible.
+ *                                 length of hex is too short.
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_BytesToHex(const uint8_t* bytes, uint32_t size,
+                             char* hex, uint32_t length)
+{
+	if(bytes == NULL || hex == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	if(size > length / 2)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	uint32_t done = 0;
+#if HEX_VECTOR
+	if(UTILS_CPU_HAS("avx2"))
+	{
+		done = bytesToHexAvx2(bytes, size, hex);
+	}
+#endif
+#if HEX_VECTOR && defined(__SSE2__)
+	done += bytesToHexSse2(&bytes[done], size - done, &hex[2 * done]);
+#endif
+	bytesToHexScalar(&bytes[done], size - done, &hex[2 * done]);
+	if(2 * size < length)
+	{
+		hex[2 * size] = 0x00;
+	}
+	return ERROR_SUCCESS;
+}
+
+/**
+ * @brief    Convert hexadecimal ASCII string to byte buffer
+ *
+ * The 'hex' string must consist only of hexadecimal characters (upper and
+ * lower case) without "0x" prefix, and 'length' must be even. Two characters
+ * give one byte, so 'size' of 'bytes' must be at least half of 'length'.
+ *
+ * @param[in]    hex:       hexadecimal string
+ * @param[in]    length:    number of characters to convert
+ * @param[out]   bytes:     conversion result
+ * @param[in]    size:      size of bytes buffer
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to hex or bytes is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible. Length is odd,
+ *                                 bytes buffer is too small or in hex string
+ *                                 is not allowed character
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_HexToBytes(const char* hex, uint32_t length,
+                             uint8_t* bytes, uint32_t size)
+{
+	if(hex == NULL || bytes == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	if((length & 1) || length / 2 > size)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	uint32_t total = length / 2;
+	uint32_t done = 0;
+#if HEX_VECTOR
+	if(UTILS_CPU_HAS("avx2"))
+	{
+		done = hexToBytesAvx2(hex, total, bytes);
+	}
+#endif
+#if HEX_VECTOR && defined(__SSE2__)
+	if(done <= total)
+	{
+		done += hexToBytesSse2(&hex[2 * done], total - done, &bytes[done]);
+	}
+#endif
+	if(done <= total)
+	{
+		done += hexToBytesScalar(&hex[2 * done], total - done, &bytes[done]);
+	}
+	return (done == total) ? ERROR_SUCCESS : ERROR_CONVERSION_FAIL;
+}
+
+static const UTILS_HEXDUMP_OPTIONS hexDumpDefaults =
+{
+	.bytesPerLine = 16,
+	.groupSize = 8,
+	.offsetDigits = 8,
+	.ascii = 1,
+};
+
+/* Characters of 'count' bytes as "XX " triplets, return end of the dump */
+static char* bytesToTripletsScalar(const uint8_t* bytes, uint32_t count,
+                                   char* dump)
+{
+	for(uint32_t byte = 0; byte < count; byte++)
+	{
+		utilsWriteHexByte(bytes[byte], dump);
+		dump[2] = ' ';
+		dump += 3;
+	}
+	return dump;
+}
+
+static char* bytesToPrintableScalar(const uint8_t* bytes, uint32_t count,
+                                    char* dump)
+{
+	for(uint32_t byte = 0; byte < count; byte++)
+	{
+		dump[byte] = (bytes[byte] >= 0x20 && bytes[byte] < 0x7F) ?
+		             (char)bytes[byte] : '.';
+	}
+	return &dump[count];
+}
+
+#if HEX_VECTOR && defined(__SSE2__)
+/* Control characters, DEL and bytes above 0x7F are replaced with '.' */
+static uint32_t bytesToPrintableSse2(const uint8_t* bytes, uint32_t count,
+                                     char* dump)
+{
+	uint32_t byte = 0;
+	for(; byte + 16 <= count; byte += 16)
+	{
+		__m128i input = _mm_loadu_si128((const __m128i*)&bytes[byte]);
+		/* Signed compare, bytes above 0x7F are negative */
+		__m128i printable = _mm_and_si128(_mm_cmpgt_epi8(input, _mm_set1_epi8(0x1F)),
+		                                  _mm_cmplt_epi8(input, _mm_set1_epi8(0x7F)));
+		_mm_storeu_si128((__m128i*)&dump[byte],
+		                 _mm_or_si128(_mm_and_si128(printable, input),
+		                              _mm_andnot_si128(printable, _mm_set1_epi8('.'))));
+	}
+	return byte;
+}
+#endif
+
+#if HEX_VECTOR
+/* 16 (or 8) bytes to 48 (24) characters: hex pairs are spread to every three positions
+ * by two shuffles per store, the third position gets a space */
+UTILS_TARGET("ssse3")
+static uint32_t bytesToTripletsSsse3(const uint8_t* bytes, uint32_t count,
+                                     char* dump)
+{
+	const __m128i table = _mm_loadu_si128((const __m128i*)utilsHexNibbles);
+	const __m128i mask = _mm_set1_epi8(0x0F);
+	const __m128i spread0 = _mm_setr_epi8(0, 1, -1, 2, 3, -1, 4, 5,
+	                                      -1, 6, 7, -1, 8, 9, -1, 10);
+	const __m128i spread1 = _mm_setr_epi8(11, -1, 12, 13, -1, 14, 15, -1,
+	                                      -1, -1, -1, -1, -1, -1, -1, -1);
+	const __m128i spread2 = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1,
+	                                      0, 1, -1, 2, 3, -1, 4, 5);
+	const __m128i spread3 = _mm_setr_epi8(-1, 6, 7, -1, 8, 9, -1, 10,
+	                                      11, -1, 12, 13, -1, 14, 15, -1);
+	const __m128i spaces0 = _mm_setr_epi8(0, 0, ' ', 0, 0, ' ', 0, 0,
+	                                      ' ', 0, 0, ' ', 0, 0, ' ', 0);
+	const __m128i spaces1 = _mm_setr_epi8(0, ' ', 0, 0, ' ', 0, 0, ' ',
+	                                      0, 0, ' ', 0, 0, ' ', 0, 0);
+	const __m128i spaces2 = _mm_setr_epi8(' ', 0, 0, ' ', 0, 0, ' ', 0,
+	                                      0, ' ', 0, 0, ' ', 0, 0, ' ');
+	uint32_t byte = 0;
+	for(; byte + 16 <= count; byte += 16)
+	{
+		__m128i input = _mm_loadu_si128((const __m128i*)&bytes[byte]);
+		__m128i high = _mm_shuffle_epi8(table, _mm_and_si128(_mm_srli_epi16(input, 4), mask));
+		__m128i low = _mm_shuffle_epi8(table, _mm_and_si128(input, mask));
+		__m128i first = _mm_unpacklo_epi8(high, low);
+		__m128i second = _mm_unpackhi_epi8(high, low);
+		char* triplets = &dump[3 * byte];
+		_mm_storeu_si128((__m128i*)triplets,
+		                 _mm_or_si128(_mm_shuffle_epi8(first, spread0), spaces0));
+		_mm_storeu_si128((__m128i*)&triplets[16],
+		                 _mm_or_si128(_mm_or_si128(_mm_shuffle_epi8(first, spread1),
+		                                           _mm_shuffle_epi8(second, spread2)),
+		                              spaces1));
+		_mm_storeu_si128((__m128i*)&triplets[32],
+		                 _mm_or_si128(_mm_shuffle_epi8(second, spread3), spaces2));
+	}
+	/* Groups of 8 bytes (the default layout) are one half of the above */
+	if(byte + 8 <= count)
+	{
+		__m128i input = _mm_loadl_epi64((const __m128i*)&bytes[byte]);
+		__m128i high = _mm_shuffle_epi8(table, _mm_and_si128(_mm_srli_epi16(input, 4), mask));
+		__m128i low = _mm_shuffle_epi8(table, _mm_and_si128(input, mask));
+		__m128i first = _mm_unpacklo_epi8(high, low);
+		char* triplets = &dump[3 * byte];
+		_mm_storeu_si128((__m128i*)triplets,
+		                 _mm_or_si128(_mm_shuffle_epi8(first, spread0), spaces0));
+		_mm_storel_epi64((__m128i*)&triplets[16],
+		                 _mm_or_si128(_mm_shuffle_epi8(first, spread1), spaces1));
+		byte += 8;
+	}
+	return byte;
+}
+#endif
+
+static char* bytesToTriplets(const uint8_t* bytes, uint32_t count, char* dump)
+{
+	uint32_t done = 0;
+#if HEX_VECTOR
+	if(UTILS_CPU_HAS("ssse3"))
+	{
+		done = bytesToTripletsSsse3(bytes, count, dump);
+	}
+#endif
+	return bytesToTripletsScalar(&bytes[done], count - done, &dump[3 * done]);
+}
+
+static char* bytesToPrintable(const uint8_t* bytes, uint32_t count, char* dump)
+{
+	uint32_t done = 0;
+#if HEX_VECTOR && defined(__SSE2__)
+	done = bytesToPrintableSse2(bytes, count, dump);
+#endif
+	return bytesToPrintableScalar(&bytes[done], count - done, &dump[done]);
+}
+
+/* Characters of hex column of full line: triplets and group separators */
+static uint32_t hexDumpColumn(const UTILS_HEXDUMP_OPTIONS* options,
+                              uint32_t count)
+{
+	uint32_t separators = options->groupSize ?
+	                      (count - 1) / options->groupSize : 0;
+	return 3 * count + separators;
+}
+
+/* Characters of line with 'count' bytes, with new line character */
+static uint32_t hexDumpLine(const UTILS_HEXDUMP_OPTIONS* options,
+                            uint32_t count)
+{
+	uint32_t offset = options->offsetDigits ? options->offsetDigits + 2u : 0;
+	if(!options->ascii)
+	{
+		/* The last space is replaced with new line */
+		return offset + hexDumpColumn(options, count);
+	}
+	/* " |", printable characters, "|\n" */
+	return offset + hexDumpColumn(options, options->bytesPerLine) +
+	       count + 4;
+}
+
+/* Size of the dump with NULL, or 0 if options are wrong or it is too big */
+static uint64_t hexDumpSize(const UTILS_HEXDUMP_OPTIONS* options, uint32_t size)
+{
+	if(options->bytesPerLine == 0 || options->offsetDigits > 16)
+	{
+		return 0;
+	}
+	uint64_t total = (uint64_t)(size / options->bytesPerLine) *
+	                 hexDumpLine(options, options->bytesPerLine) + 1;
+	if(size % options->bytesPerLine)
+	{
+		total += hexDumpLine(options, size % options->bytesPerLine);
+	}
+	return (total > UINT32_MAX) ? 0 : total;
+}
+
+static char* hexDumpWriteLine(const UTILS_HEXDUMP_OPTIONS* options,
+                              uint64_t offset, const uint8_t* bytes,
+                              uint32_t count, char* dump)
+{
+	utilsWriteHexDigits(offset, options->offsetDigits,
+	                    &dump[options->offsetDigits], 'A');
+	if(options->offsetDigits)
+	{
+		dump[options->offsetDigits] = ' ';
+		dump[options->offsetDigits + 1] = ' ';
+		dump += options->offsetDigits + 2;
+	}
+	char* column = dump;
+	uint32_t byte = 0;
+	while(byte < count)
+	{
+		uint32_t group = count - byte;
+		if(options->groupSize && options->groupSize < group)
+		{
+			group = options->groupSize;
+		}
+		dump = bytesToTriplets(&bytes[byte], group, dump);
+		byte += group;
+		if(byte < count)
+		{
+			*dump++ = ' ';
+		}
+	}
+	if(!options->ascii)
+	{
+		dump[-1] = '\n';
+		return dump;
+	}
+	/* Printable column of the last line is aligned with the full lines */
+	char* end = &column[hexDumpColumn(options, options->bytesPerLine)];
+	while(dump < end)
+	{
+		*dump++ = ' ';
+	}
+	dump[0] = ' ';
+	dump[1] = '|';
+	dump = bytesToPrintable(bytes, count, &dump[2]);
+	dump[0] = '|';
+	dump[1] = '\n';
+	return &dump[2];
+}
+
+/**
+ * @brief    Get size of buffer for UTILS_HexDump()
+ *
+ * @param[in]    size:      number of bytes to dump
+ * @param[in]    options:   layout of the dump, NULL for the default layout
+ * @param[out]   length:    number of characters with terminating NULL
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to length is NULL
+ *     ERROR_CONVERSION_FAIL     - options are wrong or the dump is longer
+ *                                 than 4 GB
+ *     ERROR_SUCCESS             - function executed without errors
+ */
+UTILS_ERROR UTILS_HexDumpSize(uint32_t size,
+                              const UTILS_HEXDUMP_OPTIONS* options,
+                              uint32_t* length)
+{
+	if(length == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	uint64_t total = hexDumpSize(options ? options : &hexDumpDefaults, size);
+	if(total == 0)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	*length = (uint32_t)total;
+	return ERROR_SUCCESS;
+}
+
+/**
+ * @brief    Format byte buffer as canonical hex dump
+ *
+ * Every line has the offset, the bytes as upper case hexadecimal pairs and
+ * the printable characters of the bytes ('.' for others), e.g. with the
+ * default options (16 bytes per line, groups of 8, 8 offset digits):
+ * "00000010  48 65 6C 6C 6F 20 57 6F  72 6C 64 0A 00 01 02 03  |Hello World.....|"
+ * Lines end with '\n' and the dump is always terminated with NULL, so
+ * 'length' must be at least the value of UTILS_HexDumpSize().
+ *
+ * @param[in]    bytes:     buffer to dump
+ * @param[in]    size:      number of bytes in buffer
+ * @param[out]   dump:      hex dump string
+ * @param[in]    length:    length of dump string (before conversion)
+ * @param[in]    options:   layout of the dump, NULL for the default layout
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to bytes or dump is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible. length of dump
+ *                                 is too short or options are wrong
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_HexDump(const uint8_t* bytes, uint32_t size,
+                          char* dump, uint32_t length,
+                          const UTILS_HEXDUMP_OPTIONS* options)
+{
+	if(bytes == NULL || dump == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	if(options == NULL)
+	{
+		options = &hexDumpDefaults;
+	}
+	uint64_t total = hexDumpSize(options, size);
+	if(total == 0 || total > length)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	for(uint32_t byte = 0; byte < size; byte += options->bytesPerLine)
+	{
+		uint32_t count = size - byte;
+		if(count > options->bytesPerLine)
+		{
+			count = options->bytesPerLine;
+		}
+		dump = hexDumpWriteLine(options, byte, &bytes[byte], count, dump);
+	}
+	*dump = 0x00;
+	return ERROR_SUCCESS;
+}
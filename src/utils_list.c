@@ -0,0 +1,272 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ * @copyrights Copyrights 2019 Stanislaw Pietrzak. All rights reserved.
+ * @file utils_list.c
+ * @author Stanislaw Pietrzak
+ * @email integralzerox@gmail.com
+ * @date 16 October 2026
+ * @brief Parser of delimited lists of integers
+ *
+ * The buffer is classified in blocks of 64 characters into bit masks of
+ * digits and delimiters, with SSE2 or AVX2 on x86. Tokens are then found
+ * by counting zero bits of the masks instead of testing every character.
+ *
+ * @see https://github.com/Dev4Embedded/
+ */
+
+#include "stddef.h"
+#include "utils.h"
+#include "utils_cpu.h"
+#include "utils_private.h"
+
+#define UTILS_LIST_BLOCK_SIZE       64
+
+typedef struct
+{
+	const char* buffer;
+	uint32_t length;
+	const char* delimiters;
+	uint32_t delimiterSet[8];   /* bitmap of 256 characters */
+	uint32_t base;              /* first character of the current block */
+	uint64_t digits;            /* bit per character of the current block */
+	uint64_t separators;
+	int useAvx2;
+}ListParser;
+
+static int isDelimiter(const ListParser* parser, uint8_t ascii)
+{
+	return (parser->delimiterSet[ascii >> 5] >> (ascii & 31)) & 1;
+}
+
+static void classifyScalar(ListParser* parser, uint32_t size)
+{
+	const char* block = &parser->buffer[parser->base];
+	parser->digits = 0;
+	parser->separators = 0;
+	for(uint32_t pos = 0; pos < size; pos++)
+	{
+		uint8_t ascii = (uint8_t)block[pos];
+		parser->digits |= (uint64_t)((uint8_t)(ascii - '0') < 10) << pos;
+		parser->separators |= (uint64_t)isDelimiter(parser, ascii) << pos;
+	}
+}
+
+#if UTILS_X86 && defined(__SSE2__)
+static void classifySse2(ListParser* parser)
+{
+	const char* block = &parser->buffer[parser->base];
+	const __m128i zero = _mm_set1_epi8('0');
+	const __m128i nine = _mm_set1_epi8(9);
+	parser->digits = 0;
+	parser->separators = 0;
+	for(uint32_t part = 0; part < UTILS_LIST_BLOCK_SIZE; part += 16)
+	{
+		__m128i ascii = _mm_loadu_si128((const __m128i*)&block[part]);
+		__m128i digit = _mm_sub_epi8(ascii, zero);
+		digit = _mm_cmpeq_epi8(_mm_min_epu8(digit, nine), digit);
+		__m128i separator = _mm_setzero_si128();
+		for(const char* delimiter = parser->delimiters; *delimiter; delimiter++)
+		{
+			separator = _mm_or_si128(separator,
+			                _mm_cmpeq_epi8(ascii, _mm_set1_epi8(*delimiter)));
+		}
+		parser->digits |= (uint64_t)(uint16_t)_mm_movemask_epi8(digit) << part;
+		parser->separators |=
+		    (uint64_t)(uint16_t)_mm_movemask_epi8(separator) << part;
+	}
+}
+#endif
+
+#if UTILS_X86
+UTILS_TARGET("avx2")
+static void classifyAvx2(ListParser* parser)
+{
+	const char* block = &parser->buffer[parser->base];
+	const __m256i zero = _mm256_set1_epi8('0');
+	const __m256i nine = _mm256_set1_epi8(9);
+	parser->digits = 0;
+	parser->separators = 0;
+	for(uint32_t part = 0; part < UTILS_LIST_BLOCK_SIZE; part += 32)
+	{
+		__m256i ascii = _mm256_loadu_si256((const __m256i*)&block[part]);
+		__m256i digit = _mm256_sub_epi8(ascii, zero);
+		digit = _mm256_cmpeq_epi8(_mm256_min_epu8(digit, nine), digit);
+		__m256i separator = _mm256_setzero_si256();
+		for(const char* delimiter = parser->delimiters; *delimiter; delimiter++)
+		{
+			separator = _mm256_or_si256(separator,
+			                _mm256_cmpeq_epi8(ascii, _mm256_set1_epi8(*delimiter)));
+		}
+		parser->digits |= (uint64_t)(uint32_t)_mm256_movemask_epi8(digit) << part;
+		parser->separators |=
+		    (uint64_t)(uint32_t)_mm256_movemask_epi8(separator) << part;
+	}
+}
+#endif
+
+/* Load masks of the block which starts at 'base' */
+static void loadBlock(ListParser* parser, uint32_t base)
+{
+	parser->base = base;
+	if(parser->length - base < UTILS_LIST_BLOCK_SIZE)
+	{
+		classifyScalar(parser, parser->length - base);
+		return;
+	}
+#if UTILS_X86
+	if(parser->useAvx2)
+	{
+		classifyAvx2(parser);
+		return;
+	}
+#endif
+#if UTILS_X86 && defined(__SSE2__)
+	classifySse2(parser);
+#else
+	classifyScalar(parser, UTILS_LIST_BLOCK_SIZE);
+#endif
+}
+
+/* First position from 'pos' which is not in the mask selected by 'digits',
+ * or 'length' when the run reaches the end of buffer */
+static uint32_t skipRun(ListParser* parser, uint32_t pos, int digits)
+{
+	while(pos < parser->length)
+	{
+		if(pos - parser->base >= UTILS_LIST_BLOCK_SIZE)
+		{
+			loadBlock(parser, pos - (pos - parser->base) % UTILS_LIST_BLOCK_SIZE);
+		}
+		uint32_t offset = pos - parser->base;
+		uint64_t run = digits ? parser->digits : parser->separators;
+		uint64_t other = ~run >> offset;
+		if(other != 0)
+		{
+			pos += utilsCountTrailingZeros64(other);
+			return (pos < parser->length) ? pos : parser->length;
+		}
+		pos = parser->base + UTILS_LIST_BLOCK_SIZE;
+	}
+	return parser->length;
+}
+
+/**
+ * @brief    Parse delimited list of integers
+ *
+ * Every token must be a decimal integer with an optional '+' or '-' sign,
+ * in range of int32_t. Tokens are split by one or more characters from the
+ * 'delimiters' string (e.g. ",; \t\r\n"), which must not contain digits or
+ * signs. Delimiters at the beginning and at the end of buffer are allowed.
+ * The buffer is read up to 'length' characters and does not need NULL.
+ *
+ * @param[in]    buffer:       text with list of integers
+ * @param[in]    length:       number of characters in buffer
+ * @param[in]    delimiters:   NULL terminated string of delimiter characters
+ * @param[out]   integers:     array for parsed values
+ * @param[in]    maxCount:     size of integers array
+ * @param[out]   count:        number of parsed values
+ * @param[out]   position:     position of the first wrong character, or
+ *                             'length' when all buffer was parsed
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to buffer, delimiters, integers,
+ *                                 count or position is NULL
+ *     ERROR_CONVERSION_FAIL     - conversion is not possible. There is not
+ *                                 allowed character, value out of range or
+ *                                 more values than 'maxCount' at 'position'
+ *     ERROR_SUCCESS             - conversion executed without errors
+ */
+UTILS_ERROR UTILS_ParseInt32List(const char* buffer, uint32_t length,
+                                 const char* delimiters, int32_t* integers,
+                                 uint32_t maxCount, uint32_t* count,
+                                 uint32_t* position)
+{
+	if(buffer == NULL || delimiters == NULL || integers == NULL ||
+	   count == NULL || position == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	ListParser parser;
+	uint32_t pos = 0;
+	uint32_t values = 0;
+
+	parser.buffer = buffer;
+	parser.length = length;
+	parser.delimiters = delimiters;
+	for(uint32_t word = 0; word < 8; word++)
+	{
+		parser.delimiterSet[word] = 0;
+	}
+	for(const char* delimiter = delimiters; *delimiter; delimiter++)
+	{
+		uint8_t ascii = (uint8_t)*delimiter;
+		parser.delimiterSet[ascii >> 5] |= 1u << (ascii & 31);
+	}
+#if UTILS_X86
+	parser.useAvx2 = UTILS_CPU_HAS("avx2");
+#else
+	parser.useAvx2 = 0;
+#endif
+	if(length > 0)
+	{
+		loadBlock(&parser, 0);
+	}
+
+	*count = 0;
+	while((pos = skipRun(&parser, pos, 0)) < length)
+	{
+		uint32_t start = pos;
+		uint8_t isNegative = 0;
+		if(buffer[pos] == '-' || buffer[pos] == '+')
+		{
+			isNegative = (buffer[pos] == '-');
+			pos++;
+		}
+		uint32_t end = skipRun(&parser, pos, 1);
+		if(end == pos)
+		{
+			*position = pos;
+			return ERROR_CONVERSION_FAIL;
+		}
+		if(end < length && !isDelimiter(&parser, (uint8_t)buffer[end]))
+		{
+			*position = end;
+			return ERROR_CONVERSION_FAIL;
+		}
+		while(pos < end - 1 && buffer[pos] == '0')
+		{
+			pos++;
+		}
+		if(end - pos > UTILS_INT_MAX_DIGITS || values == maxCount)
+		{
+			*position = start;
+			return ERROR_CONVERSION_FAIL;
+		}
+		uint64_t value;
+		utilsParseDecimalDigits(&buffer[pos], end - pos, &value);
+		pos = end;
+		if(value > (uint64_t)INT32_MAX + isNegative)
+		{
+			*position = start;
+			return ERROR_CONVERSION_FAIL;
+		}
+		integers[values++] = isNegative ? (int32_t)(0u - (uint32_t)value) :
+		                                  (int32_t)value;
+		*count = values;
+	}
+	*position = length;
+	return ERROR_SUCCESS;
+}
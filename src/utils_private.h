@@ -0,0 +1,168 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ * @copyrights Copyrights 2019 Stanislaw Pietrzak. All rights reserved.
+ * @file utils_private.h
+ * @author Stanislaw Pietrzak
+ * @email integralzerox@gmail.com
+ * @date 16 October 2026
+ * @brief Private helpers shared between source files of the library
+ */
+#ifndef SRC_UTILS_PRIVATE_H_
+#define SRC_UTILS_PRIVATE_H_
+
+#include "inttypes.h"
+#include "stddef.h"
+#include "utils.h"
+
+/* Hexadecimal digits of uint32_t without prefix */
+#define UTILS_HEX_MAX_DIGITS            8
+
+#define UTILS_FLOAT_EXPONENT_BIAS       127
+#define UTILS_FLOAT_SIGN_POSITION       31
+#define UTILS_FLOAT_SIGN_MASK           0x80000000
+#define UTILS_FLOAT_EXPONENT_POSITION   23
+#define UTILS_FLOAT_EXPONENT_MASK       0x7F800000
+#define UTILS_FLOAT_EXPONENT_MAX        0xFF
+#define UTILS_FLOAT_FRACTION_POSITION   0
+#define UTILS_FLOAT_FRACTION_MASK       0x007FFFFF
+#define UTILS_FLOAT_FRACTION_BITS       23
+
+#define UTILS_FLOAT_GET_SIGN(fp)        (fp & UTILS_FLOAT_SIGN_MASK)\
+                                        >> UTILS_FLOAT_SIGN_POSITION
+#define UTILS_FLOAT_GET_EXPONENT(fp)    (fp & UTILS_FLOAT_EXPONENT_MASK)\
+                                        >> UTILS_FLOAT_EXPONENT_POSITION
+#define UTILS_FLOAT_GET_FRACTION(fp)    (fp & UTILS_FLOAT_FRACTION_MASK)\
+                                        >> UTILS_FLOAT_FRACTION_POSITION
+
+/* Count leading zero bits, 'value' must not be 0 */
+static inline uint32_t utilsCountLeadingZeros32(uint32_t value)
+{
+#if defined(__GNUC__)
+	return __builtin_clz(value);
+#else
+	uint32_t zeros = 0;
+	while((value & 0x80000000u) == 0)
+	{
+		value <<= 1;
+		zeros++;
+	}
+	return zeros;
+#endif
+}
+
+static inline uint32_t utilsCountLeadingZeros64(uint64_t value)
+{
+#if defined(__GNUC__)
+	return __builtin_clzll(value);
+#else
+	uint32_t high = (uint32_t)(value >> 32);
+	return high ? utilsCountLeadingZeros32(high) :
+	              32 + utilsCountLeadingZeros32((uint32_t)value);
+#endif
+}
+
+/* Count trailing zero bits, 'value' must not be 0 */
+static inline uint32_t utilsCountTrailingZeros64(uint64_t value)
+{
+#if defined(__GNUC__)
+	return __builtin_ctzll(value);
+#else
+	uint32_t zeros = 0;
+	while((value & 1) == 0)
+	{
+		value >>= 1;
+		zeros++;
+	}
+	return zeros;
+#endif
+}
+
+/* Number of decimal digits of unsigned value, 1 for zero */
+uint8_t utilsGetNumberOfDecimalDigits(uint32_t number);
+uint8_t utilsGetNumberOfDecimalDigits64(uint64_t number);
+
+/* Value of eight ASCII digits, the first digit in the lowest byte */
+uint32_t utilsParseEightDigits(uint64_t chunk);
+
+/* Value of up to 16 ASCII digits, returns 0 if there is not a digit */
+uint8_t utilsParseDecimalDigits(const char* digits, uint32_t count,
+                                uint64_t* value);
+
+/* Write decimal digits of 'number' backwards, ending just before 'end' */
+void utilsWriteDecimalDigits(uint32_t number, char* end);
+void utilsWriteDecimalDigits64(uint64_t number, char* end);
+
+/* Write 'digits' nibbles of 'number' backwards, ending just before 'end'.
+ * Letters start from 'letterA', 'a' or 'A' */
+void utilsWriteHexDigits(uint64_t number, uint8_t digits, char* end,
+                         char letterA);
+
+/* Uppercase hex digits of nibble and of byte (two characters per byte), only
+ * in tables of profile, see UTILS_HEX_IMPL */
+#if UTILS_HEX_IMPL != UTILS_IMPL_LOOP
+extern const char utilsHexNibbles[];
+#endif
+#if UTILS_HEX_IMPL == UTILS_IMPL_TABLE
+extern const char utilsHexBytes[];
+#endif
+
+/* Two uppercase hex digits of 'byte' */
+static inline void utilsWriteHexByte(uint8_t byte, char* hex)
+{
+#if UTILS_HEX_IMPL == UTILS_IMPL_TABLE
+	hex[0] = utilsHexBytes[2 * byte];
+	hex[1] = utilsHexBytes[2 * byte + 1];
+#elif UTILS_HEX_IMPL == UTILS_IMPL_NIBBLE
+	hex[0] = utilsHexNibbles[byte >> 4];
+	hex[1] = utilsHexNibbles[byte & 0x0F];
+#else
+	uint8_t high = byte >> 4;
+	uint8_t low = byte & 0x0F;
+	hex[0] = (char)(high + (high <= 9 ? '0' : 'A' - 10));
+	hex[1] = (char)(low + (low <= 9 ? '0' : 'A' - 10));
+#endif
+}
+
+/* Value of hex character or 0xFF if the character is not a hex digit */
+static inline uint8_t utilsHexNibbleValue(char hex)
+{
+	uint8_t digit = (uint8_t)hex - '0';
+	uint8_t letter = ((uint8_t)hex | 0x20) - 'a';
+	if(digit < 10)  return digit;
+	if(letter < 6)  return letter + 10;
+	return 0xFF;
+}
+
+/* Place for 'count' characters at the cursor of writer, NULL when they do
+ * not fit. The overflow is sticky, nothing is written after the first one */
+static inline char* utilsWriterReserve(UTILS_WRITER* writer, uint64_t count)
+{
+	if(writer->overflow || count > writer->capacity - writer->cursor)
+	{
+		writer->overflow = 1;
+		return NULL;
+	}
+	return &writer->buffer[writer->cursor];
+}
+
+/* Shortest float string, see UTILS_Float2AsciiShortest(), without NULL */
+uint8_t utilsFloat2Shortest(float fp, UTILS_FLOAT_NOTATION notation, char* string);
+
+/* Fixed-point string, see UTILS_Fixed2AsciiString(), without NULL */
+UTILS_ERROR utilsFixed2Ascii(int32_t value, uint16_t format, uint8_t decimals,
+                             char* ascii, uint32_t* written);
+
+#endif /* SRC_UTILS_PRIVATE_H_ */
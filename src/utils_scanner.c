@@ -0,0 +1,296 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ * @copyrights Copyrights 2019 Stanislaw Pietrzak. All rights reserved.
+ * @file utils_scanner.c
+ * @author Stanislaw Pietrzak
+ * @email integralzerox@gmail.com
+ * @date 16 October 2026
+ * @brief Scanner of numbers in text lines
+ *
+ * Lines of text protocols (AT command responses, NMEA sentences) are parsed
+ * where they are received. The scanner keeps a cursor over the characters
+ * and every operation reads at most up to the end of the line, so fields do
+ * not have to be copied to a NULL terminated buffer before conversion.
+ * A failed operation leaves the cursor where it was.
+ *
+ * @see https://github.com/Dev4Embedded/
+ */
+
+#include "stddef.h"
+#include "string.h"
+#include "utils.h"
+#include "utils_private.h"
+
+/* Number of decimal digits from 'pos' */
+static uint32_t countDigits(const UTILS_SCANNER* scanner, uint32_t pos)
+{
+	uint32_t begin = pos;
+	while(pos < scanner->length &&
+	      (uint8_t)(scanner->buffer[pos] - '0') < 10)
+	{
+		pos++;
+	}
+	return pos - begin;
+}
+
+/* Move cursor by 'count' characters of the parsed field */
+static void consume(UTILS_SCANNER* scanner, uint32_t count, uint32_t* consumed)
+{
+	scanner->cursor += count;
+	if(consumed != NULL)
+	{
+		*consumed = count;
+	}
+}
+
+/**
+ * @brief    Initialize scanner of characters
+ *
+ * The characters are not copied, so the buffer must not change while it is
+ * scanned. It is read only up to 'length' and does not need NULL.
+ *
+ * @param[out]   scanner:    scanner to initialize
+ * @param[in]    buffer:     characters to scan
+ * @param[in]    length:     number of characters
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to scanner or buffer is NULL
+ *     ERROR_SUCCESS             - scanner is ready
+ */
+UTILS_ERROR UTILS_ScannerInit(UTILS_SCANNER* scanner, const char* buffer,
+                              uint32_t length)
+{
+	if(scanner == NULL || buffer == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	scanner->buffer = buffer;
+	scanner->length = length;
+	scanner->cursor = 0;
+	return ERROR_SUCCESS;
+}
+
+/**
+ * @brief    Parse decimal integer at the cursor
+ *
+ * The integer can start with '+' or '-' sign and ends at the first character
+ * which is not a digit. Whitespaces are not skipped.
+ *
+ * @param[in,out] scanner:   scanner of characters
+ * @param[out]   integer:    parsed value
+ * @param[out]   consumed:   number of characters of the integer, can be NULL
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to scanner or integer is NULL
+ *     ERROR_CONVERSION_FAIL     - there is no digit at the cursor or value
+ *                                 is out of range of int32_t
+ *     ERROR_SUCCESS             - integer is parsed
+ */
+UTILS_ERROR UTILS_ScannerNextInt(UTILS_SCANNER* scanner, int32_t* integer,
+                                 uint32_t* consumed)
+{
+	if(scanner == NULL || integer == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	uint32_t pos = scanner->cursor;
+	uint8_t isNegative = 0;
+	if(pos < scanner->length &&
+	   (scanner->buffer[pos] == '-' || scanner->buffer[pos] == '+'))
+	{
+		isNegative = (scanner->buffer[pos] == '-');
+		pos++;
+	}
+	uint32_t count = countDigits(scanner, pos);
+	if(count == 0)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	uint32_t end = pos + count;
+	while(pos < end - 1 && scanner->buffer[pos] == '0')
+	{
+		pos++;
+	}
+	if(end - pos > UTILS_INT_MAX_DIGITS)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	uint64_t value;
+	utilsParseDecimalDigits(&scanner->buffer[pos], end - pos, &value);
+	if(value > (uint64_t)INT32_MAX + isNegative)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	*integer = isNegative ? (int32_t)(0u - (uint32_t)value) : (int32_t)value;
+	consume(scanner, end - scanner->cursor, consumed);
+	return ERROR_SUCCESS;
+}
+
+/**
+ * @brief    Parse hexadecimal integer at the cursor
+ *
+ * The integer can start with "0x" or "0X" prefix and ends at the first
+ * character which is not a hexadecimal digit. Leading zeros are skipped,
+ * so only significant digits are limited to eight.
+ *
+ * @param[in,out] scanner:   scanner of characters
+ * @param[out]   integer:    parsed value
+ * @param[out]   consumed:   number of characters of the integer, can be NULL
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to scanner or integer is NULL
+ *     ERROR_CONVERSION_FAIL     - there is no digit at the cursor or value
+ *                                 is out of range of uint32_t
+ *     ERROR_SUCCESS             - integer is parsed
+ */
+UTILS_ERROR UTILS_ScannerNextHex(UTILS_SCANNER* scanner, uint32_t* integer,
+                                 uint32_t* consumed)
+{
+	if(scanner == NULL || integer == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	const char* buffer = scanner->buffer;
+	uint32_t pos = scanner->cursor;
+	if(scanner->length - pos > 2 && buffer[pos] == '0' &&
+	   (buffer[pos + 1] | 0x20) == 'x' &&
+	   utilsHexNibbleValue(buffer[pos + 2]) < 16)
+	{
+		pos += 2;
+	}
+	if(pos == scanner->length || utilsHexNibbleValue(buffer[pos]) >= 16)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	while(pos < scanner->length - 1 && buffer[pos] == '0' &&
+	      utilsHexNibbleValue(buffer[pos + 1]) < 16)
+	{
+		pos++;
+	}
+	uint32_t value = 0;
+	uint8_t nibble;
+	for(uint32_t digits = 0; pos < scanner->length &&
+	    (nibble = utilsHexNibbleValue(buffer[pos])) < 16; digits++, pos++)
+	{
+		if(digits == UTILS_HEX_MAX_DIGITS)
+		{
+			return ERROR_CONVERSION_FAIL;
+		}
+		value = (value << 4) | nibble;
+	}
+	*integer = value;
+	consume(scanner, pos - scanner->cursor, consumed);
+	return ERROR_SUCCESS;
+}
+
+/**
+ * @brief    Parse decimal floating point number at the cursor
+ *
+ * The number has the format of UTILS_AsciiString2Float() and it is read
+ * only up to the end of scanner.
+ *
+ * @param[in,out] scanner:   scanner of characters
+ * @param[out]   fp:         parsed value
+ * @param[out]   consumed:   number of characters of the number, can be NULL
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to scanner or fp is NULL
+ *     ERROR_CONVERSION_FAIL     - there is no number at the cursor
+ *     ERROR_SUCCESS             - number is parsed
+ */
+UTILS_ERROR UTILS_ScannerNextFloat(UTILS_SCANNER* scanner, float* fp,
+                                   uint32_t* consumed)
+{
+	if(scanner == NULL || fp == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	uint32_t count;
+	UTILS_ERROR error = UTILS_AsciiString2Float(&scanner->buffer[scanner->cursor],
+	                                            scanner->length - scanner->cursor,
+	                                            fp, &count);
+	if(error != ERROR_SUCCESS)
+	{
+		return error;
+	}
+	consume(scanner, count, consumed);
+	return ERROR_SUCCESS;
+}
+
+/**
+ * @brief    Move the cursor to the next 'delimiter' character
+ *
+ * The delimiter itself is not consumed, so it can be checked with
+ * UTILS_ScannerExpect(). Skipping a field of "a,b,c" is SkipUntil(',')
+ * and Expect(",").
+ *
+ * @param[in,out] scanner:   scanner of characters
+ * @param[in]    delimiter:  character to find
+ * @param[out]   consumed:   number of skipped characters, can be NULL
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to scanner is NULL
+ *     ERROR_CONVERSION_FAIL     - there is no delimiter up to the end,
+ *                                 the cursor is not moved
+ *     ERROR_SUCCESS             - cursor is at the delimiter
+ */
+UTILS_ERROR UTILS_ScannerSkipUntil(UTILS_SCANNER* scanner, char delimiter,
+                                   uint32_t* consumed)
+{
+	if(scanner == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	const char* begin = &scanner->buffer[scanner->cursor];
+	const char* found = memchr(begin, delimiter,
+	                           scanner->length - scanner->cursor);
+	if(found == NULL)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	consume(scanner, (uint32_t)(found - begin), consumed);
+	return ERROR_SUCCESS;
+}
+
+/**
+ * @brief    Consume expected text at the cursor
+ *
+ * @param[in,out] scanner:   scanner of characters
+ * @param[in]    text:       NULL terminated text which must be at the cursor
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to scanner or text is NULL
+ *     ERROR_CONVERSION_FAIL     - characters at the cursor are different,
+ *                                 the cursor is not moved
+ *     ERROR_SUCCESS             - text is consumed
+ */
+UTILS_ERROR UTILS_ScannerExpect(UTILS_SCANNER* scanner, const char* text)
+{
+	if(scanner == NULL || text == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	uint32_t pos = scanner->cursor;
+	for(; *text != 0x00; text++, pos++)
+	{
+		if(pos == scanner->length || scanner->buffer[pos] != *text)
+		{
+			return ERROR_CONVERSION_FAIL;
+		}
+	}
+	scanner->cursor = pos;
+	return ERROR_SUCCESS;
+}
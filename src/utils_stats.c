@@ -0,0 +1,280 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ * @copyrights Copyrights 2019 Stanislaw Pietrzak. All rights reserved.
+ * @file utils_stats.c
+ * @author Stanislaw Pietrzak
+ * @email integralzerox@gmail.com
+ * @date 16 October 2026
+ * @brief Optional call statistics of the library
+ *
+ * Built with UTILS_STATS, every thread gets its own block of counters on
+ * the first instrumented call. The block is put on a list which is only
+ * read by UTILS_StatsSnapshot() and UTILS_StatsReset(). When the thread
+ * exits, its block is released with its counters and the next new thread
+ * takes it over, so calls of finished threads are still counted and the
+ * memory is bounded by the highest number of threads at once. The owner
+ * thread is the only writer of its counters, so they are updated with plain
+ * (relaxed atomic) loads and stores instead of locked instructions.
+ * Without UTILS_STATS only the empty API is built.
+ *
+ * @see https://github.com/Dev4Embedded/
+ */
+
+#include "stddef.h"
+#include "string.h"
+#include "utils.h"
+
+#if defined(UTILS_STATS)
+#include "pthread.h"
+#include "stdatomic.h"
+#include "stdlib.h"
+#include "time.h"
+#include "utils_cpu.h"
+#include "utils_private.h"
+
+/* Blocks start and end on a cache line boundary, so counters of different
+ * threads are never on the same line */
+#define STATS_CACHE_LINE        64
+
+typedef struct UTILS_StatsBlock
+{
+	_Alignas(STATS_CACHE_LINE) _Atomic uint64_t calls[UTILS_STATS_FUNCTIONS];
+	_Atomic uint64_t errors[UTILS_STATS_FUNCTIONS][UTILS_STATS_ERRORS];
+	_Atomic uint64_t latency[UTILS_STATS_FUNCTIONS][UTILS_STATS_LATENCY_BUCKETS];
+	struct UTILS_StatsBlock* next;
+	atomic_flag owned;
+}UTILS_StatsBlock;
+
+static _Thread_local UTILS_StatsBlock* threadBlock;
+static UTILS_StatsBlock* _Atomic blocks;
+static pthread_key_t blockKey;
+static pthread_once_t blockKeyOnce = PTHREAD_ONCE_INIT;
+
+/* Destructor of key, the block of exiting thread is free to take over */
+static void releaseBlock(void* block)
+{
+	atomic_flag_clear_explicit(&((UTILS_StatsBlock*)block)->owned,
+	                           memory_order_release);
+}
+
+static void createBlockKey(void)
+{
+	pthread_key_create(&blockKey, releaseBlock);
+}
+
+static uint64_t readCycles(void)
+{
+#if UTILS_X86
+	return __rdtsc();
+#else
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+static UTILS_StatsBlock* getThreadBlock(void)
+{
+	if(threadBlock == NULL)
+	{
+		UTILS_StatsBlock* block = atomic_load_explicit(&blocks,
+		                                               memory_order_acquire);
+		while(block != NULL &&
+		      atomic_flag_test_and_set_explicit(&block->owned,
+		                                        memory_order_acquire))
+		{
+			block = block->next;
+		}
+		if(block == NULL)
+		{
+			/* Size of aligned struct is a multiple of its alignment */
+			block = aligned_alloc(STATS_CACHE_LINE, sizeof(*block));
+			if(block == NULL)
+			{
+				return NULL;
+			}
+			memset(block, 0, sizeof(*block));
+			atomic_flag_test_and_set_explicit(&block->owned,
+			                                  memory_order_relaxed);
+			block->next = atomic_load_explicit(&blocks, memory_order_relaxed);
+			while(!atomic_compare_exchange_weak_explicit(&blocks, &block->next,
+			                                             block,
+			                                             memory_order_release,
+			                                             memory_order_relaxed));
+		}
+		pthread_once(&blockKeyOnce, createBlockKey);
+		pthread_setspecific(blockKey, block);
+		threadBlock = block;
+	}
+	return threadBlock;
+}
+
+/* Single writer: load and store, no read-modify-write instruction */
+static void increment(_Atomic uint64_t* counter)
+{
+	atomic_store_explicit(counter,
+	                      atomic_load_explicit(counter, memory_order_relaxed) + 1,
+	                      memory_order_relaxed);
+}
+
+static uint32_t getLatencyBucket(uint64_t cycles)
+{
+	uint32_t bucket = cycles ? 63 - utilsCountLeadingZeros64(cycles) : 0;
+	return (bucket < UTILS_STATS_LATENCY_BUCKETS) ?
+	       bucket : UTILS_STATS_LATENCY_BUCKETS - 1;
+}
+#endif
+
+/**
+ * @brief    Start measurement of instrumented call
+ *
+ * @return   Current value of cycle counter (or 0 without UTILS_STATS)
+ */
+uint64_t UTILS_StatsBegin(void)
+{
+#if defined(UTILS_STATS)
+	return readCycles();
+#else
+	return 0;
+#endif
+}
+
+/**
+ * @brief    Count instrumented call of 'function' which returned 'error'
+ *
+ * @param[in]    function:    instrumented function
+ * @param[in]    begin:       value returned by UTILS_StatsBegin()
+ * @param[in]    error:       value returned by the function
+ *
+ * @return   The 'error' value
+ */
+UTILS_ERROR UTILS_StatsEnd(UTILS_STATS_FUNCTION function, uint64_t begin,
+                           UTILS_ERROR error)
+{
+#if defined(UTILS_STATS)
+	uint64_t cycles = readCycles() - begin;
+	UTILS_StatsBlock* block = getThreadBlock();
+	if(block != NULL && (uint32_t)function < UTILS_STATS_FUNCTIONS)
+	{
+		increment(&block->calls[function]);
+		if((uint32_t)error < UTILS_STATS_ERRORS)
+		{
+			increment(&block->errors[function][error]);
+		}
+		increment(&block->latency[function][getLatencyBucket(cycles)]);
+	}
+#else
+	(void)function;
+	(void)begin;
+#endif
+	return error;
+}
+
+/**
+ * @brief    Get sum of statistics of all threads
+ *
+ * Statistics are gathered only when the library and the code which calls it
+ * are built with UTILS_STATS defined, e.g. "make STATS=1". Every thread
+ * counts its own calls, so instrumentation does not share cache lines
+ * between threads. Calls made inside the library are not counted.
+ *
+ * @param[out]   stats:    number of calls, returned errors and latency
+ *                         histogram of every function
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to stats is NULL
+ *     ERROR_FAIL                - library is built without UTILS_STATS,
+ *                                 all statistics are set to 0
+ *     ERROR_SUCCESS             - function executed without errors
+ */
+UTILS_ERROR UTILS_StatsSnapshot(UTILS_STATS_SNAPSHOT* stats)
+{
+	if(stats == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	memset(stats, 0, sizeof(*stats));
+#if defined(UTILS_STATS)
+	UTILS_StatsBlock* block = atomic_load_explicit(&blocks,
+	                                               memory_order_acquire);
+	for(; block != NULL; block = block->next)
+	{
+		for(uint32_t function = 0; function < UTILS_STATS_FUNCTIONS; function++)
+		{
+			stats->calls[function] += atomic_load_explicit(
+			                              &block->calls[function],
+			                              memory_order_relaxed);
+			for(uint32_t error = 0; error < UTILS_STATS_ERRORS; error++)
+			{
+				stats->errors[function][error] += atomic_load_explicit(
+				                                      &block->errors[function][error],
+				                                      memory_order_relaxed);
+			}
+			for(uint32_t bucket = 0; bucket < UTILS_STATS_LATENCY_BUCKETS;
+			    bucket++)
+			{
+				stats->latency[function][bucket] += atomic_load_explicit(
+				                                        &block->latency[function][bucket],
+				                                        memory_order_relaxed);
+			}
+		}
+	}
+	return ERROR_SUCCESS;
+#else
+	return ERROR_FAIL;
+#endif
+}
+
+/**
+ * @brief    Set statistics of all threads to 0
+ *
+ * Calls which run in other threads during reset may be counted or not.
+ * Counters are not locked, so an increment which read a counter before it
+ * was cleared can store its old value plus one after the reset.
+ *
+ * @return Utils error:
+ *     ERROR_FAIL                - library is built without UTILS_STATS
+ *     ERROR_SUCCESS             - function executed without errors
+ */
+UTILS_ERROR UTILS_StatsReset(void)
+{
+#if defined(UTILS_STATS)
+	UTILS_StatsBlock* block = atomic_load_explicit(&blocks,
+	                                               memory_order_acquire);
+	for(; block != NULL; block = block->next)
+	{
+		for(uint32_t function = 0; function < UTILS_STATS_FUNCTIONS; function++)
+		{
+			atomic_store_explicit(&block->calls[function], 0,
+			                      memory_order_relaxed);
+			for(uint32_t error = 0; error < UTILS_STATS_ERRORS; error++)
+			{
+				atomic_store_explicit(&block->errors[function][error], 0,
+				                      memory_order_relaxed);
+			}
+			for(uint32_t bucket = 0; bucket < UTILS_STATS_LATENCY_BUCKETS;
+			    bucket++)
+			{
+				atomic_store_explicit(&block->latency[function][bucket], 0,
+				                      memory_order_relaxed);
+			}
+		}
+	}
+	return ERROR_SUCCESS;
+#else
+	return ERROR_FAIL;
+#endif
+}
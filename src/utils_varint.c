@@ -0,0 +1,1009 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ * @copyrights Copyrights 2019 Stanislaw Pietrzak. All rights reserved.
+ * @file utils_varint.c
+ * @author Stanislaw Pietrzak
+ * @email integralzerox@gmail.com
+ * @date 16 October 2026
+ * @brief Varint (LEB128) and zigzag codecs of 32 and 64-bit values
+ *
+ * A varint keeps 7 bits of the value per byte, least significant first, and
+ * the top bit of every byte but the last is set. Values below 128 take one
+ * byte and values below 16384 take two. Signed values are zigzag mapped
+ * first (0, -1, 1, -2 ... to 0, 1, 2, 3 ...), so small negative deltas are
+ * short too.
+ *
+ * On x86 with SSSE3 arrays are decoded in the masked VByte way. The top
+ * bits of up to 64 bytes are gathered with movemask first. 16 bytes without
+ * any set bit are 16 values, otherwise the bits of next 8 bytes select
+ * a pattern which moves up to four values of one to three bytes to 32-bit
+ * lanes with one pshufb. Values of four or more bytes take their lengths
+ * from the mask and are gathered from one 8-byte load, so no byte has its
+ * own branch.
+ *
+ * @see https://github.com/Dev4Embedded/
+ */
+
+#include "stddef.h"
+#include "string.h"
+#include "utils.h"
+#include "utils_private.h"
+#include "utils_cpu.h"
+
+#define VARINT_CONTINUATION     0x80
+#define VARINT_PAYLOAD_MASK     0x7F
+#define VARINT_PAYLOAD_BITS     7
+
+static uint32_t zigzag32(int32_t value)
+{
+	return ((uint32_t)value << 1) ^ (0u - ((uint32_t)value >> 31));
+}
+
+static uint64_t zigzag64(int64_t value)
+{
+	return ((uint64_t)value << 1) ^ (0u - ((uint64_t)value >> 63));
+}
+
+static int64_t unzigzag64(uint64_t value)
+{
+	return (int64_t)((value >> 1) ^ (0u - (value & 1)));
+}
+
+static uint32_t encodedSize(uint64_t value)
+{
+	return 1 + (63 - utilsCountLeadingZeros64(value | 1)) / VARINT_PAYLOAD_BITS;
+}
+
+/* 'bytes' has room for encodedSize() of 'value' */
+static uint32_t encode(uint64_t value, uint8_t* bytes)
+{
+	uint32_t size = 0;
+	while(value >= VARINT_CONTINUATION)
+	{
+		bytes[size++] = (uint8_t)value | VARINT_CONTINUATION;
+		value >>= VARINT_PAYLOAD_BITS;
+	}
+	bytes[size++] = (uint8_t)value;
+	return size;
+}
+
+/* Bytes of value of 'width' bytes, 0 if it is not terminated in 'size'
+ * bytes or it does not fit */
+static uint32_t decode(const uint8_t* bytes, uint32_t size, uint32_t width,
+                       uint64_t* value)
+{
+	const uint32_t maxBytes = width == sizeof(uint32_t) ? UTILS_VARINT32_MAX_SIZE :
+	                                                      UTILS_VARINT64_MAX_SIZE;
+	uint64_t result = 0;
+	if(size > maxBytes)
+	{
+		size = maxBytes;
+	}
+	for(uint32_t pos = 0; pos < size; pos++)
+	{
+		result |= (uint64_t)(bytes[pos] & VARINT_PAYLOAD_MASK) << (VARINT_PAYLOAD_BITS * pos);
+		if(bytes[pos] < VARINT_CONTINUATION)
+		{
+			/* Bits above the width in the last byte */
+			if((width == sizeof(uint32_t) && result > UINT32_MAX) ||
+			   (pos == UTILS_VARINT64_MAX_SIZE - 1 && bytes[pos] > 1))
+			{
+				return 0;
+			}
+			*value = result;
+			return pos + 1;
+		}
+	}
+	return 0;
+}
+
+static inline uint64_t loadValue(const void* values, uint32_t index, uint32_t width,
+                          uint8_t zigzag)
+{
+	if(width == sizeof(uint32_t))
+	{
+		return zigzag ? zigzag32(((const int32_t*)values)[index]) :
+		                ((const uint32_t*)values)[index];
+	}
+	return zigzag ? zigzag64(((const int64_t*)values)[index]) :
+	                ((const uint64_t*)values)[index];
+}
+
+/* Zigzag decoding of 32-bit value is the same on low 32 bits */
+static inline void storeValue(void* values, uint32_t index, uint32_t width,
+                       uint8_t zigzag, uint64_t value)
+{
+	if(zigzag)
+	{
+		value = (uint64_t)unzigzag64(value);
+	}
+	if(width == sizeof(uint32_t))
+	{
+		((uint32_t*)values)[index] = (uint32_t)value;
+	}
+	else
+	{
+		((uint64_t*)values)[index] = value;
+	}
+}
+
+static inline UTILS_ERROR encodeArray(const void* values, uint32_t count,
+                               uint32_t width, uint8_t zigzag,
+                               uint8_t* bytes, uint32_t size, uint32_t* written)
+{
+	if(values == NULL || bytes == NULL || written == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	uint32_t pos = 0;
+	for(uint32_t index = 0; index < count; index++)
+	{
+		uint64_t value = loadValue(values, index, width, zigzag);
+		/* Sizes are checked only near the end of buffer */
+		if(size - pos < UTILS_VARINT64_MAX_SIZE && size - pos < encodedSize(value))
+		{
+			return ERROR_CONVERSION_FAIL;
+		}
+		pos += encode(value, &bytes[pos]);
+	}
+	*written = pos;
+	return ERROR_SUCCESS;
+}
+
+#if UTILS_X86
+typedef struct
+{
+	uint8_t shuffle[16];    /* bytes of value 'n' to 32-bit lane 'n' */
+	uint8_t count;          /* leading values of one to three bytes, up to 4 */
+	uint8_t consumed;       /* bytes of these values */
+}VarintPattern;
+
+/* Pattern of every combination of top bits of 8 bytes, 0x80 clears a byte */
+static const VarintPattern patterns[256] =
+{
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80}, 4, 4},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80}, 4, 5},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80}, 4, 5},
+	{{0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80}, 4, 6},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80}, 4, 5},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80}, 4, 6},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80}, 4, 6},
+	{{0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 0, 0},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80}, 4, 5},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80}, 4, 6},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80}, 4, 6},
+	{{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80}, 4, 7},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x80, 0x80, 0x80}, 4, 6},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x80, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80}, 4, 7},
+	{{0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 1, 1},
+	{{0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 0, 0},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80}, 4, 4},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80}, 4, 6},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80}, 4, 6},
+	{{0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80}, 4, 7},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80}, 4, 6},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80}, 4, 7},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x05, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80}, 4, 7},
+	{{0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 0, 0},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x05, 0x80}, 4, 6},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x80, 0x80, 0x80}, 4, 7},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x80, 0x80, 0x80}, 4, 7},
+	{{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x80, 0x80, 0x80, 0x07, 0x80, 0x80, 0x80}, 4, 8},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 2, 2},
+	{{0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 1, 2},
+	{{0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 1, 1},
+	{{0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 0, 0},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80}, 4, 4},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80}, 4, 5},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80}, 4, 5},
+	{{0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80}, 4, 7},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80}, 4, 5},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80}, 4, 7},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80}, 4, 7},
+	{{0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 0, 0},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80}, 4, 5},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80}, 4, 7},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80}, 4, 7},
+	{{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80, 0x07, 0x80, 0x80, 0x80}, 4, 8},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x06, 0x80, 0x80}, 4, 7},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x06, 0x80, 0x80, 0x07, 0x80, 0x80, 0x80}, 4, 8},
+	{{0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 1, 1},
+	{{0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 0, 0},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80}, 4, 4},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x06, 0x80}, 4, 7},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x06, 0x80}, 4, 7},
+	{{0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x06, 0x80, 0x07, 0x80, 0x80, 0x80}, 4, 8},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x06, 0x80}, 4, 7},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x06, 0x80, 0x07, 0x80, 0x80, 0x80}, 4, 8},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x05, 0x06, 0x80, 0x07, 0x80, 0x80, 0x80}, 4, 8},
+	{{0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 0, 0},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 3, 3},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 2, 3},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 2, 3},
+	{{0x00, 0x01, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 1, 3},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 2, 2},
+	{{0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 1, 2},
+	{{0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 1, 1},
+	{{0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 0, 0},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80}, 4, 4},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80}, 4, 5},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80}, 4, 5},
+	{{0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80}, 4, 6},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80}, 4, 5},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80}, 4, 6},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80}, 4, 6},
+	{{0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 0, 0},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80}, 4, 5},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80}, 4, 6},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80}, 4, 6},
+	{{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80, 0x06, 0x07, 0x80, 0x80}, 4, 8},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x80, 0x80, 0x80}, 4, 6},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x80, 0x80, 0x80, 0x06, 0x07, 0x80, 0x80}, 4, 8},
+	{{0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 1, 1},
+	{{0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 0, 0},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80}, 4, 4},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80}, 4, 6},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80}, 4, 6},
+	{{0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80, 0x06, 0x07, 0x80, 0x80}, 4, 8},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80}, 4, 6},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80, 0x06, 0x07, 0x80, 0x80}, 4, 8},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x05, 0x80, 0x80, 0x06, 0x07, 0x80, 0x80}, 4, 8},
+	{{0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 0, 0},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x05, 0x80}, 4, 6},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x07, 0x80, 0x80}, 4, 8},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x07, 0x80, 0x80}, 4, 8},
+	{{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 3, 8},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 2, 2},
+	{{0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 1, 2},
+	{{0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 1, 1},
+	{{0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 0, 0},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80}, 4, 4},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80}, 4, 5},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80}, 4, 5},
+	{{0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x07, 0x80}, 4, 8},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80}, 4, 5},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x07, 0x80}, 4, 8},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x07, 0x80}, 4, 8},
+	{{0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 0, 0},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80}, 4, 5},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x07, 0x80}, 4, 8},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x07, 0x80}, 4, 8},
+	{{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80}, 3, 8},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x06, 0x07, 0x80}, 4, 8},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x06, 0x07, 0x80, 0x80, 0x80, 0x80, 0x80}, 3, 8},
+	{{0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 1, 1},
+	{{0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 0, 0},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80}, 4, 4},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 3, 4},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 3, 4},
+	{{0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 2, 4},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 3, 4},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 2, 4},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 2, 4},
+	{{0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 0, 0},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 3, 3},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 2, 3},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 2, 3},
+	{{0x00, 0x01, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 1, 3},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 2, 2},
+	{{0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 1, 2},
+	{{0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 1, 1},
+	{{0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 0, 0},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80}, 4, 4},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80}, 4, 5},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80}, 4, 5},
+	{{0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80}, 4, 6},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80}, 4, 5},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80}, 4, 6},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80}, 4, 6},
+	{{0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 0, 0},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80}, 4, 5},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80}, 4, 6},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80}, 4, 6},
+	{{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80}, 4, 7},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x80, 0x80, 0x80}, 4, 6},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x80, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80}, 4, 7},
+	{{0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 1, 1},
+	{{0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 0, 0},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80}, 4, 4},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80}, 4, 6},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80}, 4, 6},
+	{{0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80}, 4, 7},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80}, 4, 6},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80}, 4, 7},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x05, 0x80, 0x80, 0x06, 0x80, 0x80, 0x80}, 4, 7},
+	{{0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 0, 0},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x05, 0x80}, 4, 6},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x80, 0x80, 0x80}, 4, 7},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x80, 0x80, 0x80}, 4, 7},
+	{{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x80, 0x06, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 3, 7},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 2, 2},
+	{{0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 1, 2},
+	{{0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 1, 1},
+	{{0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 0, 0},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80}, 4, 4},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80}, 4, 5},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80}, 4, 5},
+	{{0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80}, 4, 7},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80}, 4, 5},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80}, 4, 7},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80}, 4, 7},
+	{{0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 0, 0},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80}, 4, 5},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80}, 4, 7},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80}, 4, 7},
+	{{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x06, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 3, 7},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x06, 0x80, 0x80}, 4, 7},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x06, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 3, 7},
+	{{0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 1, 1},
+	{{0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 0, 0},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80}, 4, 4},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x06, 0x80}, 4, 7},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x06, 0x80}, 4, 7},
+	{{0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x06, 0x80, 0x80, 0x80, 0x80, 0x80}, 3, 7},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x06, 0x80}, 4, 7},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x06, 0x80, 0x80, 0x80, 0x80, 0x80}, 3, 7},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x05, 0x06, 0x80, 0x80, 0x80, 0x80, 0x80}, 3, 7},
+	{{0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 0, 0},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 3, 3},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 2, 3},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 2, 3},
+	{{0x00, 0x01, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 1, 3},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 2, 2},
+	{{0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 1, 2},
+	{{0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 1, 1},
+	{{0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 0, 0},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80}, 4, 4},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80}, 4, 5},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80}, 4, 5},
+	{{0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80}, 4, 6},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80}, 4, 5},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80}, 4, 6},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x80, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80}, 4, 6},
+	{{0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 0, 0},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80}, 4, 5},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80}, 4, 6},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80}, 4, 6},
+	{{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x80, 0x80, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 3, 6},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x80, 0x80, 0x80}, 4, 6},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 3, 6},
+	{{0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 1, 1},
+	{{0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 0, 0},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80}, 4, 4},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80}, 4, 6},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80}, 4, 6},
+	{{0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 3, 6},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80}, 4, 6},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 3, 6},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 3, 6},
+	{{0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 0, 0},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x05, 0x80}, 4, 6},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80}, 3, 6},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x04, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80}, 3, 6},
+	{{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x05, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 2, 6},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 2, 2},
+	{{0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 1, 2},
+	{{0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 1, 1},
+	{{0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 0, 0},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80}, 4, 4},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80}, 4, 5},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80}, 4, 5},
+	{{0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 3, 5},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80}, 4, 5},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 3, 5},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 3, 5},
+	{{0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 0, 0},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80}, 4, 5},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 3, 5},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 3, 5},
+	{{0x00, 0x01, 0x02, 0x80, 0x03, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 2, 5},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80}, 3, 5},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x04, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 2, 5},
+	{{0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 1, 1},
+	{{0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 0, 0},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80}, 4, 4},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 3, 4},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 3, 4},
+	{{0x00, 0x01, 0x02, 0x80, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 2, 4},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 3, 4},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 2, 4},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x03, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 2, 4},
+	{{0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 0, 0},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 3, 3},
+	{{0x00, 0x01, 0x80, 0x80, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 2, 3},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 2, 3},
+	{{0x00, 0x01, 0x02, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 1, 3},
+	{{0x00, 0x80, 0x80, 0x80, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 2, 2},
+	{{0x00, 0x01, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 1, 2},
+	{{0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 1, 1},
+	{{0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80}, 0, 0},
+};
+
+/* Value of varint of 'length' bytes, at most eight. The 7-bit groups are
+ * joined in pairs, 14-bit groups in pairs and then 28-bit groups */
+static inline uint64_t gather(const uint8_t* bytes, uint32_t length)
+{
+	uint64_t word;
+	memcpy(&word, bytes, sizeof(word));
+	word &= (UINT64_MAX >> (64 - 8 * length)) & 0x7F7F7F7F7F7F7F7Full;
+	word = (word & 0x007F007F007F007Full) | ((word & 0x7F007F007F007F00ull) >> 1);
+	word = (word & 0x00003FFF00003FFFull) | ((word & 0x3FFF00003FFF0000ull) >> 2);
+	return (word & 0x000000000FFFFFFFull) | ((word & 0x0FFFFFFF00000000ull) >> 4);
+}
+
+/* Four lanes of one to three bytes to values of 'width' bytes at 'index' */
+UTILS_TARGET("ssse3")
+static inline void storeLanes(void* values, uint32_t index, uint32_t width,
+                       uint8_t zigzag, __m128i lanes)
+{
+	lanes = _mm_or_si128(_mm_or_si128(_mm_and_si128(lanes, _mm_set1_epi32(0x7F)),
+	                                  _mm_and_si128(_mm_srli_epi32(lanes, 1),
+	                                                _mm_set1_epi32(0x3F80))),
+	                     _mm_and_si128(_mm_srli_epi32(lanes, 2), _mm_set1_epi32(0x1FC000)));
+	if(zigzag)
+	{
+		lanes = _mm_xor_si128(_mm_srli_epi32(lanes, 1),
+		                      _mm_sub_epi32(_mm_setzero_si128(),
+		                                    _mm_and_si128(lanes, _mm_set1_epi32(1))));
+	}
+	if(width == sizeof(uint32_t))
+	{
+		_mm_storeu_si128((__m128i*)&((uint32_t*)values)[index], lanes);
+	}
+	else
+	{
+		/* Values have at most 21 bits, so the sign is 0 without zigzag */
+		uint64_t* output = &((uint64_t*)values)[index];
+		__m128i sign = _mm_srai_epi32(lanes, 31);
+		_mm_storeu_si128((__m128i*)output, _mm_unpacklo_epi32(lanes, sign));
+		_mm_storeu_si128((__m128i*)(output + 2), _mm_unpackhi_epi32(lanes, sign));
+	}
+}
+
+/* Values while 16 bytes can be loaded and 16 values stored, returns bytes
+ * of decoded values. The top bits of up to 64 bytes are gathered first, so
+ * the position of next step depends only on the mask and the table. A value
+ * which can not be decoded is left to the scalar decoder, which reports
+ * the error. */
+UTILS_TARGET("ssse3")
+static inline uint32_t decodeSsse3(const uint8_t* bytes, uint32_t size, void* values,
+                            uint32_t count, uint32_t width, uint8_t zigzag,
+                            uint32_t* decoded)
+{
+	const __m128i zero = _mm_setzero_si128();
+	const uint32_t maxGather = width == sizeof(uint32_t) ? UTILS_VARINT32_MAX_SIZE :
+	                                                       sizeof(uint64_t);
+	uint32_t pos = 0;
+	uint32_t index = 0;
+	uint8_t isValid = 1;
+	while(isValid && size - pos >= 16 && count - index >= 16)
+	{
+		/* Every value takes at least one byte, so a window of bytes has room
+		 * for its values */
+		uint32_t window = (size - pos >= 64 && count - index >= 64) ? 64 : 16;
+		uint64_t mask = 0;
+		for(uint32_t block = 0; block < window; block += 16)
+		{
+			__m128i chunk = _mm_loadu_si128((const __m128i*)&bytes[pos + block]);
+			mask |= (uint64_t)(uint32_t)_mm_movemask_epi8(chunk) << block;
+		}
+		/* Last bytes of values, there is none known behind the window */
+		uint64_t ends = ~mask & (UINT64_MAX >> (64 - window));
+		uint32_t offset = 0;
+		do
+		{
+			const uint8_t* step = &bytes[pos + offset];
+			uint32_t bits = (uint32_t)(mask >> offset);
+			const VarintPattern* pattern = &patterns[bits & 0xFF];
+			if((bits & 0xFFFF) == 0)
+			{
+				__m128i chunk = _mm_loadu_si128((const __m128i*)step);
+				__m128i low = _mm_unpacklo_epi8(chunk, zero);
+				__m128i high = _mm_unpackhi_epi8(chunk, zero);
+				storeLanes(values, index, width, zigzag, _mm_unpacklo_epi16(low, zero));
+				storeLanes(values, index + 4, width, zigzag, _mm_unpackhi_epi16(low, zero));
+				storeLanes(values, index + 8, width, zigzag, _mm_unpacklo_epi16(high, zero));
+				storeLanes(values, index + 12, width, zigzag, _mm_unpackhi_epi16(high, zero));
+				index += 16;
+				offset += 16;
+			}
+			else if(pattern->count != 0)
+			{
+				__m128i chunk = _mm_loadu_si128((const __m128i*)step);
+				__m128i shuffle = _mm_loadu_si128((const __m128i*)pattern->shuffle);
+				storeLanes(values, index, width, zigzag, _mm_shuffle_epi8(chunk, shuffle));
+				index += pattern->count;
+				offset += pattern->consumed;
+			}
+			else
+			{
+				/* Values of four or more bytes, their lengths are in the mask */
+				uint64_t rest = ends & (UINT64_MAX << offset);
+				do
+				{
+					uint64_t value;
+					uint32_t length = rest ? utilsCountTrailingZeros64(rest) + 1 - offset : 0;
+					if(length != 0 && length <= maxGather)
+					{
+						value = gather(&bytes[pos + offset], length);
+					}
+					else
+					{
+						length = decode(&bytes[pos + offset], size - pos - offset,
+						                width, &value);
+					}
+					if(length == 0 || (width == sizeof(uint32_t) && value > UINT32_MAX))
+					{
+						isValid = 0;
+						break;
+					}
+					storeValue(values, index++, width, zigzag, value);
+					offset += length;
+					rest &= rest - 1;
+				}while(offset + 16 <= window && ((mask >> offset) & 0x07) == 0x07);
+				if(!isValid)
+				{
+					break;
+				}
+			}
+		}while(offset + 16 <= window);
+		pos += offset;
+	}
+	*decoded = index;
+	return pos;
+}
+#endif
+
+static inline UTILS_ERROR decodeArray(const uint8_t* bytes, uint32_t size,
+                               void* values, uint32_t count, uint32_t width,
+                               uint8_t zigzag, uint32_t* consumed)
+{
+	if(bytes == NULL || values == NULL || consumed == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	uint32_t pos = 0;
+	uint32_t index = 0;
+#if UTILS_X86
+	if(UTILS_CPU_HAS("ssse3"))
+	{
+		pos = decodeSsse3(bytes, size, values, count, width, zigzag, &index);
+	}
+#endif
+	for(; index < count; index++)
+	{
+		uint64_t value;
+		uint32_t length = decode(&bytes[pos], size - pos, width, &value);
+		if(length == 0)
+		{
+			return ERROR_CONVERSION_FAIL;
+		}
+		storeValue(values, index, width, zigzag, value);
+		pos += length;
+	}
+	*consumed = pos;
+	return ERROR_SUCCESS;
+}
+
+static UTILS_ERROR encodeValue(uint64_t value, uint8_t* bytes, uint32_t size,
+                               uint32_t* written)
+{
+	if(bytes == NULL || written == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	if(size < encodedSize(value))
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	*written = encode(value, bytes);
+	return ERROR_SUCCESS;
+}
+
+static UTILS_ERROR decodeValue(const uint8_t* bytes, uint32_t size,
+                               uint32_t width, uint64_t* value,
+                               uint32_t* consumed)
+{
+	if(bytes == NULL || consumed == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	uint32_t length = decode(bytes, size, width, value);
+	if(length == 0)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	*consumed = length;
+	return ERROR_SUCCESS;
+}
+
+/**
+ * @brief    Encode 32-bit value to varint
+ *
+ * @param[in]    value:      value to encode
+ * @param[out]   bytes:      varint of one to UTILS_VARINT32_MAX_SIZE bytes
+ * @param[in]    size:       size of bytes buffer
+ * @param[out]   written:    number of bytes of varint
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to bytes or written is NULL
+ *     ERROR_CONVERSION_FAIL     - bytes buffer is too small
+ *     ERROR_SUCCESS             - value is encoded
+ */
+UTILS_ERROR UTILS_Uint32ToVarint(uint32_t value, uint8_t* bytes, uint32_t size,
+                                 uint32_t* written)
+{
+	return encodeValue(value, bytes, size, written);
+}
+
+/**
+ * @brief    Encode 64-bit value to varint
+ *
+ * @param[in]    value:      value to encode
+ * @param[out]   bytes:      varint of one to UTILS_VARINT64_MAX_SIZE bytes
+ * @param[in]    size:       size of bytes buffer
+ * @param[out]   written:    number of bytes of varint
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to bytes or written is NULL
+ *     ERROR_CONVERSION_FAIL     - bytes buffer is too small
+ *     ERROR_SUCCESS             - value is encoded
+ */
+UTILS_ERROR UTILS_Uint64ToVarint(uint64_t value, uint8_t* bytes, uint32_t size,
+                                 uint32_t* written)
+{
+	return encodeValue(value, bytes, size, written);
+}
+
+/**
+ * @brief    Encode signed 32-bit value to zigzag varint
+ *
+ * @param[in]    value:      value to encode
+ * @param[out]   bytes:      varint of one to UTILS_VARINT32_MAX_SIZE bytes
+ * @param[in]    size:       size of bytes buffer
+ * @param[out]   written:    number of bytes of varint
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to bytes or written is NULL
+ *     ERROR_CONVERSION_FAIL     - bytes buffer is too small
+ *     ERROR_SUCCESS             - value is encoded
+ */
+UTILS_ERROR UTILS_Int32ToVarint(int32_t value, uint8_t* bytes, uint32_t size,
+                                uint32_t* written)
+{
+	return encodeValue(zigzag32(value), bytes, size, written);
+}
+
+/**
+ * @brief    Encode signed 64-bit value to zigzag varint
+ *
+ * @param[in]    value:      value to encode
+ * @param[out]   bytes:      varint of one to UTILS_VARINT64_MAX_SIZE bytes
+ * @param[in]    size:       size of bytes buffer
+ * @param[out]   written:    number of bytes of varint
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to bytes or written is NULL
+ *     ERROR_CONVERSION_FAIL     - bytes buffer is too small
+ *     ERROR_SUCCESS             - value is encoded
+ */
+UTILS_ERROR UTILS_Int64ToVarint(int64_t value, uint8_t* bytes, uint32_t size,
+                                uint32_t* written)
+{
+	return encodeValue(zigzag64(value), bytes, size, written);
+}
+
+/**
+ * @brief    Decode varint to 32-bit value
+ *
+ * @param[in]    bytes:      buffer which starts with varint
+ * @param[in]    size:       number of bytes in buffer
+ * @param[out]   value:      decoded value
+ * @param[out]   consumed:   number of bytes of varint
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to bytes, value or consumed is NULL
+ *     ERROR_CONVERSION_FAIL     - varint does not end in size bytes, is longer
+ *                                 than UTILS_VARINT32_MAX_SIZE or the value
+ *                                 does not fit in 32 bits
+ *     ERROR_SUCCESS             - value is decoded
+ */
+UTILS_ERROR UTILS_VarintToUint32(const uint8_t* bytes, uint32_t size,
+                                 uint32_t* value, uint32_t* consumed)
+{
+	if(value == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	uint64_t result;
+	UTILS_ERROR error = decodeValue(bytes, size, sizeof(uint32_t), &result, consumed);
+	if(error == ERROR_SUCCESS)
+	{
+		*value = (uint32_t)result;
+	}
+	return error;
+}
+
+/**
+ * @brief    Decode varint to 64-bit value
+ *
+ * @param[in]    bytes:      buffer which starts with varint
+ * @param[in]    size:       number of bytes in buffer
+ * @param[out]   value:      decoded value
+ * @param[out]   consumed:   number of bytes of varint
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to bytes, value or consumed is NULL
+ *     ERROR_CONVERSION_FAIL     - varint does not end in size bytes, is longer
+ *                                 than UTILS_VARINT64_MAX_SIZE or the value
+ *                                 does not fit in 64 bits
+ *     ERROR_SUCCESS             - value is decoded
+ */
+UTILS_ERROR UTILS_VarintToUint64(const uint8_t* bytes, uint32_t size,
+                                 uint64_t* value, uint32_t* consumed)
+{
+	if(value == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	return decodeValue(bytes, size, sizeof(uint64_t), value, consumed);
+}
+
+/**
+ * @brief    Decode zigzag varint to signed 32-bit value
+ *
+ * @param[in]    bytes:      buffer which starts with varint
+ * @param[in]    size:       number of bytes in buffer
+ * @param[out]   value:      decoded value
+ * @param[out]   consumed:   number of bytes of varint
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to bytes, value or consumed is NULL
+ *     ERROR_CONVERSION_FAIL     - varint does not end in size bytes, is longer
+ *                                 than UTILS_VARINT32_MAX_SIZE or the value
+ *                                 does not fit in 32 bits
+ *     ERROR_SUCCESS             - value is decoded
+ */
+UTILS_ERROR UTILS_VarintToInt32(const uint8_t* bytes, uint32_t size,
+                                int32_t* value, uint32_t* consumed)
+{
+	if(value == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	uint64_t result;
+	UTILS_ERROR error = decodeValue(bytes, size, sizeof(uint32_t), &result, consumed);
+	if(error == ERROR_SUCCESS)
+	{
+		*value = (int32_t)unzigzag64(result);
+	}
+	return error;
+}
+
+/**
+ * @brief    Decode zigzag varint to signed 64-bit value
+ *
+ * @param[in]    bytes:      buffer which starts with varint
+ * @param[in]    size:       number of bytes in buffer
+ * @param[out]   value:      decoded value
+ * @param[out]   consumed:   number of bytes of varint
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to bytes, value or consumed is NULL
+ *     ERROR_CONVERSION_FAIL     - varint does not end in size bytes, is longer
+ *                                 than UTILS_VARINT64_MAX_SIZE or the value
+ *                                 does not fit in 64 bits
+ *     ERROR_SUCCESS             - value is decoded
+ */
+UTILS_ERROR UTILS_VarintToInt64(const uint8_t* bytes, uint32_t size,
+                                int64_t* value, uint32_t* consumed)
+{
+	if(value == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	uint64_t result;
+	UTILS_ERROR error = decodeValue(bytes, size, sizeof(uint64_t), &result, consumed);
+	if(error == ERROR_SUCCESS)
+	{
+		*value = unzigzag64(result);
+	}
+	return error;
+}
+
+/**
+ * @brief    Encode array of 32-bit values to consecutive varints
+ *
+ * @param[in]    values:     array of values
+ * @param[in]    count:      number of values
+ * @param[out]   bytes:      varints of values
+ * @param[in]    size:       size of bytes buffer
+ * @param[out]   written:    number of bytes of all varints
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to values, bytes or written is NULL
+ *     ERROR_CONVERSION_FAIL     - bytes buffer is too small
+ *     ERROR_SUCCESS             - values are encoded
+ */
+UTILS_ERROR UTILS_Uint32ArrayToVarints(const uint32_t* values, uint32_t count,
+                                       uint8_t* bytes, uint32_t size,
+                                       uint32_t* written)
+{
+	return encodeArray(values, count, sizeof(uint32_t), 0, bytes, size, written);
+}
+
+/**
+ * @brief    Encode array of 64-bit values to consecutive varints
+ *
+ * @param[in]    values:     array of values
+ * @param[in]    count:      number of values
+ * @param[out]   bytes:      varints of values
+ * @param[in]    size:       size of bytes buffer
+ * @param[out]   written:    number of bytes of all varints
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to values, bytes or written is NULL
+ *     ERROR_CONVERSION_FAIL     - bytes buffer is too small
+ *     ERROR_SUCCESS             - values are encoded
+ */
+UTILS_ERROR UTILS_Uint64ArrayToVarints(const uint64_t* values, uint32_t count,
+                                       uint8_t* bytes, uint32_t size,
+                                       uint32_t* written)
+{
+	return encodeArray(values, count, sizeof(uint64_t), 0, bytes, size, written);
+}
+
+/**
+ * @brief    Encode array of signed 32-bit values to consecutive zigzag varints
+ *
+ * @param[in]    values:     array of values
+ * @param[in]    count:      number of values
+ * @param[out]   bytes:      varints of values
+ * @param[in]    size:       size of bytes buffer
+ * @param[out]   written:    number of bytes of all varints
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to values, bytes or written is NULL
+ *     ERROR_CONVERSION_FAIL     - bytes buffer is too small
+ *     ERROR_SUCCESS             - values are encoded
+ */
+UTILS_ERROR UTILS_Int32ArrayToVarints(const int32_t* values, uint32_t count,
+                                      uint8_t* bytes, uint32_t size,
+                                      uint32_t* written)
+{
+	return encodeArray(values, count, sizeof(uint32_t), 1, bytes, size, written);
+}
+
+/**
+ * @brief    Encode array of signed 64-bit values to consecutive zigzag varints
+ *
+ * @param[in]    values:     array of values
+ * @param[in]    count:      number of values
+ * @param[out]   bytes:      varints of values
+ * @param[in]    size:       size of bytes buffer
+ * @param[out]   written:    number of bytes of all varints
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to values, bytes or written is NULL
+ *     ERROR_CONVERSION_FAIL     - bytes buffer is too small
+ *     ERROR_SUCCESS             - values are encoded
+ */
+UTILS_ERROR UTILS_Int64ArrayToVarints(const int64_t* values, uint32_t count,
+                                      uint8_t* bytes, uint32_t size,
+                                      uint32_t* written)
+{
+	return encodeArray(values, count, sizeof(uint64_t), 1, bytes, size, written);
+}
+
+/**
+ * @brief    Decode consecutive varints to array of 32-bit values
+ *
+ * Exactly 'count' values are decoded, bytes after them are not consumed.
+ *
+ * @param[in]    bytes:      varints of values
+ * @param[in]    size:       number of bytes in buffer
+ * @param[out]   values:     decoded values
+ * @param[in]    count:      number of values to decode
+ * @param[out]   consumed:   number of bytes of all varints
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to bytes, values or consumed is NULL
+ *     ERROR_CONVERSION_FAIL     - there are less than count varints in size
+ *                                 bytes or one of them is not valid, see
+ *                                 UTILS_VarintToUint32()
+ *     ERROR_SUCCESS             - values are decoded
+ */
+UTILS_ERROR UTILS_VarintsToUint32Array(const uint8_t* bytes, uint32_t size,
+                                       uint32_t* values, uint32_t count,
+                                       uint32_t* consumed)
+{
+	return decodeArray(bytes, size, values, count, sizeof(uint32_t), 0, consumed);
+}
+
+/**
+ * @brief    Decode consecutive varints to array of 64-bit values
+ *
+ * Exactly 'count' values are decoded, bytes after them are not consumed.
+ *
+ * @param[in]    bytes:      varints of values
+ * @param[in]    size:       number of bytes in buffer
+ * @param[out]   values:     decoded values
+ * @param[in]    count:      number of values to decode
+ * @param[out]   consumed:   number of bytes of all varints
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to bytes, values or consumed is NULL
+ *     ERROR_CONVERSION_FAIL     - there are less than count varints in size
+ *                                 bytes or one of them is not valid, see
+ *                                 UTILS_VarintToUint64()
+ *     ERROR_SUCCESS             - values are decoded
+ */
+UTILS_ERROR UTILS_VarintsToUint64Array(const uint8_t* bytes, uint32_t size,
+                                       uint64_t* values, uint32_t count,
+                                       uint32_t* consumed)
+{
+	return decodeArray(bytes, size, values, count, sizeof(uint64_t), 0, consumed);
+}
+
+/**
+ * @brief    Decode consecutive zigzag varints to array of signed 32-bit values
+ *
+ * Exactly 'count' values are decoded, bytes after them are not consumed.
+ *
+ * @param[in]    bytes:      varints of values
+ * @param[in]    size:       number of bytes in buffer
+ * @param[out]   values:     decoded values
+ * @param[in]    count:      number of values to decode
+ * @param[out]   consumed:   number of bytes of all varints
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to bytes, values or consumed is NULL
+ *     ERROR_CONVERSION_FAIL     - there are less than count varints in size
+ *                                 bytes or one of them is not valid, see
+ *                                 UTILS_VarintToInt32()
+ *     ERROR_SUCCESS             - values are decoded
+ */
+UTILS_ERROR UTILS_VarintsToInt32Array(const uint8_t* bytes, uint32_t size,
+                                      int32_t* values, uint32_t count,
+                                      uint32_t* consumed)
+{
+	return decodeArray(bytes, size, values, count, sizeof(uint32_t), 1, consumed);
+}
+
+/**
+ * @brief    Decode consecutive zigzag varints to array of signed 64-bit values
+ *
+ * Exactly 'count' values are decoded, bytes after them are not consumed.
+ *
+ * @param[in]    bytes:      varints of values
+ * @param[in]    size:       number of bytes in buffer
+ * @param[out]   values:     decoded values
+ * @param[in]    count:      number of values to decode
+ * @param[out]   consumed:   number of bytes of all varints
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to bytes, values or consumed is NULL
+ *     ERROR_CONVERSION_FAIL     - there are less than count varints in size
+ *                                 bytes or one of them is not valid, see
+ *                                 UTILS_VarintToInt64()
+ *     ERROR_SUCCESS             - values are decoded
+ */
+UTILS_ERROR UTILS_VarintsToInt64Array(const uint8_t* bytes, uint32_t size,
+                                      int64_t* values, uint32_t count,
+                                      uint32_t* consumed)
+{
+	return decodeArray(bytes, size, values, count, sizeof(uint64_t), 1, consumed);
+}
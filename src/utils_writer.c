@@ -0,0 +1,583 @@
+/**
+ * @license
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>
+ *
+ * @copyrights Copyrights 2019 Stanislaw Pietrzak. All rights reserved.
+ * @file utils_writer.c
+ * @author Stanislaw Pietrzak
+ * @email integralzerox@gmail.com
+ * @date 16 October 2026
+ * @brief Cursor based output of conversions
+ *
+ * The string conversions of the library set the whole rest of the buffer
+ * to NULL, so composing a line of many fields costs the size of the buffer
+ * per field and the end of the text has to be searched again. The writer
+ * keeps the cursor instead: every append writes exactly its characters and
+ * moves the cursor, so a record of any number of fields is a single pass.
+ *
+ * @see https://github.com/Dev4Embedded/
+ */
+
+#include "stddef.h"
+#include "utils.h"
+#include "utils_private.h"
+
+static uint8_t getNumberOfBits(uint64_t integer)
+{
+	return (uint8_t)(64 - utilsCountLeadingZeros64(integer | 1));
+}
+
+/* Append of a string created in a temporary buffer */
+static UTILS_ERROR appendCopy(UTILS_WRITER* writer, const char* string,
+                              uint32_t count)
+{
+	char* output = utilsWriterReserve(writer, count);
+	if(output == NULL)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	for(uint32_t copy = 0; copy < count; copy++)
+	{
+		output[copy] = string[copy];
+	}
+	writer->cursor += count;
+	return ERROR_SUCCESS;
+}
+
+/**
+ * @brief    Initialize writer of characters to buffer
+ *
+ * @param[out]   writer:     writer to initialize
+ * @param[in]    buffer:     buffer for characters
+ * @param[in]    capacity:   size of buffer
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to writer or buffer is NULL
+ *     ERROR_SUCCESS             - writer is ready
+ */
+UTILS_ERROR UTILS_WriterInit(UTILS_WRITER* writer, char* buffer,
+                             uint32_t capacity)
+{
+	if(writer == NULL || buffer == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	writer->buffer = buffer;
+	writer->capacity = capacity;
+	writer->cursor = 0;
+	writer->overflow = 0;
+	return ERROR_SUCCESS;
+}
+
+/**
+ * @brief    Append one character
+ *
+ * @param[in,out] writer:    writer of characters
+ * @param[in]    character:  character to append
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to writer is NULL
+ *     ERROR_CONVERSION_FAIL     - character does not fit or writer has
+ *                                 overflowed before
+ *     ERROR_SUCCESS             - character is appended
+ */
+UTILS_ERROR UTILS_WriterAppendChar(UTILS_WRITER* writer, char character)
+{
+	if(writer == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	char* output = utilsWriterReserve(writer, 1);
+	if(output == NULL)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	output[0] = character;
+	writer->cursor++;
+	return ERROR_SUCCESS;
+}
+
+/**
+ * @brief    Append characters of string
+ *
+ * Exactly 'length' characters are copied, NULL characters are not searched,
+ * so the string does not need to be terminated.
+ *
+ * @param[in,out] writer:    writer of characters
+ * @param[in]    string:     characters to append
+ * @param[in]    length:     number of characters
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to writer or string is NULL
+ *     ERROR_CONVERSION_FAIL     - string does not fit or writer has
+ *                                 overflowed before
+ *     ERROR_SUCCESS             - string is appended
+ */
+UTILS_ERROR UTILS_WriterAppendString(UTILS_WRITER* writer, const char* string,
+                                     uint32_t length)
+{
+	if(writer == NULL || string == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	return appendCopy(writer, string, length);
+}
+
+/**
+ * @brief    Append decimal digits of integer
+ *
+ * The digits are the same as of UTILS_Int2AsciiString(), with '-' sign for
+ * negative values, but nothing else is written.
+ *
+ * @param[in,out] writer:    writer of characters
+ * @param[in]    integer:    integer value to append
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to writer is NULL
+ *     ERROR_CONVERSION_FAIL     - digits do not fit or writer has
+ *                                 overflowed before
+ *     ERROR_SUCCESS             - digits are appended
+ */
+UTILS_ERROR UTILS_WriterAppendInt(UTILS_WRITER* writer, int32_t integer)
+{
+	if(writer == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	uint32_t magnitude = (integer < 0) ? 0u - (uint32_t)integer :
+	                                     (uint32_t)integer;
+	uint8_t charCounter = utilsGetNumberOfDecimalDigits(magnitude) +
+	                      (integer < 0);
+	char* output = utilsWriterReserve(writer, charCounter);
+	if(output == NULL)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	if(integer < 0)
+	{
+		output[0] = '-';
+	}
+	utilsWriteDecimalDigits(magnitude, &output[charCounter]);
+	writer->cursor += charCounter;
+	return ERROR_SUCCESS;
+}
+
+/**
+ * @brief    Append decimal digits of unsigned integer
+ *
+ * @param[in,out] writer:    writer of characters
+ * @param[in]    integer:    unsigned integer value to append
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to writer is NULL
+ *     ERROR_CONVERSION_FAIL     - digits do not fit or writer has
+ *                                 overflowed before
+ *     ERROR_SUCCESS             - digits are appended
+ */
+UTILS_ERROR UTILS_WriterAppendUint(UTILS_WRITER* writer, uint32_t integer)
+{
+	if(writer == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	uint8_t charCounter = utilsGetNumberOfDecimalDigits(integer);
+	char* output = utilsWriterReserve(writer, charCounter);
+	if(output == NULL)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	utilsWriteDecimalDigits(integer, &output[charCounter]);
+	writer->cursor += charCounter;
+	return ERROR_SUCCESS;
+}
+
+/**
+ * @brief    Append decimal digits of 64-bit integer
+ *
+ * The digits are the same as of UTILS_Int2AsciiString64(), with '-' sign
+ * for negative values, but nothing else is written.
+ *
+ * @param[in,out] writer:    writer of characters
+ * @param[in]    integer:    integer value to append
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to writer is NULL
+ *     ERROR_CONVERSION_FAIL     - digits do not fit or writer has
+ *                                 overflowed before
+ *     ERROR_SUCCESS             - digits are appended
+ */
+UTILS_ERROR UTILS_WriterAppendInt64(UTILS_WRITER* writer, int64_t integer)
+{
+	if(writer == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	uint64_t magnitude = (integer < 0) ? 0u - (uint64_t)integer :
+	                                     (uint64_t)integer;
+	uint8_t charCounter = utilsGetNumberOfDecimalDigits64(magnitude) +
+	                      (integer < 0);
+	char* output = utilsWriterReserve(writer, charCounter);
+	if(output == NULL)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	if(integer < 0)
+	{
+		output[0] = '-';
+	}
+	utilsWriteDecimalDigits64(magnitude, &output[charCounter]);
+	writer->cursor += charCounter;
+	return ERROR_SUCCESS;
+}
+
+/**
+ * @brief    Append decimal digits of unsigned 64-bit integer
+ *
+ * @param[in,out] writer:    writer of characters
+ * @param[in]    integer:    unsigned integer value to append
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to writer is NULL
+ *     ERROR_CONVERSION_FAIL     - digits do not fit or writer has
+ *                                 overflowed before
+ *     ERROR_SUCCESS             - digits are appended
+ */
+UTILS_ERROR UTILS_WriterAppendUint64(UTILS_WRITER* writer, uint64_t integer)
+{
+	if(writer == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	uint8_t charCounter = utilsGetNumberOfDecimalDigits64(integer);
+	char* output = utilsWriterReserve(writer, charCounter);
+	if(output == NULL)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	utilsWriteDecimalDigits64(integer, &output[charCounter]);
+	writer->cursor += charCounter;
+	return ERROR_SUCCESS;
+}
+
+/**
+ * @brief    Append hexadecimal string of integer
+ *
+ * The string is the same as of UTILS_Uint2Hex(): "0x" prefix and the
+ * significant digits, but the rest of the buffer is not set to NULL.
+ *
+ * @param[in,out] writer:    writer of characters
+ * @param[in]    integer:    integer value to append
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to writer is NULL
+ *     ERROR_CONVERSION_FAIL     - string does not fit or writer has
+ *                                 overflowed before
+ *     ERROR_SUCCESS             - string is appended
+ */
+UTILS_ERROR UTILS_WriterAppendHex(UTILS_WRITER* writer, uint32_t integer)
+{
+	if(writer == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	uint8_t charCounter = (uint8_t)(2 + (getNumberOfBits(integer) + 3) / 4);
+	char* output = utilsWriterReserve(writer, charCounter);
+	if(output == NULL)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	UTILS_Uint2Hex(integer, output, charCounter);
+	writer->cursor += charCounter;
+	return ERROR_SUCCESS;
+}
+
+/**
+ * @brief    Append hexadecimal string of 64-bit integer
+ *
+ * The string is the same as of UTILS_Uint2Hex64(): "0x" prefix and the
+ * significant digits, but the rest of the buffer is not set to NULL.
+ *
+ * @param[in,out] writer:    writer of characters
+ * @param[in]    integer:    integer value to append
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to writer is NULL
+ *     ERROR_CONVERSION_FAIL     - string does not fit or writer has
+ *                                 overflowed before
+ *     ERROR_SUCCESS             - string is appended
+ */
+UTILS_ERROR UTILS_WriterAppendHex64(UTILS_WRITER* writer, uint64_t integer)
+{
+	if(writer == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	uint8_t charCounter = (uint8_t)(2 + (getNumberOfBits(integer) + 3) / 4);
+	char* output = utilsWriterReserve(writer, charCounter);
+	if(output == NULL)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	UTILS_Uint2Hex64(integer, output, charCounter);
+	writer->cursor += charCounter;
+	return ERROR_SUCCESS;
+}
+
+/**
+ * @brief    Append binary string of integer
+ *
+ * The string is the same as of UTILS_Uint2Bin(): "0b" prefix and the
+ * significant digits, but the rest of the buffer is not set to NULL.
+ *
+ * @param[in,out] writer:    writer of characters
+ * @param[in]    integer:    integer value to append
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to writer is NULL
+ *     ERROR_CONVERSION_FAIL     - string does not fit or writer has
+ *                                 overflowed before
+ *     ERROR_SUCCESS             - string is appended
+ */
+UTILS_ERROR UTILS_WriterAppendBin(UTILS_WRITER* writer, uint32_t integer)
+{
+	if(writer == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	uint8_t charCounter = (uint8_t)(2 + getNumberOfBits(integer));
+	char* output = utilsWriterReserve(writer, charCounter);
+	if(output == NULL)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	UTILS_Uint2Bin(integer, output, charCounter);
+	writer->cursor += charCounter;
+	return ERROR_SUCCESS;
+}
+
+/**
+ * @brief    Append octal string of integer
+ *
+ * The string is the same as of UTILS_Uint2Oct(): "0o" prefix and the
+ * significant digits, but the rest of the buffer is not set to NULL.
+ *
+ * @param[in,out] writer:    writer of characters
+ * @param[in]    integer:    integer value to append
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to writer is NULL
+ *     ERROR_CONVERSION_FAIL     - string does not fit or writer has
+ *                                 overflowed before
+ *     ERROR_SUCCESS             - string is appended
+ */
+UTILS_ERROR UTILS_WriterAppendOct(UTILS_WRITER* writer, uint32_t integer)
+{
+	if(writer == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	uint8_t charCounter = (uint8_t)(2 + (getNumberOfBits(integer) + 2) / 3);
+	char* output = utilsWriterReserve(writer, charCounter);
+	if(output == NULL)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	UTILS_Uint2Oct(integer, output, charCounter);
+	writer->cursor += charCounter;
+	return ERROR_SUCCESS;
+}
+
+/**
+ * @brief    Append the shortest decimal string of float
+ *
+ * The string is the same as of UTILS_Float2AsciiShortest().
+ *
+ * @param[in,out] writer:    writer of characters
+ * @param[in]    fp:         floating point value
+ * @param[in]    notation:   fixed or scientific notation
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to writer is NULL
+ *     ERROR_CONVERSION_FAIL     - string does not fit or writer has
+ *                                 overflowed before
+ *     ERROR_SUCCESS             - string is appended
+ */
+UTILS_ERROR UTILS_WriterAppendFloat(UTILS_WRITER* writer, float fp,
+                                    UTILS_FLOAT_NOTATION notation)
+{
+	if(writer == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	/* Directly to the buffer when the longest string fits */
+	if(!writer->overflow &&
+	   writer->capacity - writer->cursor >= UTILS_FLOAT_STRING_MAX_SIZE - 1)
+	{
+		writer->cursor += utilsFloat2Shortest(fp, notation,
+		                                      &writer->buffer[writer->cursor]);
+		return ERROR_SUCCESS;
+	}
+	char buffer[UTILS_FLOAT_STRING_MAX_SIZE];
+	return appendCopy(writer, buffer, utilsFloat2Shortest(fp, notation, buffer));
+}
+
+/**
+ * @brief    Append decimal string of fixed-point value
+ *
+ * The string is the same as of UTILS_Fixed2AsciiString(). Wrong format,
+ * decimals or value out of format range fail without the overflow.
+ *
+ * @param[in,out] writer:    writer of characters
+ * @param[in]    value:      fixed-point value, sign extended to 32 bits
+ * @param[in]    format:     UTILS_Q15, UTILS_Q31, UTILS_Q16_16 or other
+ *                           UTILS_FIXED_FORMAT(width, fraction)
+ * @param[in]    decimals:   number of fraction digits, up to
+ *                           UTILS_FIXED_MAX_DECIMALS
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to writer is NULL
+ *     ERROR_CONVERSION_FAIL     - string does not fit, writer has
+ *                                 overflowed before or conversion is
+ *                                 not possible
+ *     ERROR_SUCCESS             - string is appended
+ */
+UTILS_ERROR UTILS_WriterAppendFixed(UTILS_WRITER* writer, int32_t value,
+                                    uint16_t format, uint8_t decimals)
+{
+	char buffer[UTILS_FIXED_STRING_MAX_SIZE];
+	uint32_t total;
+	if(writer == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	if(writer->overflow ||
+	   utilsFixed2Ascii(value, format, decimals, buffer, &total) != ERROR_SUCCESS)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	return appendCopy(writer, buffer, total);
+}
+
+/**
+ * @brief    Append hexadecimal string of byte buffer
+ *
+ * The string is the same as of UTILS_BytesToHex(): two upper case
+ * characters per byte without prefix.
+ *
+ * @param[in,out] writer:    writer of characters
+ * @param[in]    bytes:      buffer to convert
+ * @param[in]    size:       number of bytes in buffer
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to writer or bytes is NULL
+ *     ERROR_CONVERSION_FAIL     - string does not fit or writer has
+ *                                 overflowed before
+ *     ERROR_SUCCESS             - string is appended
+ */
+UTILS_ERROR UTILS_WriterAppendBytesHex(UTILS_WRITER* writer,
+                                       const uint8_t* bytes, uint32_t size)
+{
+	if(writer == NULL || bytes == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	uint64_t charCounter = (uint64_t)size * 2;
+	char* output = utilsWriterReserve(writer, charCounter);
+	if(output == NULL)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	UTILS_BytesToHex(bytes, size, output, (uint32_t)charCounter);
+	writer->cursor += (uint32_t)charCounter;
+	return ERROR_SUCCESS;
+}
+
+/**
+ * @brief    Append Base64 string of byte buffer
+ *
+ * The string is the same as of UTILS_BytesToBase64(): padded for standard
+ * alphabet and without padding for URL-safe one.
+ *
+ * @param[in,out] writer:    writer of characters
+ * @param[in]    bytes:      buffer to convert
+ * @param[in]    size:       number of bytes in buffer
+ * @param[in]    alphabet:   standard or URL-safe alphabet
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to writer or bytes is NULL
+ *     ERROR_CONVERSION_FAIL     - string does not fit, writer has
+ *                                 overflowed before or alphabet is wrong
+ *     ERROR_SUCCESS             - string is appended
+ */
+UTILS_ERROR UTILS_WriterAppendBase64(UTILS_WRITER* writer, const uint8_t* bytes,
+                                     uint32_t size, UTILS_BASE64_ALPHABET alphabet)
+{
+	if(writer == NULL || bytes == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	uint64_t charCounter;
+	if(alphabet == UTILS_BASE64_STANDARD)
+	{
+		charCounter = UTILS_BASE64_ENCODED_SIZE((uint64_t)size);
+	}
+	else if(alphabet == UTILS_BASE64_URL)
+	{
+		charCounter = ((uint64_t)size * 4 + 2) / 3;
+	}
+	else
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	char* output = utilsWriterReserve(writer, charCounter);
+	if(output == NULL)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	UTILS_BytesToBase64(bytes, size, alphabet, output, (uint32_t)charCounter);
+	writer->cursor += (uint32_t)charCounter;
+	return ERROR_SUCCESS;
+}
+
+/**
+ * @brief    Finish the text of writer
+ *
+ * The terminating NULL is written after the last character, but it is not
+ * counted in 'size'. Appends after an overflow are not written, so checking
+ * the result of this function is enough for the whole text.
+ *
+ * @param[in,out] writer:    writer of characters
+ * @param[out]   size:       number of characters of the text
+ *
+ * @return Utils error:
+ *     ERROR_NULL_POINTER        - pointer to writer or size is NULL
+ *     ERROR_CONVERSION_FAIL     - any append has overflowed or there is no
+ *                                 space for NULL, the text is cut
+ *     ERROR_SUCCESS             - text is complete
+ */
+UTILS_ERROR UTILS_WriterFinish(UTILS_WRITER* writer, uint32_t* size)
+{
+	if(writer == NULL || size == NULL)
+	{
+		return ERROR_NULL_POINTER;
+	}
+	*size = writer->cursor;
+	char* output = utilsWriterReserve(writer, 1);
+	if(output == NULL)
+	{
+		return ERROR_CONVERSION_FAIL;
+	}
+	output[0] = 0x00;
+	return ERROR_SUCCESS;
+}